@@ -0,0 +1,138 @@
+﻿/*****************************************************************//**
+ * @file	BenchCommon.h
+ * @brief	ECSベンチマーク用の共通ヘルパー
+ *
+ * @details
+ * 計測（Measure）と結果の収集（Reporter）を行う。
+ * 結果は CSV / JSON で出力でき、実行毎に比較して性能の劣化を追跡する。
+ * エンジン本体に依存しないため、Windows以外でもビルドできる。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___BENCH_COMMON_H___
+#define ___BENCH_COMMON_H___
+
+// ===== インクルード =====
+#include "Engine/Scene/Core/ECS/ECS.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Arche
+{
+	namespace Bench
+	{
+		// 計測結果 1件
+		struct Result
+		{
+			std::string suite;		// 分類（SparseSet, View ...）
+			std::string name;		// ケース名
+			std::size_t entities;	// エンティティ数
+			double nsPerOp;			// 1操作あたりの時間（ナノ秒）
+			std::size_t bytes;		// メモリ使用量（計測しない場合は 0）
+		};
+
+		// 最適化による計算の消去を防ぐ
+		inline volatile std::size_t g_sink = 0;
+
+		template<typename T>
+		inline void DoNotOptimize(const T& value)
+		{
+			g_sink = g_sink + (std::size_t)value;
+		}
+
+		// 関数を repeat 回実行し、最速の 1操作あたり時間（ns）を返す
+		template<typename Func>
+		double Measure(std::size_t ops, Func&& func, int repeat = 5)
+		{
+			double best = 1e300;
+			for (int i = 0; i < repeat; ++i)
+			{
+				auto start = std::chrono::steady_clock::now();
+				func();
+				auto end = std::chrono::steady_clock::now();
+				std::chrono::duration<double, std::nano> ns = end - start;
+				best = (std::min)(best, ns.count());
+			}
+			return ops > 0 ? best / (double)ops : best;
+		}
+
+		// 毎回 setup() で状態を作り直してから func() を計測する（追加 / 削除など状態を消費する操作用）
+		template<typename Setup, typename Func>
+		double MeasureWithSetup(std::size_t ops, Setup&& setup, Func&& func, int repeat = 5)
+		{
+			double best = 1e300;
+			for (int i = 0; i < repeat; ++i)
+			{
+				setup();
+				auto start = std::chrono::steady_clock::now();
+				func();
+				auto end = std::chrono::steady_clock::now();
+				std::chrono::duration<double, std::nano> ns = end - start;
+				best = (std::min)(best, ns.count());
+			}
+			return ops > 0 ? best / (double)ops : best;
+		}
+
+		// 結果の収集と出力
+		class Reporter
+		{
+		public:
+			void Add(const std::string& suite, const std::string& name, std::size_t entities, double nsPerOp, std::size_t bytes = 0)
+			{
+				m_results.push_back({ suite, name, entities, nsPerOp, bytes });
+			}
+
+			// 計測するエンティティ数の上限（--max で指定 / 1M を省いて短時間で回す場合など）
+			void SetMaxEntities(std::size_t max) { m_maxEntities = max; }
+			bool Accepts(std::size_t entities) const { return entities <= m_maxEntities; }
+
+			// CSV形式で出力
+			void WriteCsv(std::ostream& os) const
+			{
+				os << "suite,name,entities,ns_per_op,bytes\n";
+				for (const auto& r : m_results)
+				{
+					os << r.suite << "," << r.name << "," << r.entities << "," << r.nsPerOp << "," << r.bytes << "\n";
+				}
+			}
+
+			// JSON形式で出力（{ "results": [ { ... }, ... ] }）
+			void WriteJson(std::ostream& os) const
+			{
+				os << "{\n  \"results\": [\n";
+				for (std::size_t i = 0; i < m_results.size(); ++i)
+				{
+					const auto& r = m_results[i];
+					os << "    { \"suite\": \"" << r.suite << "\", \"name\": \"" << r.name
+						<< "\", \"entities\": " << r.entities << ", \"ns_per_op\": " << r.nsPerOp
+						<< ", \"bytes\": " << r.bytes << " }" << (i + 1 < m_results.size() ? ",\n" : "\n");
+				}
+				os << "  ]\n}\n";
+			}
+
+			const std::vector<Result>& GetResults() const { return m_results; }
+
+		private:
+			std::vector<Result> m_results;
+			std::size_t m_maxEntities = SIZE_MAX;
+		};
+
+		// 各スイート
+		void RunSparseSetBench(Reporter& reporter);
+		void RunGroupBench(Reporter& reporter);
+		void RunHierarchyBench(Reporter& reporter);
+		void RunParallelBench(Reporter& reporter);
+		void RunEntityBench(Reporter& reporter);
+		void RunRegistryBench(Reporter& reporter);
+
+	}	// namespace Bench
+
+}	// namespace Arche
+
+#endif // !___BENCH_COMMON_H___
@@ -0,0 +1,126 @@
+﻿/*****************************************************************//**
+ * @file	EntityBench.cpp
+ * @brief	生存エンティティ一覧による Registry::each / 生存数の計測
+ *
+ * @details
+ * 100k 回の作成 / 削除を繰り返した後（スロットが疎になった状態）で、
+ * 生存一覧を走査する each() と、従来の全スロット走査を比較する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Bench/BenchCommon.h"
+#include <random>
+
+namespace Arche
+{
+	namespace Bench
+	{
+		namespace
+		{
+			// 従来方式（発行済みの全スロットを走査し、スロットのハンドルで生存を判定）
+			struct SlotTable
+			{
+				std::vector<Entity> slots = { NullEntity };
+
+				void onCreate(Entity entity)
+				{
+					const Entity index = EntityTraits::toIndex(entity);
+					if (slots.size() <= index) slots.resize(index + 1, NullEntity);
+					slots[index] = entity;
+				}
+
+				void onDestroy(Entity entity)
+				{
+					slots[EntityTraits::toIndex(entity)] = NullEntity;
+				}
+
+				template<typename Func>
+				void each(Func func) const
+				{
+					for (Entity i = 1; i < (Entity)slots.size(); ++i)
+					{
+						if (slots[i] != NullEntity && EntityTraits::toIndex(slots[i]) == i) func(slots[i]);
+					}
+				}
+			};
+
+			constexpr std::size_t ChurnCycles = 100'000;
+		}
+
+		void RunEntityBench(Reporter& reporter)
+		{
+			const std::size_t peaks[] = { 10'000, 100'000 };
+
+			for (std::size_t peak : peaks)
+			{
+				if (!reporter.Accepts(peak)) continue;
+
+				Registry registry;
+				SlotTable table;
+				std::mt19937 rng(42);
+
+				std::vector<Entity> live;
+				live.reserve(peak);
+				for (std::size_t i = 0; i < peak; ++i)
+				{
+					Entity e = registry.create();
+					table.onCreate(e);
+					live.push_back(e);
+				}
+
+				// 作成 / 削除の繰り返し（ランダムな位置を削除して作り直す）
+				const double churnNs = Measure(ChurnCycles, [&]() {
+					for (std::size_t i = 0; i < ChurnCycles; ++i)
+					{
+						const std::size_t pick = rng() % live.size();
+						registry.destroy(live[pick]);
+						table.onDestroy(live[pick]);
+						live[pick] = registry.create();
+						table.onCreate(live[pick]);
+					}
+				}, 1);
+				reporter.Add("Entity", "churn_create_destroy", peak, churnNs);
+
+				// 9割を削除して、スロットが疎な状態にする
+				std::shuffle(live.begin(), live.end(), rng);
+				const std::size_t keep = peak / 10;
+				for (std::size_t i = keep; i < live.size(); ++i)
+				{
+					registry.destroy(live[i]);
+					table.onDestroy(live[i]);
+				}
+				live.resize(keep);
+
+				// 生存一覧の走査（1体あたり）
+				reporter.Add("Entity", "each_alive_list", keep, Measure(keep, [&]() {
+					std::size_t sum = 0;
+					registry.each([&](Entity e) { sum += e; });
+					DoNotOptimize(sum);
+				}));
+
+				// 従来の全スロット走査（比較用 / 1体あたり）
+				reporter.Add("Entity", "each_slot_scan", keep, Measure(keep, [&]() {
+					std::size_t sum = 0;
+					table.each([&](Entity e) { sum += e; });
+					DoNotOptimize(sum);
+				}));
+
+				// 生存数の取得（保持している件数 / 走査して数える場合）
+				reporter.Add("Entity", "count_alive", keep, Measure(1, [&]() {
+					DoNotOptimize(registry.aliveCount());
+				}));
+				reporter.Add("Entity", "count_slot_scan", keep, Measure(1, [&]() {
+					std::size_t count = 0;
+					table.each([&](Entity) { ++count; });
+					DoNotOptimize(count);
+				}));
+			}
+		}
+
+	}	// namespace Bench
+
+}	// namespace Arche
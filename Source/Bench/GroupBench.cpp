@@ -0,0 +1,100 @@
+﻿/*****************************************************************//**
+ * @file	GroupBench.cpp
+ * @brief	View と Owning Group の複数コンポーネント走査の比較
+ *
+ * @details
+ * PhysicsSystem の Transform + Rigidbody 積分を模したループで、
+ * 最小プール駆動 + sparse 検索の View と、先頭に詰められた Group を比較する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Bench/BenchCommon.h"
+
+namespace Arche
+{
+	namespace Bench
+	{
+		namespace
+		{
+			// Transform 相当（位置 / 回転 / スケール / ワールド行列）
+			struct BenchTransform
+			{
+				float position[3] = {};
+				float rotation[4] = { 0, 0, 0, 1 };
+				float scale[3] = { 1, 1, 1 };
+				float world[16] = {};
+			};
+
+			// Rigidbody 相当
+			struct BenchRigidbody
+			{
+				float velocity[3] = { 1, 2, 3 };
+				float drag = 0.1f;
+			};
+
+			// 無関係なコンポーネント（プールの並びを崩すため）
+			struct BenchTag
+			{
+				int value = 0;
+			};
+
+			// 全員が Transform、半数が Rigidbody（不規則に配置）
+			void Populate(Registry& registry, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Entity e = registry.create();
+					if (i % 3 == 0) registry.emplace<BenchTag>(e);
+					registry.emplace<BenchTransform>(e);
+					if ((i * 7) % 2 == 0 || i % 5 == 0) registry.emplace<BenchRigidbody>(e);
+				}
+			}
+
+			template<typename Func>
+			double RunIntegrate(std::size_t count, Func&& iterate)
+			{
+				Registry registry;
+				Populate(registry, count);
+				const float dt = 1.0f / 60.0f;
+
+				return Measure(count, [&]() {
+					iterate(registry, [&](Entity, BenchTransform& t, BenchRigidbody& rb) {
+						t.position[0] += rb.velocity[0] * dt;
+						t.position[1] += rb.velocity[1] * dt;
+						t.position[2] += rb.velocity[2] * dt;
+					});
+				});
+			}
+		}
+
+		void RunGroupBench(Reporter& reporter)
+		{
+			const std::size_t counts[] = { 10'000, 100'000 };
+
+			for (std::size_t n : counts)
+			{
+				if (!reporter.Accepts(n)) continue;
+
+				reporter.Add("Group", "view_transform_rigidbody", n, RunIntegrate(n, [](Registry& r, auto&& f) {
+					r.view<BenchTransform, BenchRigidbody>().each(f);
+				}));
+
+				reporter.Add("Group", "group_transform_rigidbody", n, RunIntegrate(n, [](Registry& r, auto&& f) {
+					r.group<BenchTransform, BenchRigidbody>().each(f);
+				}));
+
+				reporter.Add("Group", "group_rigidbody_with_transform", n, RunIntegrate(n, [](Registry& r, auto&& f) {
+					r.group<BenchRigidbody>(With<BenchTransform>{}).each([&](Entity e, BenchRigidbody& rb, BenchTransform& t) {
+						f(e, t, rb);
+					});
+				}));
+			}
+		}
+
+	}	// namespace Bench
+
+}	// namespace Arche
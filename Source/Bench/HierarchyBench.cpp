@@ -0,0 +1,120 @@
+﻿/*****************************************************************//**
+ * @file	HierarchyBench.cpp
+ * @brief	階層の深さに対する View 走査コストの計測
+ *
+ * @details
+ * EnemyFactory のボス（ルート + 多段のパーツ）を模した親子チェーンを作り、
+ * 深さを変えながら View 走査時間を計測する。
+ * キャッシュ済みの Active 判定（isActive）と、従来の親を辿る再帰判定を比較する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Bench/BenchCommon.h"
+
+namespace Arche
+{
+	namespace Bench
+	{
+		namespace
+		{
+			// Relationship 相当
+			struct BenchRelationship
+			{
+				Entity parent = NullEntity;
+				std::vector<Entity> children;
+			};
+
+			struct BenchTransform
+			{
+				float position[3] = {};
+				float world[16] = {};
+			};
+
+			// 深さ depth のチェーンを count 体分作る
+			void BuildChains(Registry& registry, std::size_t count, std::size_t depth)
+			{
+				registry.SetParentLookup([&registry](Entity e) {
+					return registry.has<BenchRelationship>(e) ? registry.get<BenchRelationship>(e).parent : NullEntity;
+				});
+				registry.SetChildrenLookup([&registry](Entity e, std::vector<Entity>& out) {
+					if (!registry.has<BenchRelationship>(e)) return;
+					const auto& children = registry.get<BenchRelationship>(e).children;
+					out.insert(out.end(), children.begin(), children.end());
+				});
+
+				Entity parent = NullEntity;
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Entity e = registry.create();
+					registry.emplace<BenchTransform>(e);
+					auto& rel = registry.emplace<BenchRelationship>(e);
+
+					if (i % depth != 0)
+					{
+						rel.parent = parent;
+						registry.get<BenchRelationship>(parent).children.push_back(e);
+						registry.updateActiveHierarchy(e);
+					}
+					parent = e;
+				}
+			}
+
+			// 変更前の isActive() と同じ、親を毎回辿る判定
+			bool IsActiveRecursive(Registry& registry, Entity entity)
+			{
+				if (!registry.isActiveSelf(entity)) return false;
+				Entity parent = registry.get<BenchRelationship>(entity).parent;
+				return parent == NullEntity || IsActiveRecursive(registry, parent);
+			}
+		}
+
+		void RunHierarchyBench(Reporter& reporter)
+		{
+			const std::size_t count = 100'000;
+			const std::size_t depths[] = { 1, 4, 16, 64 };
+			if (!reporter.Accepts(count)) return;
+
+			for (std::size_t depth : depths)
+			{
+				Registry registry;
+				BuildChains(registry, count, depth);
+
+				const std::string suffix = "_depth" + std::to_string(depth);
+
+				// キャッシュ済みビットによる View 走査
+				reporter.Add("Hierarchy", "view_cached" + suffix, count, Measure(count, [&]() {
+					registry.view<BenchTransform>().each([](Entity, BenchTransform& t) {
+						t.position[0] += 1.0f;
+					});
+				}));
+
+				// 従来の再帰判定（比較用）
+				auto& transforms = registry.getPool<BenchTransform>();
+				reporter.Add("Hierarchy", "view_recursive" + suffix, count, Measure(count, [&]() {
+					for (Entity e : transforms.getEntities())
+					{
+						if (!IsActiveRecursive(registry, e)) continue;
+						transforms.get(e).position[0] += 1.0f;
+					}
+				}));
+
+				// ルートの ON/OFF 切り替え（サブツリー再計算のコスト / チェーン1本あたり）
+				std::vector<Entity> roots;
+				for (Entity e : transforms.getEntities())
+				{
+					if (registry.get<BenchRelationship>(e).parent == NullEntity) roots.push_back(e);
+				}
+				reporter.Add("Hierarchy", "set_active_root" + suffix, roots.size(), Measure(roots.size() * 2, [&]() {
+					for (Entity e : roots) registry.setActive(e, false);
+					for (Entity e : roots) registry.setActive(e, true);
+				}));
+			}
+		}
+
+	}	// namespace Bench
+
+}	// namespace Arche
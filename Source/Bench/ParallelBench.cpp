@@ -0,0 +1,99 @@
+﻿/*****************************************************************//**
+ * @file	ParallelBench.cpp
+ * @brief	each と par_each（JobSystem による並列走査）の比較
+ *
+ * @details
+ * HierarchySystem / GeometricRenderSystem の行列計算を模した、
+ * 1エンティティあたりの計算がやや重いループで View / Query / Group を比較する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Bench/BenchCommon.h"
+#include <cmath>
+
+namespace Arche
+{
+	namespace Bench
+	{
+		namespace
+		{
+			struct BenchLocal
+			{
+				float position[3] = { 1, 2, 3 };
+				float angle = 0.5f;
+				float scale = 1.0f;
+			};
+
+			struct BenchWorld
+			{
+				float m[16] = {};
+			};
+
+			// 全員が両方を持つ
+			void Populate(Registry& registry, std::size_t count)
+			{
+				std::vector<Entity> entities(count);
+				registry.create(count, entities.data());
+				registry.insert<BenchLocal>(entities.begin(), entities.end());
+				registry.insert<BenchWorld>(entities.begin(), entities.end());
+			}
+
+			// Y軸回転 * スケール * 平行移動 のワールド行列を計算
+			void Compute(Entity, const BenchLocal& l, BenchWorld& w)
+			{
+				const float c = std::cos(l.angle) * l.scale;
+				const float s = std::sin(l.angle) * l.scale;
+				w.m[0] = c;  w.m[2] = -s;
+				w.m[5] = l.scale;
+				w.m[8] = s;  w.m[10] = c;
+				w.m[12] = l.position[0]; w.m[13] = l.position[1]; w.m[14] = l.position[2];
+				w.m[15] = 1.0f;
+			}
+
+			template<typename Func>
+			double Run(std::size_t count, Func&& iterate)
+			{
+				Registry registry;
+				Populate(registry, count);
+				return Measure(count, [&]() { iterate(registry); });
+			}
+		}
+
+		void RunParallelBench(Reporter& reporter)
+		{
+			const std::size_t counts[] = { 100'000, 1'000'000 };
+
+			for (std::size_t n : counts)
+			{
+				if (!reporter.Accepts(n)) continue;
+
+				reporter.Add("Parallel", "view_each", n, Run(n, [](Registry& r) {
+					r.view<const BenchLocal, BenchWorld>().each(Compute);
+				}));
+				reporter.Add("Parallel", "view_par_each", n, Run(n, [](Registry& r) {
+					r.view<const BenchLocal, BenchWorld>().par_each(Compute);
+				}));
+
+				reporter.Add("Parallel", "query_each", n, Run(n, [](Registry& r) {
+					r.query<const BenchLocal, BenchWorld>().each(Compute);
+				}));
+				reporter.Add("Parallel", "query_par_each", n, Run(n, [](Registry& r) {
+					r.query<const BenchLocal, BenchWorld>().par_each(Compute);
+				}));
+
+				reporter.Add("Parallel", "group_each", n, Run(n, [](Registry& r) {
+					r.group<BenchLocal, BenchWorld>().each(Compute);
+				}));
+				reporter.Add("Parallel", "group_par_each", n, Run(n, [](Registry& r) {
+					r.group<BenchLocal, BenchWorld>().par_each(Compute);
+				}));
+			}
+		}
+
+	}	// namespace Bench
+
+}	// namespace Arche
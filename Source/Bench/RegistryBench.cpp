@@ -0,0 +1,338 @@
+﻿/*****************************************************************//**
+ * @file	RegistryBench.cpp
+ * @brief	Registry の基本操作のスループット計測
+ *
+ * @details
+ * 1k / 10k / 100k / 1M 体で、エンジン更新による性能の劣化を追跡するための基準値を取る。
+ * - 作成 / 削除の繰り返し、コンポーネントの追加 / 削除
+ * - View の走査（1 / 2 / 3 種類、exclude 付き）
+ * - Observer の通知（購読数を変えた追加のコスト）
+ * - 親子階層を持つ状態での isActive()
+ * - Signal / Dispatcher の通知
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Bench/BenchCommon.h"
+#include <memory>
+#include <random>
+
+namespace Arche
+{
+	namespace Bench
+	{
+		namespace
+		{
+			struct BenchPosition
+			{
+				float x = 0.0f, y = 0.0f, z = 0.0f;
+			};
+
+			struct BenchVelocity
+			{
+				float x = 1.0f, y = 2.0f, z = 3.0f;
+			};
+
+			struct BenchHealth
+			{
+				int value = 100;
+			};
+
+			// exclude の対象（1/4 が所持）
+			struct BenchStatic
+			{
+				int dummy = 0;
+			};
+
+			struct BenchParent
+			{
+				Entity parent = NullEntity;
+				std::vector<Entity> children;
+			};
+
+			struct BenchEvent
+			{
+				int value = 0;
+			};
+
+			// Signal / Dispatcher の受信側
+			struct Listener
+			{
+				std::size_t sum = 0;
+				void receive(int value) { sum += (std::size_t)value; }
+				void receiveEvent(const BenchEvent& e) { sum += (std::size_t)e.value; }
+			};
+
+			// 全員が Position、半数が Velocity、1/3 が Health、1/4 が Static（不規則に配置）
+			void Populate(Registry& registry, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Entity e = registry.create();
+					registry.emplace<BenchPosition>(e);
+					if (i % 2 == 0) registry.emplace<BenchVelocity>(e);
+					if (i % 3 == 0) registry.emplace<BenchHealth>(e);
+					if (i % 4 == 0) registry.emplace<BenchStatic>(e);
+				}
+			}
+
+			// 深さ depth のチェーンを count 体分作る
+			void BuildChains(Registry& registry, std::size_t count, std::size_t depth)
+			{
+				registry.SetParentLookup([&registry](Entity e) {
+					return registry.has<BenchParent>(e) ? registry.get<BenchParent>(e).parent : NullEntity;
+				});
+				registry.SetChildrenLookup([&registry](Entity e, std::vector<Entity>& out) {
+					if (!registry.has<BenchParent>(e)) return;
+					const auto& children = registry.get<BenchParent>(e).children;
+					out.insert(out.end(), children.begin(), children.end());
+				});
+
+				Entity parent = NullEntity;
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					Entity e = registry.create();
+					auto& rel = registry.emplace<BenchParent>(e);
+					if (i % depth != 0)
+					{
+						rel.parent = parent;
+						registry.get<BenchParent>(parent).children.push_back(e);
+						registry.updateActiveHierarchy(e);
+					}
+					parent = e;
+				}
+			}
+
+			void RunEntityOps(Reporter& reporter, std::size_t n)
+			{
+				// 一括作成 / 一括削除（空の Registry から n 体 / 1体あたり）
+				std::unique_ptr<Registry> registry;
+				std::vector<Entity> entities(n);
+				reporter.Add("Registry", "create", n, MeasureWithSetup(n,
+					[&]() { registry = std::make_unique<Registry>(); },
+					[&]() { for (std::size_t i = 0; i < n; ++i) entities[i] = registry->create(); }));
+
+				reporter.Add("Registry", "destroy", n, MeasureWithSetup(n,
+					[&]() {
+						registry = std::make_unique<Registry>();
+						for (std::size_t i = 0; i < n; ++i) entities[i] = registry->create();
+					},
+					[&]() { for (Entity e : entities) registry->destroy(e); }));
+
+				// 作成 / 削除の繰り返し（n 体が生存している状態で、ランダムな位置を作り直す / 1組あたり）
+				registry = std::make_unique<Registry>();
+				Populate(*registry, n);
+				std::vector<Entity> live;
+				live.reserve(n);
+				registry->each([&](Entity e) { live.push_back(e); });
+				std::mt19937 rng(42);
+				const std::size_t cycles = (std::min)(n, (std::size_t)100'000);
+				reporter.Add("Registry", "churn_create_destroy", n, Measure(cycles, [&]() {
+					for (std::size_t i = 0; i < cycles; ++i)
+					{
+						const std::size_t pick = rng() % live.size();
+						registry->destroy(live[pick]);
+						live[pick] = registry->create();
+						registry->emplace<BenchPosition>(live[pick]);
+					}
+				}));
+			}
+
+			void RunComponentOps(Reporter& reporter, std::size_t n)
+			{
+				Registry registry;
+				std::vector<Entity> entities(n);
+				for (std::size_t i = 0; i < n; ++i) entities[i] = registry.create();
+
+				auto removeAll = [&]() {
+					for (Entity e : entities) if (registry.has<BenchVelocity>(e)) registry.remove<BenchVelocity>(e);
+				};
+
+				// 追加 / 削除（1体あたり）
+				reporter.Add("Registry", "emplace", n, MeasureWithSetup(n,
+					removeAll,
+					[&]() { for (Entity e : entities) registry.emplace<BenchVelocity>(e); }));
+
+				reporter.Add("Registry", "remove", n, MeasureWithSetup(n,
+					[&]() { registry.insert<BenchVelocity>(entities.begin(), entities.end()); },
+					[&]() { for (Entity e : entities) registry.remove<BenchVelocity>(e); }));
+
+				// 一括追加（通知は1回 / 1体あたり）
+				reporter.Add("Registry", "insert_range", n, MeasureWithSetup(n,
+					removeAll,
+					[&]() { registry.insert<BenchVelocity>(entities.begin(), entities.end()); }));
+
+				// 所持判定 / 取得（1体あたり）
+				reporter.Add("Registry", "has", n, Measure(n, [&]() {
+					std::size_t hits = 0;
+					for (Entity e : entities) hits += registry.has<BenchVelocity>(e) ? 1 : 0;
+					DoNotOptimize(hits);
+				}));
+				reporter.Add("Registry", "get", n, Measure(n, [&]() {
+					float sum = 0.0f;
+					for (Entity e : entities) sum += registry.get<BenchVelocity>(e).x;
+					DoNotOptimize(sum);
+				}));
+			}
+
+			void RunViewOps(Reporter& reporter, std::size_t n)
+			{
+				Registry registry;
+				Populate(registry, n);
+				const float dt = 1.0f / 60.0f;
+
+				// 走査（Registry の総数あたり）
+				reporter.Add("Registry", "view_1", n, Measure(n, [&]() {
+					registry.view<BenchPosition>().each([&](Entity, BenchPosition& p) {
+						p.x += dt;
+					});
+				}));
+
+				reporter.Add("Registry", "view_2", n, Measure(n, [&]() {
+					registry.view<BenchPosition, BenchVelocity>().each([&](Entity, BenchPosition& p, BenchVelocity& v) {
+						p.x += v.x * dt;
+						p.y += v.y * dt;
+						p.z += v.z * dt;
+					});
+				}));
+
+				reporter.Add("Registry", "view_3", n, Measure(n, [&]() {
+					registry.view<BenchPosition, BenchVelocity, BenchHealth>().each([&](Entity, BenchPosition& p, BenchVelocity& v, BenchHealth& h) {
+						p.x += v.x * dt;
+						h.value -= 1;
+					});
+				}));
+
+				reporter.Add("Registry", "view_2_exclude", n, Measure(n, [&]() {
+					registry.view<BenchPosition, BenchVelocity>().exclude<BenchStatic>().each([&](Entity, BenchPosition& p, BenchVelocity& v) {
+						p.x += v.x * dt;
+					});
+				}));
+
+				// イテレータ経由の走査（for (Entity e : view)）
+				reporter.Add("Registry", "view_2_iterator", n, Measure(n, [&]() {
+					std::size_t sum = 0;
+					for (Entity e : registry.view<BenchPosition, BenchVelocity>()) sum += e;
+					DoNotOptimize(sum);
+				}));
+			}
+
+			void RunObserverOps(Reporter& reporter, std::size_t n)
+			{
+				const std::size_t fanouts[] = { 1, 8 };
+
+				for (std::size_t fanout : fanouts)
+				{
+					Registry registry;
+					std::vector<Entity> entities(n);
+					for (std::size_t i = 0; i < n; ++i) entities[i] = registry.create();
+
+					std::vector<std::unique_ptr<Observer>> observers;
+					for (std::size_t i = 0; i < fanout; ++i)
+					{
+						observers.push_back(std::make_unique<Observer>());
+						observers.back()->connect(registry).group<BenchHealth>();
+					}
+
+					const std::string suffix = "_x" + std::to_string(fanout);
+
+					// 購読されている型の追加（通知のコスト込み / 1体あたり）
+					reporter.Add("Registry", "observer_emplace" + suffix, n, MeasureWithSetup(n,
+						[&]() {
+							for (Entity e : entities) if (registry.has<BenchHealth>(e)) registry.remove<BenchHealth>(e);
+							for (auto& observer : observers) observer->clear();
+						},
+						[&]() { for (Entity e : entities) registry.emplace<BenchHealth>(e); }));
+
+					// 検知したエンティティの走査（全 Observer 分 / 1体あたり）
+					reporter.Add("Registry", "observer_each" + suffix, n, Measure(n * fanout, [&]() {
+						std::size_t sum = 0;
+						for (auto& observer : observers) observer->each([&](Entity e) { sum += e; });
+						DoNotOptimize(sum);
+					}));
+
+					for (auto& observer : observers) observer->disconnect();
+				}
+			}
+
+			void RunActiveOps(Reporter& reporter, std::size_t n)
+			{
+				const std::size_t depth = 8;
+				Registry registry;
+				BuildChains(registry, n, depth);
+
+				// ルートの 1/8 を非Activeにしておく
+				std::vector<Entity> entities;
+				entities.reserve(n);
+				registry.each([&](Entity e) { entities.push_back(e); });
+				for (std::size_t i = 0; i < entities.size(); i += depth * 8) registry.setActive(entities[i], false);
+
+				// 階層を考慮した判定（1体あたり）
+				reporter.Add("Registry", "is_active_depth8", n, Measure(n, [&]() {
+					std::size_t active = 0;
+					for (Entity e : entities) active += registry.isActive(e) ? 1 : 0;
+					DoNotOptimize(active);
+				}));
+			}
+
+			void RunSignalOps(Reporter& reporter, std::size_t n)
+			{
+				const std::size_t fanouts[] = { 1, 4, 16 };
+
+				for (std::size_t fanout : fanouts)
+				{
+					const std::string suffix = "_x" + std::to_string(fanout);
+
+					// Signal（受信者 fanout 件への同期通知 / 通知1回あたり）
+					std::vector<Listener> listeners(fanout);
+					Signal<int> signal;
+					for (auto& listener : listeners) signal.connect<&Listener::receive>(listener);
+
+					reporter.Add("Registry", "signal_publish" + suffix, n, Measure(n, [&]() {
+						for (std::size_t i = 0; i < n; ++i) signal.publish((int)i);
+					}));
+
+					// Dispatcher（即時 / キューに積んでからまとめて通知）
+					for (auto& listener : listeners) Dispatcher::sink<BenchEvent>().connect<&Listener::receiveEvent>(listener);
+
+					reporter.Add("Registry", "dispatcher_trigger" + suffix, n, Measure(n, [&]() {
+						for (std::size_t i = 0; i < n; ++i) Dispatcher::trigger(BenchEvent{ (int)i });
+					}));
+
+					reporter.Add("Registry", "dispatcher_enqueue_update" + suffix, n, Measure(n, [&]() {
+						for (std::size_t i = 0; i < n; ++i) Dispatcher::enqueue(BenchEvent{ (int)i });
+						Dispatcher::update<BenchEvent>();
+					}));
+
+					for (auto& listener : listeners) Dispatcher::sink<BenchEvent>().disconnect(&listener);
+
+					std::size_t sum = 0;
+					for (auto& listener : listeners) sum += listener.sum;
+					DoNotOptimize(sum);
+				}
+			}
+		}
+
+		void RunRegistryBench(Reporter& reporter)
+		{
+			const std::size_t counts[] = { 1'000, 10'000, 100'000, 1'000'000 };
+
+			for (std::size_t n : counts)
+			{
+				if (!reporter.Accepts(n)) continue;
+
+				RunEntityOps(reporter, n);
+				RunComponentOps(reporter, n);
+				RunViewOps(reporter, n);
+				RunObserverOps(reporter, n);
+				RunActiveOps(reporter, n);
+				RunSignalOps(reporter, n);
+			}
+		}
+
+	}	// namespace Bench
+
+}	// namespace Arche
@@ -0,0 +1,126 @@
+﻿/*****************************************************************//**
+ * @file	SparseSetBench.cpp
+ * @brief	SparseSet のページ分割 Sparse 配列と従来のフラット配列の比較
+ *
+ * @details
+ * - メモリ：少数のエンティティしか持たないプールを多数作った場合の使用量
+ * - has()：密 / 疎なプールに対する存在判定のスループット
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Bench/BenchCommon.h"
+
+namespace Arche
+{
+	namespace Bench
+	{
+		namespace
+		{
+			// 従来方式（Entity ID の最大値まで伸びるフラット配列）
+			struct FlatSparse
+			{
+				std::vector<Entity> values;
+
+				Entity get(Entity index) const
+				{
+					return index < values.size() ? values[index] : NullEntity;
+				}
+
+				void insert(Entity index, Entity value)
+				{
+					if (values.size() <= index) values.resize(index + 1, NullEntity);
+					values[index] = value;
+				}
+
+				std::size_t memoryUsage() const { return values.capacity() * sizeof(Entity); }
+			};
+
+			// SparseSet::has() と同じ判定を行う最小構成
+			template<typename Index>
+			struct MiniSet
+			{
+				Index sparse;
+				std::vector<Entity> dense;
+
+				void add(Entity entity)
+				{
+					sparse.insert(EntityTraits::toIndex(entity), (Entity)dense.size());
+					dense.push_back(entity);
+				}
+
+				bool has(Entity entity) const
+				{
+					const Entity pos = sparse.get(EntityTraits::toIndex(entity));
+					return pos < dense.size() && dense[pos] == entity;
+				}
+			};
+
+			constexpr std::size_t PoolCount = 40;		// 登録コンポーネント数の想定
+			constexpr std::size_t OwnersPerPool = 3;	// 各プールの所持エンティティ数
+
+			// 多数のプールが少数の高IDエンティティを持つ状況のメモリ使用量
+			template<typename Index>
+			std::size_t MeasureMemory(std::size_t entityCount)
+			{
+				std::vector<MiniSet<Index>> pools(PoolCount);
+				std::size_t bytes = 0;
+				for (std::size_t p = 0; p < PoolCount; ++p)
+				{
+					for (std::size_t k = 0; k < OwnersPerPool; ++k)
+					{
+						// IDが広範囲に散らばるように配置
+						Entity index = (Entity)(entityCount - 1 - (p * 7919 + k * 104729) % entityCount);
+						pools[p].add(EntityTraits::combine(index, 0));
+					}
+					bytes += pools[p].sparse.memoryUsage() + pools[p].dense.capacity() * sizeof(Entity);
+				}
+				return bytes;
+			}
+
+			// 全IDに対する has() のスループット（stride 毎に所持）
+			template<typename Index>
+			double MeasureHas(std::size_t entityCount, std::size_t stride)
+			{
+				MiniSet<Index> set;
+				for (std::size_t i = 1; i < entityCount; i += stride)
+				{
+					set.add(EntityTraits::combine((Entity)i, 0));
+				}
+
+				return Measure(entityCount, [&]() {
+					std::size_t hits = 0;
+					for (std::size_t i = 1; i < entityCount; ++i)
+					{
+						hits += set.has(EntityTraits::combine((Entity)i, 0)) ? 1 : 0;
+					}
+					DoNotOptimize(hits);
+				});
+			}
+		}
+
+		void RunSparseSetBench(Reporter& reporter)
+		{
+			const std::size_t counts[] = { 10'000, 100'000, 1'000'000 };
+
+			for (std::size_t n : counts)
+			{
+				if (!reporter.Accepts(n)) continue;
+
+				reporter.Add("SparseSet", "memory_40pools_flat", n, 0.0, MeasureMemory<FlatSparse>(n));
+				reporter.Add("SparseSet", "memory_40pools_paged", n, 0.0, MeasureMemory<SparsePages>(n));
+
+				reporter.Add("SparseSet", "has_dense_flat", n, MeasureHas<FlatSparse>(n, 1));
+				reporter.Add("SparseSet", "has_dense_paged", n, MeasureHas<SparsePages>(n, 1));
+
+				reporter.Add("SparseSet", "has_sparse64_flat", n, MeasureHas<FlatSparse>(n, 64));
+				reporter.Add("SparseSet", "has_sparse64_paged", n, MeasureHas<SparsePages>(n, 64));
+			}
+		}
+
+	}	// namespace Bench
+
+}	// namespace Arche
@@ -0,0 +1,71 @@
+﻿/*****************************************************************//**
+ * @file	main.cpp
+ * @brief	ECSベンチマークのエントリーポイント
+ *
+ * @details
+ * 結果は標準出力に CSV（--json 指定時は JSON）で出力する。
+ *
+ * ArcheBench [--json] [--max=エンティティ数] [--suite=スイート名 ...]
+ *   --json		: JSON で出力する
+ *   --max=N	: N 体を超える計測を省く（例: --max=100000 で 1M を省く）
+ *   --suite=X	: 指定したスイートだけ実行する（複数指定可）
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Bench/BenchCommon.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+	using namespace Arche::Bench;
+
+	// スイート名と実行関数の対応
+	struct Suite
+	{
+		const char* name;
+		void (*run)(Reporter&);
+	};
+	const Suite suites[] = {
+		{ "SparseSet", RunSparseSetBench },
+		{ "Group", RunGroupBench },
+		{ "Hierarchy", RunHierarchyBench },
+		{ "Parallel", RunParallelBench },
+		{ "Entity", RunEntityBench },
+		{ "Registry", RunRegistryBench },
+	};
+
+	Reporter reporter;
+	bool json = false;
+	std::vector<std::string> selected;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--json") == 0) json = true;
+		else if (std::strncmp(argv[i], "--max=", 6) == 0) reporter.SetMaxEntities(std::strtoull(argv[i] + 6, nullptr, 10));
+		else if (std::strncmp(argv[i], "--suite=", 8) == 0) selected.push_back(argv[i] + 8);
+		else
+		{
+			std::cerr << "unknown option: " << argv[i] << "\n";
+			return 1;
+		}
+	}
+
+	Arche::JobSystem::Initialize();
+
+	for (const Suite& suite : suites)
+	{
+		if (!selected.empty() && std::find(selected.begin(), selected.end(), suite.name) == selected.end()) continue;
+		suite.run(reporter);
+	}
+
+	Arche::JobSystem::Shutdown();
+
+	if (json) reporter.WriteJson(std::cout);
+	else reporter.WriteCsv(std::cout);
+	return 0;
+}
@@ -119,8 +119,8 @@ namespace Arche
 		if (world.getSystems().empty())
 		{
 			auto& reg = SystemRegistry::Instance();
-			reg.CreateSystem(world, "Physics System", SystemGroup::PlayOnly);
-			reg.CreateSystem(world, "Collision System", SystemGroup::PlayOnly);
+			reg.CreateSystem(world, "Physics System", SystemGroup::FixedUpdate);
+			reg.CreateSystem(world, "Collision System", SystemGroup::FixedUpdate);
 			reg.CreateSystem(world, "UI System", SystemGroup::Always);
 			reg.CreateSystem(world, "Lifetime System", SystemGroup::PlayOnly);
 			reg.CreateSystem(world, "Hierarchy System", SystemGroup::Always);
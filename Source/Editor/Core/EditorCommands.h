@@ -16,22 +16,11 @@
 #include "Engine/pch.h"
 #include "Editor/Core/CommandHistory.h"
 #include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 #include "Engine/Scene/Serializer/SceneSerializer.h"
 
 namespace Arche
 {
-	static void RemoveChildFromParent(Registry& reg, Entity parent, Entity child)
-	{
-		if (parent != NullEntity && reg.valid(parent) && reg.has<Relationship>(parent))
-		{
-			auto& children = reg.get<Relationship>(parent).children;
-			children.erase(
-				std::remove(children.begin(), children.end(), child),
-				children.end()
-			);
-		}
-	}
-
 	// エンティティ削除コマンド
 	// ------------------------------------------------------------
 	class DeleteEntityCommand
@@ -44,10 +33,8 @@ namespace Arche
 			Registry& reg = m_world.getRegistry();
 
 			// 1. 削除対象の親を覚えておく（Undoでの再結合用）
-			if (reg.has<Relationship>(entity))
-			{
-				m_parentOfTarget = reg.get<Relationship>(entity).parent;
-			}
+			m_parentOfTarget = Hierarchy::GetParent(reg, entity);
+			m_indexInParent = Hierarchy::GetChildIndex(reg, entity);
 
 			// 2. 自分と全子孫を再帰的にバックアップ
 			CollectDescendants(reg, entity);
@@ -57,22 +44,8 @@ namespace Arche
 		{
 			Registry& reg = m_world.getRegistry();
 
-			// 1. 親から切り離す
-			if (m_parentOfTarget != NullEntity)
-			{
-				RemoveChildFromParent(reg, m_parentOfTarget, m_targetEntity);
-			}
-
-			// 2. 収集した全エンティティを削除（リストは親->子の順なので、逆順(子->親)で消すと安全だがEnTTは順序不問）
-			// IDが無効になる前に全て削除
-			for (const auto& backup : m_backups)
-			{
-				Entity e = (Entity)backup.originalID;
-				if (reg.valid(e))
-				{
-					reg.destroy(e);
-				}
-			}
+			// 自分と全子孫を削除（親のリストからは破棄時に自動で外れる）
+			Hierarchy::DestroyRecursive(reg, m_targetEntity);
 		}
 
 		void Undo() override
@@ -103,51 +76,26 @@ namespace Arche
 			// ターゲットのIDを更新（次回Redoのため）
 			m_targetEntity = newTargetEntity;
 
-			// 2. 親子関係のIDリンクを修復（IDリマッピング）
-			for (auto& [oldId, newEntity] : idMap)
+			// 2. 親子関係を繋ぎ直す（デシリアライズ直後の parent は旧IDのまま）
+			std::vector<std::pair<Entity, uint32_t>> oldParents;
+			for (const auto& backup : m_backups)
 			{
-				if (!reg.has<Relationship>(newEntity)) continue;
-				auto& rel = reg.get<Relationship>(newEntity);
-
-				// Parentの書き換え
-				if (rel.parent != NullEntity)
-				{
-					uint32_t oldParentID = (uint32_t)rel.parent;
-					// 復元されたグループ内に親がいるならIDを書き換え
-					if (idMap.count(oldParentID))
-					{
-						rel.parent = idMap[oldParentID];
-					}
-					// 親が削除対象外（生き残っている親）なら、IDはそのまま
-				}
+				Entity newEntity = idMap[backup.originalID];
+				oldParents.push_back({ newEntity, (uint32_t)Hierarchy::GetParent(reg, newEntity) });
+				Hierarchy::Detach(reg, newEntity);
+			}
 
-				// Childrenの書き換え
-				for (auto& child : rel.children)
-				{
-					uint32_t oldChildID = (uint32_t)child;
-					if (idMap.count(oldChildID))
-					{
-						child = idMap[oldChildID];
-					}
-				}
+			// バックアップは親 -> 子（兄弟順）の順なので、末尾に足していけば元の並びになる
+			for (auto& [newEntity, oldParentID] : oldParents)
+			{
+				if (newEntity == m_targetEntity) continue;
+				if (idMap.count(oldParentID)) Hierarchy::SetParent(reg, newEntity, idMap[oldParentID]);
 			}
 
-			// 3. 元の親（削除されずに残っていた親）に、復元したターゲットを再接続
+			// 3. 元の親（削除されずに残っていた親）の元の位置に、復元したターゲットを再接続
 			if (m_parentOfTarget != NullEntity && reg.valid(m_parentOfTarget))
 			{
-				if (!reg.has<Relationship>(m_parentOfTarget))
-					reg.emplace<Relationship>(m_parentOfTarget);
-
-				auto& parentRel = reg.get<Relationship>(m_parentOfTarget);
-				// 重複チェックして追加
-				if (std::find(parentRel.children.begin(), parentRel.children.end(), m_targetEntity) == parentRel.children.end())
-				{
-					parentRel.children.push_back(m_targetEntity);
-				}
-
-				// ターゲット側の親も確実に設定
-				if (!reg.has<Relationship>(m_targetEntity)) reg.emplace<Relationship>(m_targetEntity);
-				reg.get<Relationship>(m_targetEntity).parent = m_parentOfTarget;
+				Hierarchy::InsertChild(reg, m_parentOfTarget, m_targetEntity, m_indexInParent);
 			}
 		}
 
@@ -161,12 +109,9 @@ namespace Arche
 			m_backups.push_back({ (uint32_t)root, data });
 
 			// 子がいれば再帰
-			if (reg.has<Relationship>(root))
+			for (Entity child : Hierarchy::Children(reg, root))
 			{
-				for (auto child : reg.get<Relationship>(root).children)
-				{
-					CollectDescendants(reg, child);
-				}
+				CollectDescendants(reg, child);
 			}
 		}
 
@@ -180,6 +125,7 @@ namespace Arche
 		World& m_world;
 		Entity m_targetEntity; // 削除対象（ルート）
 		Entity m_parentOfTarget; // 削除対象の親ID（Undo復帰用）
+		int m_indexInParent = -1; // 兄弟の中での位置（Undo復帰用）
 
 		// 復元用データリスト
 		std::vector<EntityBackupData> m_backups;
@@ -225,49 +171,24 @@ namespace Arche
 			: m_world(world), m_child(child), m_newParent(newParent), m_oldParent(NullEntity)
 		{
 			Registry& reg = m_world.getRegistry();
-			if (reg.has<Relationship>(child))
-			{
-				m_oldParent = reg.get<Relationship>(child).parent;
-			}
+			m_oldParent = Hierarchy::GetParent(reg, child);
+			m_oldIndex = Hierarchy::GetChildIndex(reg, child);
 		}
 
 		void Execute() override
 		{
-			SetParent(m_child, m_newParent);
+			Registry& reg = m_world.getRegistry();
+			if (!reg.valid(m_child)) return;
+			Hierarchy::SetParent(reg, m_child, m_newParent);
 		}
 
 		void Undo() override
-		{
-			SetParent(m_child, m_oldParent);
-		}
-
-	private:
-		void SetParent(Entity child, Entity parent)
 		{
 			Registry& reg = m_world.getRegistry();
-			if (!reg.valid(child)) return;
-
-			// 1. 旧親から離脱
-			if (reg.has<Relationship>(child))
-			{
-				Entity currParent = reg.get<Relationship>(child).parent;
-				RemoveChildFromParent(reg, currParent, child);
-			}
-
-			// 2. 新規へ所属
-			if (!reg.has<Relationship>(child)) reg.emplace<Relationship>(child);
-			reg.get<Relationship>(child).parent = parent;
+			if (!reg.valid(m_child)) return;
 
-			if (parent != NullEntity && reg.valid(parent))
-			{
-				if (!reg.has<Relationship>(parent)) reg.emplace<Relationship>(parent);
-				// 重複防止
-				auto& children = reg.get<Relationship>(parent).children;
-				if (std::find(children.begin(), children.end(), child) == children.end())
-				{
-					children.push_back(child);
-				}
-			}
+			if (m_oldParent != NullEntity && reg.valid(m_oldParent)) Hierarchy::InsertChild(reg, m_oldParent, m_child, m_oldIndex);
+			else Hierarchy::Detach(reg, m_child);
 		}
 
 	private:
@@ -275,6 +196,7 @@ namespace Arche
 		Entity m_child;
 		Entity m_newParent;
 		Entity m_oldParent;
+		int m_oldIndex = -1;
 	};
 
 	// コンポーネント追加コマンド
@@ -437,22 +359,8 @@ namespace Arche
 			auto& reg = m_world.getRegistry();
 
 			// 現在の親とインデックスを保存（Undo用）
-			if (reg.has<Relationship>(entity))
-			{
-				m_oldParent = reg.get<Relationship>(entity).parent;
-
-				// 旧親の子リストから自分の位置を探す
-				if (m_oldParent != NullEntity)
-				{
-					auto& children = reg.get<Relationship>(m_oldParent).children;
-					auto it = std::find(children.begin(), children.end(), entity);
-					if (it != children.end()) m_oldIndex = (int)std::distance(children.begin(), it);
-				}
-				else
-				{
-					m_oldIndex = 0;
-				}
-			}
+			m_oldParent = Hierarchy::GetParent(reg, entity);
+			m_oldIndex = (std::max)(Hierarchy::GetChildIndex(reg, entity), 0);
 		}
 
 		void Execute() override
@@ -471,40 +379,16 @@ namespace Arche
 			auto& reg = m_world.getRegistry();
 			if (!reg.valid(m_entity)) return;
 
-			// 1. 現在の親から削除
-			Entity currentParent = NullEntity;
-			if (reg.has<Relationship>(m_entity))
-			{
-				currentParent = reg.get<Relationship>(m_entity).parent;
-			}
-
-			if (currentParent != NullEntity && reg.valid(currentParent))
-			{
-				auto& children = reg.get<Relationship>(currentParent).children;
-				auto it = std::find(children.begin(), children.end(), m_entity);
-				if (it != children.end()) children.erase(it);
-			}
-
-			// 2. 新しい親に登録
 			if (parent != NullEntity && reg.valid(parent))
 			{
-				if (!reg.has<Relationship>(parent)) reg.emplace<Relationship>(parent);
-				auto& children = reg.get<Relationship>(parent).children;
-
-				// インデックスの正規化
-				if (index < 0 || index >(int)children.size()) index = (int)children.size();
-
-				children.insert(children.begin() + index, m_entity);
-
-				// コンポーネント更新
-				if (!reg.has<Relationship>(m_entity)) reg.emplace<Relationship>(m_entity);
-				reg.get<Relationship>(m_entity).parent = parent;
+				// 同じ親の中での並べ替えも InsertChild がそのまま扱う
+				Hierarchy::InsertChild(reg, parent, m_entity, index);
 			}
 			else
 			{
 				// 親なし（ルート）にする場合
 				if (!reg.has<Relationship>(m_entity)) reg.emplace<Relationship>(m_entity);
-				reg.get<Relationship>(m_entity).parent = NullEntity;
+				Hierarchy::Detach(reg, m_entity);
 			}
 		}
 
@@ -158,7 +158,7 @@ namespace Arche
 					Logger::Log("Killed all entities.");
 				}
 				else {
-					Entity id = (Entity)std::stoi(args[0]);
+					Entity id = (Entity)std::stoul(args[0]);
 					if (world.getRegistry().valid(id)) {
 						world.getRegistry().destroy(id);
 						Logger::Log("Killed Entity ID: " + args[0]);
@@ -111,6 +111,29 @@ namespace Arche
 		// サムネイル管理
 		ThumbnailCache m_thumbnailCache;
 
+		// グリッドに並べる一覧（毎フレームディレクトリを走査しないよう、一定間隔か変更時に取り直す）
+		static constexpr std::chrono::milliseconds EntriesRefreshInterval{ 500 };
+		std::vector<std::filesystem::directory_entry> m_entries;
+		std::filesystem::path m_entriesDirectory;
+		std::chrono::steady_clock::time_point m_entriesTime;
+		bool m_entriesDirty = true;
+
+		void RefreshEntries()
+		{
+			const auto now = std::chrono::steady_clock::now();
+			if (!m_entriesDirty && m_entriesDirectory == m_currentDirectory && now - m_entriesTime < EntriesRefreshInterval) return;
+
+			m_entries.clear();
+			try {
+				for (const auto& entry : std::filesystem::directory_iterator(m_currentDirectory)) m_entries.push_back(entry);
+			}
+			catch (...) {}
+
+			m_entriesDirectory = m_currentDirectory;
+			m_entriesTime = now;
+			m_entriesDirty = false;
+		}
+
 		// エンティティをプレファブとして保存するヘルパー
 		void CreatePrefabFromEntity(World& world, Entity entity)
 		{
@@ -264,8 +287,9 @@ namespace Arche
 
 			int index = 0; // ループ回数カウンタ
 
-			// ディレクトリ内を走査
-			for (auto& directoryEntry : std::filesystem::directory_iterator(m_currentDirectory))
+			// ディレクトリ内を走査（一覧は一定間隔で取り直す）
+			RefreshEntries();
+			for (const auto& directoryEntry : m_entries)
 			{
 				const auto& path = directoryEntry.path();
 				std::string filename = path.filename().string();
@@ -402,6 +426,7 @@ namespace Arche
 				{
 					Entity droppedEntity = *(const Entity*)payload->Data;
 					CreatePrefabFromEntity(world, droppedEntity);
+					m_entriesDirty = true;
 				}
 				ImGui::EndDragDropTarget();
 			}
@@ -409,9 +434,9 @@ namespace Arche
 			// 背景右クリック（作成メニュー）
 			if (ImGui::BeginPopupContextWindow(nullptr, ImGuiPopupFlags_MouseButtonRight | ImGuiPopupFlags_NoOpenOverItems))
 			{
-				if (ImGui::MenuItem("Create Folder")) std::filesystem::create_directory(m_currentDirectory / "NewFolder");
+				if (ImGui::MenuItem("Create Folder")) { std::filesystem::create_directory(m_currentDirectory / "NewFolder"); m_entriesDirty = true; }
 				ImGui::Separator();
-				if (ImGui::MenuItem("Create Scene")) SceneSerializer::CreateEmptyScene((m_currentDirectory / "NewScene.json").string());
+				if (ImGui::MenuItem("Create Scene")) { SceneSerializer::CreateEmptyScene((m_currentDirectory / "NewScene.json").string()); m_entriesDirty = true; }
 				if (ImGui::MenuItem("Create Component")) { m_createMode = CreateMode::Component; m_showCreatePopup = true; }
 				if (ImGui::MenuItem("Create System")) { m_createMode = CreateMode::System; m_showCreatePopup = true; }
 				if (ImGui::MenuItem("Open in Explorer")) ShellExecuteA(NULL, "open", m_currentDirectory.string().c_str(), NULL, NULL, SW_SHOW);
@@ -446,6 +471,7 @@ namespace Arche
 					{
 						CreateSystemFile(buf);
 					}
+					m_entriesDirty = true;
 					ImGui::CloseCurrentPopup();
 				}
 				ImGui::SameLine();
@@ -471,6 +497,7 @@ namespace Arche
 						if (std::filesystem::exists(m_deletePath))
 						{
 							std::filesystem::remove_all(m_deletePath);
+							m_entriesDirty = true;
 
 							// 2. シーン内の該当プレファブを自動Unpack
 							std::filesystem::path deletedAbs = std::filesystem::absolute(m_deletePath);
@@ -657,6 +684,7 @@ namespace Arche
 					return;
 				}
 				std::filesystem::rename(oldPath, newPath);
+				m_entriesDirty = true;
 				Logger::Log("Renamed to: " + newPath.string());
 			}
 			catch (const std::exception& e)
@@ -671,6 +699,7 @@ namespace Arche
 			try
 			{
 				std::filesystem::rename(srcPath, dstPath);
+				m_entriesDirty = true;
 				Logger::Log("Moved: " + srcPath.string() + " -> " + dstPath.string());
 			}
 			catch (const std::exception& e)
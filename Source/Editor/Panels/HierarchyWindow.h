@@ -19,6 +19,7 @@
 #include "Editor/Core/Editor.h"
 #include "Editor/Core/EditorCommands.h"
 #include "Engine/Scene/Components/Components.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 #include "Engine/Resource/ResourceManager.h"
 #include "Engine/Scene/Serializer/SceneSerializer.h"
 
@@ -86,6 +87,8 @@ namespace Arche
 			{
 				// 検索バー
 				ImGui::InputTextWithHint("##HierSearch", "Search Entity...", m_searchFilter, sizeof(m_searchFilter));
+				// 生存数（Registry が保持している件数を読むだけ）
+				ImGui::TextDisabled("Entities: %d", (int)world.getRegistry().aliveCount());
 				ImGui::Separator();
 
 				// 自動展開ロジック (プライマリ選択が変更された場合)
@@ -350,68 +353,14 @@ namespace Arche
 		// エンティティとその子供を再帰的に削除する
 		void DeleteEntityRecursively(World& world, Entity entity)
 		{
-			Registry& reg = world.getRegistry();
-			if (!reg.valid(entity)) return;
-
-			// 1. 親から自分を外す
-			if (reg.has<Relationship>(entity))
-			{
-				Entity parent = reg.get<Relationship>(entity).parent;
-				if (parent != NullEntity && reg.has<Relationship>(parent))
-				{
-					auto& siblings = reg.get<Relationship>(parent).children;
-					siblings.erase(std::remove(siblings.begin(), siblings.end(), entity), siblings.end());
-				}
-			}
-
-			// 2. 子供を再帰的に削除するヘルパー
-			auto recursiveDestroy = [&](auto&& self, Entity e) -> void
-			{
-				if(reg.has<Relationship>(e))
-				{
-					// コピーしてから回す
-					std::vector<Entity> children = reg.get<Relationship>(e).children;
-					for (Entity child : children)
-					{
-						self(self, child);
-					}
-				}
-
-				// 削除実行
-				reg.destroy(e);
-			};
-
-			recursiveDestroy(recursiveDestroy, entity);
+			// 親のリストからは破棄時に自動で外れる
+			Hierarchy::DestroyRecursive(world.getRegistry(), entity);
 		}
 
 		void SetParent(World& world, Entity child, Entity parent)
 		{
-			// 自分自身を親にはできない
-			if (child == parent) return;
-
-			// 1. 現在の親から離脱
-			if (world.getRegistry().has<Relationship>(child))
-			{
-				Entity oldParent = world.getRegistry().get<Relationship>(child).parent;
-				if (oldParent != NullEntity && world.getRegistry().has<Relationship>(oldParent))
-				{
-					auto& children = world.getRegistry().get<Relationship>(oldParent).children;
-					// 子リストから自分を削除
-					children.erase(std::remove(children.begin(), children.end(), child), children.end());
-				}
-			}
-
-			// 2. 新しい親に所属
-			// 子側の設定
-			if (!world.getRegistry().has<Relationship>(child)) world.getRegistry().emplace<Relationship>(child);
-			world.getRegistry().get<Relationship>(child).parent = parent;
-
-			// 親側の設定
-			if (parent != NullEntity)
-			{
-				if (!world.getRegistry().has<Relationship>(parent)) world.getRegistry().emplace<Relationship>(parent);
-				world.getRegistry().get<Relationship>(parent).children.push_back(child);
-			}
+			// 自分自身や子孫を親にはできない（Hierarchy 側で弾く）
+			Hierarchy::SetParent(world.getRegistry(), child, parent);
 		}
 
 		void DrawEntityNode(World& world, Entity e, std::vector<Entity>& selection)
@@ -437,10 +386,7 @@ namespace Arche
 			if (isSelected) flags |= ImGuiTreeNodeFlags_Selected;
 
 			// 子がいるかチェック
-			bool hasChildren = false;
-			if (world.getRegistry().has<Relationship>(e)) {
-				if (!world.getRegistry().get<Relationship>(e).children.empty()) hasChildren = true;
-			}
+			bool hasChildren = Hierarchy::GetChildCount(world.getRegistry(), e) > 0;
 			if (!hasChildren) flags |= ImGuiTreeNodeFlags_Leaf; // 子がなければリーフ
 
 			if (m_nodesToOpen.count(e))
@@ -523,20 +469,8 @@ namespace Arche
 						float bottomThreshold = 0.75f;
 
 						// 親情報を取得（並び替え用）
-						Entity parent = NullEntity;
-						int myIndex = 0;
-						if (reg.has<Relationship>(e))
-						{
-							parent = reg.get<Relationship>(e).parent;
-						}
-
-						// 親がいる場合のみインデックスを計算
-						if (parent != NullEntity)
-						{
-							auto& siblings = reg.get<Relationship>(parent).children;
-							auto it = std::find(siblings.begin(), siblings.end(), e);
-							if (it != siblings.end()) myIndex = (int)std::distance(siblings.begin(), it);
-						}
+						Entity parent = Hierarchy::GetParent(reg, e);
+						int myIndex = (std::max)(Hierarchy::GetChildIndex(reg, e), 0);
 
 						// 描画リスト
 						ImDrawList* drawList = ImGui::GetWindowDrawList();
@@ -674,8 +608,8 @@ namespace Arche
 			{
 				if (hasChildren)
 				{
-					auto children = reg.get<Relationship>(e).children;
-					for (Entity child : children)
+					// 描画中のドラッグ＆ドロップで繋ぎ替わるためコピーしてから回す
+					for (Entity child : Hierarchy::GetChildren(reg, e))
 					{
 						DrawEntityNode(world, child, selection);
 					}
@@ -18,6 +18,9 @@
 #include "Engine/pch.h"
 #include "Editor/Core/Editor.h"
 #include "Engine/Core/Time/Time.h"
+#include "Engine/Core/Profiler/Profiler.h"
+#include "Engine/Core/Profiler/FrameStats.h"
+#include "Engine/Core/Base/Logger.h"
 #include "Engine/Scene/Serializer/SystemRegistry.h"
 
 namespace Arche
@@ -43,6 +46,25 @@ namespace Arche
 			ImGui::Text("Active Systems: %d", (int)world.getSystems().size());
 			ImGui::SameLine();
 			ImGui::Text("| Total Logic Time: %.3f ms", totalTime);
+			ImGui::SameLine();
+			ImGui::Text("| Stages: %d", (int)world.getStages().size());
+			ImGui::SameLine();
+			ImGui::Text("| Entities: %d", (int)world.getRegistry().aliveCount());
+
+			// 実行頻度で間引いたシステム
+			int skipped = 0;
+			for (const auto& sys : world.getSystems())
+			{
+				if (sys->m_isEnabled && !sys->m_runPolicy.isEveryFrame() && !sys->m_didRun) ++skipped;
+			}
+			ImGui::SameLine();
+			ImGui::Text("| Skipped: %d", skipped);
+
+			// 固定ステップの設定と実行回数
+			DrawFixedStep(world);
+
+			// フレーム時間の分布とヒッチ
+			DrawFrameStats();
 
 			ImGui::Separator();
 
@@ -65,12 +87,17 @@ namespace Arche
 
 			// テーブル設定
 			ImGuiTableFlags flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Sortable;
-			if (ImGui::BeginTable("SystemsTable", 4, flags))
+			if (ImGui::BeginTable("SystemsTable", 9, flags))
 			{
 				ImGui::TableSetupColumn("En", ImGuiTableColumnFlags_WidthFixed, 30.0f);
 				ImGui::TableSetupColumn("System Name", ImGuiTableColumnFlags_WidthStretch);
 				ImGui::TableSetupColumn("Group", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+				ImGui::TableSetupColumn("Run", ImGuiTableColumnFlags_WidthFixed, 90.0f);
 				ImGui::TableSetupColumn("Time (ms)", ImGuiTableColumnFlags_WidthFixed, 120.0f);
+				ImGui::TableSetupColumn("p50", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+				ImGui::TableSetupColumn("p95", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+				ImGui::TableSetupColumn("p99", ImGuiTableColumnFlags_WidthFixed, 50.0f);
+				ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthFixed, 50.0f);
 				ImGui::TableHeadersRow();
 
 				// --- カテゴリ分け描画 ---
@@ -99,12 +126,22 @@ namespace Arche
 				ImGui::EndDragDropTarget();
 			}
 
+			// 下部: 区間計測のフレームグラフ
+			DrawProfiler();
+
+			// 下部: コンポーネントプールのメモリ
+			DrawMemoryStats(world);
+
 			ImGui::End();
 		}
 
 	private:
 		std::string m_systemToRemove;
 
+		// フレームグラフの表示設定
+		int m_flameFrameCount = 3;
+		float m_flameZoom = 1.0f;
+
 		bool IsEngineSystem(const std::string& name)
 		{
 			static const std::vector<std::string> engineSys = {
@@ -126,8 +163,10 @@ namespace Arche
 			ImGui::Text("");
 			ImGui::TableSetColumnIndex(1);
 			ImGui::TextColored(ImVec4(0.8f, 0.8f, 1.0f, 1.0f), "%s", categoryName);
-			ImGui::TableSetColumnIndex(2); ImGui::Text("");
-			ImGui::TableSetColumnIndex(3); ImGui::Text("");
+			for (int column = 2; column < ImGui::TableGetColumnCount(); ++column)
+			{
+				ImGui::TableSetColumnIndex(column); ImGui::Text("");
+			}
 
 			for (const auto& sys : world.getSystems())
 			{
@@ -174,6 +213,23 @@ namespace Arche
 					{
 						m_systemToRemove = sys->m_systemName;	// 削除予約
 					}
+					if (ImGui::BeginMenu("Group"))
+					{
+						static const std::pair<SystemGroup, const char*> groups[] = {
+							{ SystemGroup::Always, "Always" }, { SystemGroup::PlayOnly, "Play" }, { SystemGroup::FixedUpdate, "Fixed" },
+							{ SystemGroup::EditOnly, "Edit" }, { SystemGroup::Overlay, "Overlay" }
+						};
+						for (const auto& [group, name] : groups)
+						{
+							if (ImGui::MenuItem(name, nullptr, sys->m_group == group)) sys->m_group = group;
+						}
+						ImGui::EndMenu();
+					}
+					if (ImGui::BeginMenu("Run Policy"))
+					{
+						DrawRunPolicyEditor(*sys);
+						ImGui::EndMenu();
+					}
 					ImGui::EndPopup();
 				}
 
@@ -193,6 +249,10 @@ namespace Arche
 					gName = "Play";
 					gCol = ImVec4(0.6f, 1.0f, 0.6f, 1.0f); // 緑
 					break;
+				case SystemGroup::FixedUpdate:
+					gName = "Fixed";
+					gCol = ImVec4(0.6f, 1.0f, 0.9f, 1.0f); // 青緑（Play の中で固定間隔）
+					break;
 				case SystemGroup::EditOnly:
 					gName = "Edit";
 					gCol = ImVec4(1.0f, 0.8f, 0.6f, 1.0f); // オレンジ
@@ -209,8 +269,12 @@ namespace Arche
 
 				ImGui::TextColored(gCol, gName);
 
-				// 4. Time & Gauge
+				// 4. 実行頻度（このフレームで実行しなかった物は暗く）
 				ImGui::TableSetColumnIndex(3);
+				DrawRunPolicyLabel(*sys);
+
+				// 5. Time & Gauge
+				ImGui::TableSetColumnIndex(4);
 				float timeMs = (float)sys->m_lastExecutionTime;
 				float ratio = (totalFrameTime > 0.0f) ? (timeMs / totalFrameTime) : 0.0f;
 
@@ -225,10 +289,350 @@ namespace Arche
 				ImGui::ProgressBar(ratio, ImVec2(-1, 0), overlay);
 				ImGui::PopStyleColor();
 
+				// 6. 直近フレームの分布
+				if (const RollingHistogram* hist = FrameStats::FindSystem(sys->m_systemName))
+				{
+					const float values[] = { hist->Percentile(0.50f), hist->Percentile(0.95f), hist->Percentile(0.99f), hist->Max() };
+					for (int i = 0; i < 4; ++i)
+					{
+						ImGui::TableSetColumnIndex(5 + i);
+						ImGui::Text("%.2f", values[i]);
+					}
+				}
+
 				ImGui::PopID();
 			}
 		}
 
+		void DrawRunPolicyLabel(const ISystem& sys)
+		{
+			const SystemRunPolicy& policy = sys.m_runPolicy;
+
+			char text[32];
+			switch (policy.mode)
+			{
+			case SystemRunPolicy::Mode::EveryFrame:
+				ImGui::TextDisabled("Every");
+				return;
+			case SystemRunPolicy::Mode::EveryNFrames:
+				sprintf_s(text, "1/%u", policy.interval);
+				break;
+			case SystemRunPolicy::Mode::Rate:
+				sprintf_s(text, "%.1f Hz", policy.hz);
+				break;
+			case SystemRunPolicy::Mode::TimeSliced:
+				sprintf_s(text, "%.0fus %d%%", policy.budgetUs, (int)(sys.m_sliceProgress * 100.0f));
+				break;
+			}
+
+			const ImVec4 col = sys.m_didRun ? ImVec4(0.9f, 0.9f, 0.5f, 1.0f) : ImVec4(0.5f, 0.5f, 0.4f, 1.0f);
+			ImGui::TextColored(col, "%s", text);
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("Phase: %.2f\nSkipped since last run: %u\nElapsed at last run: %.1f ms\nSlice passes: %u",
+					policy.phase, sys.m_skippedFrames, sys.m_elapsedTime * 1000.0f, sys.m_slicePasses);
+			}
+		}
+
+		void DrawRunPolicyEditor(ISystem& sys)
+		{
+			SystemRunPolicy& policy = sys.m_runPolicy;
+			bool changed = false;
+
+			static const char* modes[] = { "Every Frame", "Every N Frames", "Rate (Hz)", "Time Sliced" };
+			int mode = (int)policy.mode;
+			ImGui::SetNextItemWidth(140.0f);
+			if (ImGui::Combo("Mode", &mode, modes, IM_ARRAYSIZE(modes)))
+			{
+				policy.mode = (SystemRunPolicy::Mode)mode;
+				changed = true;
+			}
+
+			ImGui::SetNextItemWidth(140.0f);
+			switch (policy.mode)
+			{
+			case SystemRunPolicy::Mode::EveryFrame:
+				break;
+			case SystemRunPolicy::Mode::EveryNFrames:
+			{
+				int interval = (int)policy.interval;
+				if (ImGui::DragInt("Interval", &interval, 0.1f, 1, 600))
+				{
+					policy.interval = (uint32_t)interval;
+					changed = true;
+				}
+				ImGui::SetNextItemWidth(140.0f);
+				changed |= ImGui::SliderFloat("Phase", &policy.phase, 0.0f, 1.0f);
+				break;
+			}
+			case SystemRunPolicy::Mode::Rate:
+				changed |= ImGui::DragFloat("Hz", &policy.hz, 0.5f, 0.1f, 240.0f, "%.1f");
+				ImGui::SetNextItemWidth(140.0f);
+				changed |= ImGui::SliderFloat("Phase", &policy.phase, 0.0f, 1.0f);
+				break;
+			case SystemRunPolicy::Mode::TimeSliced:
+				changed |= ImGui::DragFloat("Budget (us)", &policy.budgetUs, 10.0f, 1.0f, 100000.0f, "%.0f");
+				if (ImGui::IsItemHovered()) ImGui::SetTooltip("Only systems that walk their entities with SliceCursor are sliced");
+				break;
+			}
+
+			if (changed) sys.resetRunPolicy();
+		}
+
+		void DrawFixedStep(World& world)
+		{
+			int hz = (int)std::lround(1.0f / Time::FixedDeltaTime());
+			ImGui::SetNextItemWidth(80.0f);
+			if (ImGui::DragInt("Fixed Hz", &hz, 1.0f, 10, 240)) Time::SetFixedRate(hz);
+			ImGui::SameLine();
+			int maxSteps = Time::GetMaxFixedSteps();
+			ImGui::SetNextItemWidth(80.0f);
+			if (ImGui::SliderInt("Max Steps", &maxSteps, 1, 10)) Time::SetMaxFixedSteps(maxSteps);
+			if (ImGui::IsItemHovered()) ImGui::SetTooltip("Steps per frame (time beyond this is dropped)");
+			ImGui::SameLine();
+			ImGui::Text("| Steps (last frame): %d | Alpha: %.2f", world.getLastFixedStepCount(), Time::FixedAlpha());
+		}
+
+		void DrawFrameStats()
+		{
+			if (!ImGui::CollapsingHeader("Frame Time", ImGuiTreeNodeFlags_DefaultOpen)) return;
+
+			const RollingHistogram& frame = FrameStats::GetFrame();
+			ImGui::Text("Frame (last %d): p50 %.2f ms | p95 %.2f ms | p99 %.2f ms | max %.2f ms",
+				(int)frame.Count(), frame.Percentile(0.50f), frame.Percentile(0.95f), frame.Percentile(0.99f), frame.Max());
+
+			// 値のある区間だけ並べる
+			const auto& bins = frame.Bins();
+			int first = 0, last = -1;
+			for (int i = 0; i < RollingHistogram::BinCount; ++i)
+			{
+				if (bins[i] == 0) continue;
+				if (last < 0) first = i;
+				last = i;
+			}
+			if (last >= first)
+			{
+				float values[RollingHistogram::BinCount];
+				for (int i = first; i <= last; ++i) values[i - first] = (float)bins[i];
+
+				char overlay[64];
+				sprintf_s(overlay, "%.2f - %.2f ms", (first == 0) ? 0.0f : RollingHistogram::BinUpper(first - 1), RollingHistogram::BinUpper(last));
+				ImGui::PlotHistogram("##FrameHistogram", values, last - first + 1, 0, overlay, 0.0f, FLT_MAX, ImVec2(-1, 50.0f));
+			}
+
+			// ヒッチ設定
+			float threshold = FrameStats::GetHitchThreshold();
+			ImGui::SetNextItemWidth(100.0f);
+			if (ImGui::DragFloat("Hitch (ms)", &threshold, 0.5f, 0.0f, 1000.0f, "%.1f")) FrameStats::SetHitchThreshold(threshold);
+			if (ImGui::IsItemHovered()) ImGui::SetTooltip("0 = disabled");
+			ImGui::SameLine();
+			int captureFrames = FrameStats::GetHitchCaptureFrames();
+			ImGui::SetNextItemWidth(80.0f);
+			if (ImGui::SliderInt("Capture Frames", &captureFrames, 1, 30)) FrameStats::SetHitchCaptureFrames(captureFrames);
+			ImGui::SameLine();
+			int window = (int)FrameStats::GetWindowSize();
+			ImGui::SetNextItemWidth(80.0f);
+			if (ImGui::DragInt("Window", &window, 10.0f, 30, 3600)) FrameStats::SetWindowSize((std::size_t)window);
+			ImGui::SameLine();
+			if (ImGui::SmallButton("Reset Stats")) FrameStats::Reset();
+
+			ImGui::Text("Hitches: %d", (int)FrameStats::GetHitchCount());
+			if (!FrameStats::GetLastHitchPath().empty())
+			{
+				ImGui::SameLine();
+				ImGui::TextDisabled("| Last capture: %s", FrameStats::GetLastHitchPath().c_str());
+			}
+		}
+
+		void DrawProfiler()
+		{
+#if ARCHE_PROFILE_ENABLED
+			if (!ImGui::CollapsingHeader("Profiler")) return;
+
+			bool paused = Profiler::IsPaused();
+			if (ImGui::Checkbox("Pause", &paused)) Profiler::SetPaused(paused);
+			ImGui::SameLine();
+			ImGui::SetNextItemWidth(100.0f);
+			ImGui::SliderInt("Frames", &m_flameFrameCount, 1, 30);
+			ImGui::SameLine();
+			ImGui::SetNextItemWidth(100.0f);
+			ImGui::SliderFloat("Zoom", &m_flameZoom, 1.0f, 50.0f, "x%.1f", ImGuiSliderFlags_Logarithmic);
+			ImGui::SameLine();
+
+			auto frames = Profiler::GetRecentFrames(m_flameFrameCount);
+			if (ImGui::Button("Export Chrome Trace") && !frames.empty())
+			{
+				// 保持している全フレームを書き出す
+				std::string path = "Profiles/trace_frame" + std::to_string(frames.back()->index) + ".json";
+				if (Profiler::ExportChromeTrace(path, Profiler::GetHistorySize())) Logger::Log("Profiler: Exported " + path);
+				else Logger::LogError("Profiler: Failed to export " + path);
+			}
+
+			if (frames.empty())
+			{
+				ImGui::TextDisabled("No frames recorded.");
+				return;
+			}
+
+			// スレッドごとの行数（入れ子の最大深さ）
+			std::map<uint32_t, std::pair<std::string, uint32_t>> lanes;
+			for (const auto& frame : frames)
+			{
+				for (const auto& thread : frame->threads)
+				{
+					auto& lane = lanes[thread.id];
+					lane.first = thread.name;
+					for (const auto& e : thread.events) lane.second = std::max(lane.second, e.depth + 1);
+				}
+			}
+
+			const float rowH = ImGui::GetTextLineHeight() + 4.0f;
+			float contentH = rowH;	// フレーム見出し
+			for (const auto& [id, lane] : lanes) contentH += rowH * (lane.second + 1);
+
+			const float viewH = std::min(contentH + ImGui::GetStyle().ScrollbarSize + 8.0f, 320.0f);
+			ImGui::BeginChild("FlameView", ImVec2(0, viewH), true, ImGuiWindowFlags_HorizontalScrollbar);
+
+			const float width = ImGui::GetContentRegionAvail().x * m_flameZoom;
+			const ImVec2 origin = ImGui::GetCursorScreenPos();
+			ImDrawList* dl = ImGui::GetWindowDrawList();
+			const ImVec2 clipMin = dl->GetClipRectMin();
+			const ImVec2 clipMax = dl->GetClipRectMax();
+
+			const int64_t t0 = frames.front()->start;
+			const double span = (double)std::max<int64_t>(frames.back()->end - t0, 1);
+			auto toX = [&](int64_t t) { return origin.x + (float)((t - t0) / span) * width; };
+
+			// 1. フレームの区切り
+			for (const auto& frame : frames)
+			{
+				const float x = toX(frame->start);
+				dl->AddLine(ImVec2(x, origin.y), ImVec2(x, origin.y + contentH), IM_COL32(255, 255, 255, 60));
+
+				char label[64];
+				sprintf_s(label, "Frame %llu (%.2f ms)", (unsigned long long)frame->index, frame->DurationMs());
+				dl->AddText(ImVec2(x + 4.0f, origin.y + 2.0f), IM_COL32(200, 200, 200, 255), label);
+			}
+
+			// 2. スレッドごとの区間（深さごとに1行）
+			float laneY = origin.y + rowH;
+			for (const auto& [id, lane] : lanes)
+			{
+				dl->AddText(ImVec2(std::max(origin.x, clipMin.x) + 4.0f, laneY + 2.0f), IM_COL32(180, 200, 255, 255), lane.first.c_str());
+				const float barY = laneY + rowH;
+
+				for (const auto& frame : frames)
+				{
+					for (const auto& thread : frame->threads)
+					{
+						if (thread.id != id) continue;
+
+						for (const auto& e : thread.events)
+						{
+							float x0 = toX(e.start);
+							float x1 = std::max(toX(e.end), x0 + 1.0f);
+							if (x1 < clipMin.x || x0 > clipMax.x) continue;
+
+							const ImVec2 rMin(x0, barY + e.depth * rowH);
+							const ImVec2 rMax(x1, rMin.y + rowH - 1.0f);
+
+							// 名前ごとに固定の色
+							const char* name = e.name ? e.name : "?";
+							const float hue = (std::hash<std::string_view>{}(name) % 360) / 360.0f;
+							dl->AddRectFilled(rMin, rMax, ImColor::HSV(hue, 0.45f, 0.75f));
+
+							if (x1 - x0 > 24.0f)
+							{
+								dl->PushClipRect(ImVec2(std::max(rMin.x, clipMin.x), rMin.y), ImVec2(std::min(rMax.x, clipMax.x), rMax.y), true);
+								dl->AddText(ImVec2(std::max(rMin.x, clipMin.x) + 2.0f, rMin.y + 1.0f), IM_COL32(20, 20, 20, 255), name);
+								dl->PopClipRect();
+							}
+
+							if (ImGui::IsMouseHoveringRect(rMin, rMax))
+							{
+								ImGui::SetTooltip("%s\n%.3f ms\n%s / Frame %llu", name, (e.end - e.start) / 1000000.0, lane.first.c_str(), (unsigned long long)frame->index);
+							}
+						}
+					}
+				}
+				laneY = barY + rowH * lane.second;
+			}
+
+			ImGui::Dummy(ImVec2(width, contentH));
+			ImGui::EndChild();
+#endif // ARCHE_PROFILE_ENABLED
+		}
+
+		void DrawMemoryStats(World& world)
+		{
+			if (!ImGui::CollapsingHeader("Component Memory")) return;
+
+			Registry& reg = world.getRegistry();
+			RegistryStats stats = reg.stats();
+
+			ImGui::Text("Entities: %d / %d slots", (int)stats.aliveEntities, (int)stats.entitySlots);
+			ImGui::SameLine();
+			ImGui::Text("| Used: %.1f KB / Reserved: %.1f KB", stats.totalBytesUsed() / 1024.0f, stats.totalBytesReserved() / 1024.0f);
+			ImGui::SameLine();
+			if (ImGui::SmallButton("Trim"))
+			{
+				reg.trim();
+			}
+
+			// 予約量の多い順（膨らんだプールを上に出す）
+			std::sort(stats.pools.begin(), stats.pools.end(), [](const PoolStats& a, const PoolStats& b) {
+				return a.bytesReserved > b.bytesReserved;
+			});
+
+			ImGuiTableFlags flags = ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY;
+			if (ImGui::BeginTable("PoolsTable", 7, flags, ImVec2(0, 240.0f)))
+			{
+				ImGui::TableSetupColumn("Component", ImGuiTableColumnFlags_WidthStretch);
+				ImGui::TableSetupColumn("Count / Cap", ImGuiTableColumnFlags_WidthFixed, 100.0f);
+				ImGui::TableSetupColumn("Sparse", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+				ImGui::TableSetupColumn("Used KB", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+				ImGui::TableSetupColumn("Reserved KB", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+				ImGui::TableSetupColumn("Disabled", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+				ImGui::TableSetupColumn("Listeners", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+				ImGui::TableHeadersRow();
+
+				for (const PoolStats& pool : stats.pools)
+				{
+					ImGui::TableNextRow();
+
+					// "struct Arche::Transform" -> "Transform"
+					std::string name = pool.typeName;
+					for (const char* prefix : { "struct ", "class ", "Arche::" })
+					{
+						std::size_t pos;
+						while ((pos = name.find(prefix)) != std::string::npos) name.erase(pos, strlen(prefix));
+					}
+
+					// 使用量の半分以上が余っていれば強調する
+					const bool bloated = pool.bytesReserved > 4096 && pool.bytesUsed * 2 < pool.bytesReserved;
+
+					ImGui::TableSetColumnIndex(0);
+					if (bloated) ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "(!) %s", name.c_str());
+					else ImGui::Text("    %s", name.c_str());
+					ImGui::TableSetColumnIndex(1);
+					ImGui::Text("%d / %d", (int)pool.size, (int)pool.capacity);
+					ImGui::TableSetColumnIndex(2);
+					ImGui::Text("%d pg", (int)pool.sparsePages);
+					if (ImGui::IsItemHovered()) ImGui::SetTooltip("Index range: %d", (int)pool.sparseSize);
+					ImGui::TableSetColumnIndex(3);
+					ImGui::Text("%.1f", pool.bytesUsed / 1024.0f);
+					ImGui::TableSetColumnIndex(4);
+					ImGui::Text("%.1f", pool.bytesReserved / 1024.0f);
+					ImGui::TableSetColumnIndex(5);
+					ImGui::Text("%d", (int)pool.disabled);
+					ImGui::TableSetColumnIndex(6);
+					ImGui::Text("%d/%d/%d/%d", (int)pool.constructListeners, (int)pool.destroyListeners, (int)pool.updateListeners, (int)pool.enabledListeners);
+					if (ImGui::IsItemHovered()) ImGui::SetTooltip("Construct / Destroy / Update / Enabled");
+				}
+				ImGui::EndTable();
+			}
+		}
+
 		void DrawAddSystemPopup(World& world)
 		{
 			if (ImGui::BeginPopup("AddSystemPopup"))
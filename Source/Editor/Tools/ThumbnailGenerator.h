@@ -16,6 +16,7 @@
 #include "Engine/Core/Graphics/Graphics.h"
 #include "Engine/Resource/ResourceManager.h"
 #include "Engine/Scene/Components/Components.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 #include "Engine/Renderer/Renderers/ModelRenderer.h"
 #include "Engine/Renderer/Renderers/SpriteRenderer.h"
 #include "Engine/Scene/Serializer/SceneSerializer.h"
@@ -287,12 +288,9 @@ namespace Arche
 				XMStoreFloat4x4(&t.worldMatrix, worldMat);
 			}
 
-			if (reg.has<Relationship>(entity))
+			for (Entity child : Hierarchy::Children(reg, entity))
 			{
-				for (auto child : reg.get<Relationship>(entity).children)
-				{
-					UpdateTransforms(reg, child, worldMat);
-				}
+				UpdateTransforms(reg, child, worldMat);
 			}
 		}
 
@@ -334,12 +332,9 @@ namespace Arche
 			}
 
 			// 子要素へ
-			if (reg.has<Relationship>(entity))
+			for (Entity child : Hierarchy::Children(reg, entity))
 			{
-				for (auto child : reg.get<Relationship>(entity).children)
-				{
-					CalculateHierarchyAABB(reg, child, outBounds);
-				}
+				CalculateHierarchyAABB(reg, child, outBounds);
 			}
 		}
 
@@ -358,12 +353,9 @@ namespace Arche
 				}
 			}
 
-			if (reg.has<Relationship>(entity))
+			for (Entity child : Hierarchy::Children(reg, entity))
 			{
-				for (auto child : reg.get<Relationship>(entity).children)
-				{
-					DrawHierarchy(reg, child);
-				}
+				DrawHierarchy(reg, child);
 			}
 		}
 
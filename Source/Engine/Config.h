@@ -30,6 +30,10 @@ namespace Arche
 		// VSync
 		static const bool VSYNC_ENABLED = false;		// 垂直同期（true: 60fps固定、false: 無制限）
 
+		// 固定ステップ（SystemGroup::FixedUpdate の実行頻度 / 描画のフレームレートとは独立）
+		static const unsigned int FIXED_UPDATE_RATE = 60;	// Hz
+		static const int MAX_FIXED_STEPS = 5;				// 1フレームで実行する上限（超えた分の時間は捨てる）
+
 	}	// namespace Config
 
 }	// namespace Arche
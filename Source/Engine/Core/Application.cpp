@@ -17,9 +17,13 @@
 #include "Engine/Resource/PrefabManager.h"
 #include "Engine/Audio/AudioManager.h"
 #include "Engine/Core/Base/Logger.h"
+#include "Engine/Core/Job/JobSystem.h"
+#include "Engine/Core/Profiler/Profiler.h"
+#include "Engine/Core/Profiler/FrameStats.h"
 #include "Engine/Scene/Serializer/SceneSerializer.h"
 #include "Engine/Scene/Serializer/SystemRegistry.h"
 #include "Engine/Scene/Serializer/ComponentRegistry.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 
 // Renderer（静的初期化用）
 #include "Engine/Renderer/Renderers/PrimitiveRenderer.h"
@@ -28,6 +32,7 @@
 #include "Engine/Renderer/Renderers/BillboardRenderer.h"
 #include "Engine/Renderer/Renderers/ShadowRenderer.h"
 #include "Engine/Renderer/Text/TextRenderer.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 #include "Engine/Core/Graphics/Graphics.h"
 
 #include "Engine/EngineLoader.h"
@@ -78,15 +83,7 @@ namespace Arche
 		// --- サブシステム初期化 ---
 		// シーンマネージャー
 		new SceneManager();
-		SceneManager::Instance().GetWorld().getRegistry().SetParentLookup([&](Entity e) -> Entity
-		{
-			auto& reg = SceneManager::Instance().GetWorld().getRegistry();
-			if (reg.has<Relationship>(e))
-			{
-				return reg.get<Relationship>(e).parent;
-			}
-			return NullEntity;
-		});
+		Hierarchy::Install(SceneManager::Instance().GetWorld().getRegistry());
 
 		// 入力
 		Input::Initialize();
@@ -99,14 +96,24 @@ namespace Arche
 		// FPS制御
 		Time::Initialize();
 		Time::SetFrameRate(Config::FRAME_RATE);
+		Time::SetFixedRate(Config::FIXED_UPDATE_RATE);
+		Time::SetMaxFixedSteps(Config::MAX_FIXED_STEPS);
+		// プロファイラ（メインスレッドの表示名 / ワーカーより先に登録して先頭の行にする）
+		ARCHE_PROFILE_THREAD("Main");
+		// ジョブシステム（par_each 用のワーカースレッド）
+		JobSystem::Initialize();
+
+		// 描画コマンドの発行先（ウィンドウありは D3D11 にそのまま流す）
+		RenderBackend::Initialize(m_device.Get(), std::make_unique<D3D11RenderBackend>(m_context.Get()));
+		IRenderBackend* backend = &RenderBackend::Get();
 
 		// レンダラー静的初期化
-		PrimitiveRenderer::Initialize(m_device.Get(), m_context.Get());
-		SpriteRenderer::Initialize(m_device.Get(), m_context.Get(), m_width, m_height);
-		ModelRenderer::Initialize(m_device.Get(), m_context.Get());
-		BillboardRenderer::Initialize(m_device.Get(), m_context.Get());
-		ShadowRenderer::Initialize(m_device.Get(), m_context.Get());
-		TextRenderer::Initialize(m_device.Get(), m_context.Get());
+		PrimitiveRenderer::Initialize(m_device.Get(), backend);
+		SpriteRenderer::Initialize(m_device.Get(), backend, m_width, m_height);
+		ModelRenderer::Initialize(m_device.Get(), backend);
+		BillboardRenderer::Initialize(m_device.Get(), backend);
+		ShadowRenderer::Initialize(m_device.Get(), backend);
+		TextRenderer::Initialize(m_device.Get(), backend);
 		Graphics::Initialize(m_device.Get(), m_context.Get(), m_swapChain.Get());
 
 #ifdef _DEBUG
@@ -253,6 +260,15 @@ namespace Arche
 		SceneManager* sm = &SceneManager::Instance();
 		if (sm) delete sm;
 
+		// 描画コマンドの発行先（シーン破棄後に外す）
+		RenderBackend::Shutdown();
+
+		// シーン破棄後にワーカーを停止
+		JobSystem::Shutdown();
+
+		// 計測記録の破棄（ホットリロードで Sandbox の文字列が無効になるため）
+		Profiler::Clear();
+
 		// ウィンドウ破棄
 		if (m_hwnd)
 		{
@@ -348,6 +364,11 @@ namespace Arche
 			}
 			else
 			{
+				// 0. 計測フレームの区切り（前のフレームの時間を集計）
+				ARCHE_PROFILE_FRAME();
+				FrameStats::Update(SceneManager::Instance().GetWorld());
+				RenderBackend::BeginFrame();
+
 				// 1. 更新処理
 				Update();
 
@@ -355,7 +376,10 @@ namespace Arche
 				Render();
 
 				// 3. フレームレート調整
-				Time::WaitFrame();
+				{
+					ARCHE_PROFILE_SCOPE("Time::WaitFrame");
+					Time::WaitFrame();
+				}
 			}
 		}
 	}
@@ -404,6 +428,8 @@ namespace Arche
 
 	void Application::Update()
 	{
+		ARCHE_PROFILE_FUNCTION();
+
 		// FPS制御
 		Time::Update();
 		// 入力
@@ -442,6 +468,7 @@ namespace Arche
 	// ======================================================================
 	void Application::Render()
 	{
+		ARCHE_PROFILE_FUNCTION();
 		if (!m_renderTargetView) return;
 
 #ifdef _DEBUG
@@ -461,8 +488,8 @@ namespace Arche
 				clearColor[3] = 1.0f;
 			}
 
-			m_sceneRT->Clear(m_context.Get(), clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
-			m_sceneRT->Bind(m_context.Get());
+			m_sceneRT->Clear(&RenderBackend::Get(), clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+			m_sceneRT->Bind(&RenderBackend::Get());
 
 			// デバッグカメラ情報をContextにセット
 			Context& ctx = SceneManager::Instance().GetContext();
@@ -495,8 +522,8 @@ namespace Arche
 		// ----------------------------------------------------
 		if (m_gameRT)
 		{
-			m_gameRT->Clear(m_context.Get(), 0.0f, 0.0f, 0.0f, 1.0f);	// 黒背景
-			m_gameRT->Bind(m_context.Get());
+			m_gameRT->Clear(&RenderBackend::Get(), 0.0f, 0.0f, 0.0f, 1.0f);	// 黒背景
+			m_gameRT->Bind(&RenderBackend::Get());
 
 			// ゲームビュー用にContextのデバッグ設定を一時的にOFFにする
 			Context& ctx = SceneManager::Instance().GetContext();
@@ -531,7 +558,10 @@ namespace Arche
 		
 		// エディタUI構築 & 描画
 		Context& ctx = SceneManager::Instance().GetContext();
-		Editor::Instance().Draw(SceneManager::Instance().GetWorld(), ctx);
+		{
+			ARCHE_PROFILE_SCOPE("Editor::Draw");
+			Editor::Instance().Draw(SceneManager::Instance().GetWorld(), ctx);
+		}
 		ImGui::Render();
 		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
 
@@ -558,6 +588,7 @@ namespace Arche
 #endif // _DEBUG
 
 		// フリップ
+		ARCHE_PROFILE_SCOPE("Present");
 		m_swapChain->Present(Config::VSYNC_ENABLED ? 1 : 0, 0);
 	}
 
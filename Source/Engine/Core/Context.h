@@ -23,17 +23,10 @@
 // ===== インクルード =====
 #include "Engine/pch.h"
 #include "Engine/Scene/SceneEnvironment.h"
+#include "Engine/Core/EditorState.h"
 
 namespace Arche
 {
-	// エディタの状態
-	enum class EditorState
-	{
-		Edit,	// 編集モード（物理停止、ギズモ有効）
-		Play,	// 実行モード（物理稼働）
-		Pause	// 一時停止
-	};
-
 	// レンダリング用のカメラ情報（追加）
 	struct RenderCamera
 	{
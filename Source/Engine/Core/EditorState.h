@@ -0,0 +1,28 @@
+﻿/*****************************************************************//**
+ * @file	EditorState.h
+ * @brief	エディタの状態
+ *
+ * @details
+ * World がシステムの実行可否を決めるのに使うため、Context から分けて依存の無いヘッダーに置く。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___EDITOR_STATE_H___
+#define ___EDITOR_STATE_H___
+
+namespace Arche
+{
+	// エディタの状態
+	enum class EditorState
+	{
+		Edit,	// 編集モード（物理停止、ギズモ有効）
+		Play,	// 実行モード（物理稼働）
+		Pause	// 一時停止
+	};
+
+}	// namespace Arche
+
+#endif // !___EDITOR_STATE_H___
@@ -0,0 +1,271 @@
+﻿/*****************************************************************//**
+ * @file	JobSystem.cpp
+ * @brief	ワークスティーリング方式のジョブシステム
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#ifdef ARCHE_ECS_STANDALONE
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#else
+#include "Engine/pch.h"
+#include <condition_variable>
+#include "Engine/Core/Profiler/Profiler.h"
+#endif // ARCHE_ECS_STANDALONE
+#include "Engine/Core/Job/JobSystem.h"
+
+namespace Arche
+{
+	namespace
+	{
+		struct QueuedJob
+		{
+			JobSystem::Job job;
+			JobCounter* counter = nullptr;
+		};
+
+		// ワーカーごとのキュー（所有者は末尾から、盗む側は先頭から取り出す）
+		struct WorkQueue
+		{
+			std::mutex mutex;
+			std::deque<QueuedJob> jobs;
+
+			void Push(QueuedJob&& job)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				jobs.push_back(std::move(job));
+			}
+
+			bool Pop(QueuedJob& out)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (jobs.empty()) return false;
+				out = std::move(jobs.back());
+				jobs.pop_back();
+				return true;
+			}
+
+			bool Steal(QueuedJob& out)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (jobs.empty()) return false;
+				out = std::move(jobs.front());
+				jobs.pop_front();
+				return true;
+			}
+		};
+
+		// 共有状態
+		// ※ キューは ワーカー数 + 1 個（最後の1個はワーカー以外のスレッドからの投入用）
+		std::vector<std::unique_ptr<WorkQueue>> s_queues;
+		std::vector<std::thread> s_workers;
+		std::atomic<std::size_t> s_queuedCount{ 0 };
+		std::atomic<bool> s_running{ false };
+		std::mutex s_sleepMutex;
+		std::condition_variable s_sleepCv;
+
+		// 現在のスレッドのキュー番号（ワーカー以外は -1）
+		thread_local int t_workerIndex = -1;
+		// 現在のスレッドがジョブ（ParallelFor の塊を含む）を実行中の深さ
+		thread_local int t_jobDepth = 0;
+
+		// ジョブ実行中の印（スコープ）
+		struct JobScope
+		{
+			JobScope() { ++t_jobDepth; }
+			~JobScope() { --t_jobDepth; }
+		};
+
+		std::size_t OwnQueueIndex()
+		{
+			return (t_workerIndex >= 0) ? (std::size_t)t_workerIndex : s_queues.size() - 1;
+		}
+
+		// 自分のキュー -> 他のキュー の順に1つ取り出す
+		bool TryGetJob(QueuedJob& out)
+		{
+			const std::size_t own = OwnQueueIndex();
+			if (s_queues[own]->Pop(out)) return true;
+
+			const std::size_t count = s_queues.size();
+			for (std::size_t i = 1; i < count; ++i)
+			{
+				if (s_queues[(own + i) % count]->Steal(out)) return true;
+			}
+			return false;
+		}
+
+		void Execute(QueuedJob& job)
+		{
+			s_queuedCount.fetch_sub(1, std::memory_order_acq_rel);
+			{
+				JobScope scope;
+				job.job();
+			}
+			job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+		}
+
+		void WorkerLoop(int index)
+		{
+			t_workerIndex = index;
+#ifndef ARCHE_ECS_STANDALONE
+			ARCHE_PROFILE_THREAD("Worker " + std::to_string(index));
+#endif // !ARCHE_ECS_STANDALONE
+
+			while (true)
+			{
+				QueuedJob job;
+				if (TryGetJob(job))
+				{
+					Execute(job);
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(s_sleepMutex);
+				s_sleepCv.wait(lock, [] {
+					return !s_running.load(std::memory_order_acquire) || s_queuedCount.load(std::memory_order_acquire) > 0;
+				});
+				if (!s_running.load(std::memory_order_acquire) && s_queuedCount.load(std::memory_order_acquire) == 0) break;
+			}
+
+			t_workerIndex = -1;
+		}
+	}
+
+	void JobSystem::Initialize(std::size_t workerCount)
+	{
+		if (s_running.load()) return;
+
+		if (workerCount == 0)
+		{
+			const unsigned int cores = std::thread::hardware_concurrency();
+			workerCount = (cores > 1) ? cores - 1 : 1;
+		}
+
+		s_queues.clear();
+		for (std::size_t i = 0; i < workerCount + 1; ++i)
+		{
+			s_queues.push_back(std::make_unique<WorkQueue>());
+		}
+
+		s_running.store(true);
+		for (std::size_t i = 0; i < workerCount; ++i)
+		{
+			s_workers.emplace_back(WorkerLoop, (int)i);
+		}
+	}
+
+	void JobSystem::Shutdown()
+	{
+		if (!s_running.load()) return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_sleepMutex);
+			s_running.store(false);
+		}
+		s_sleepCv.notify_all();
+
+		for (auto& worker : s_workers)
+		{
+			if (worker.joinable()) worker.join();
+		}
+		s_workers.clear();
+		s_queues.clear();
+	}
+
+	std::size_t JobSystem::GetWorkerCount()
+	{
+		return s_workers.size();
+	}
+
+	bool JobSystem::IsWorkerThread()
+	{
+		return t_workerIndex >= 0;
+	}
+
+	bool JobSystem::IsInsideJob()
+	{
+		return t_jobDepth > 0;
+	}
+
+	void JobSystem::Run(Job job, JobCounter& counter)
+	{
+		counter.pending.fetch_add(1, std::memory_order_acq_rel);
+
+		// 未初期化ならその場で実行
+		if (!s_running.load(std::memory_order_acquire))
+		{
+			JobScope scope;
+			job();
+			counter.pending.fetch_sub(1, std::memory_order_acq_rel);
+			return;
+		}
+
+		s_queues[OwnQueueIndex()]->Push(QueuedJob{ std::move(job), &counter });
+		{
+			std::lock_guard<std::mutex> lock(s_sleepMutex);
+			s_queuedCount.fetch_add(1, std::memory_order_acq_rel);
+		}
+		s_sleepCv.notify_one();
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			QueuedJob job;
+			if (s_running.load(std::memory_order_acquire) && TryGetJob(job))
+			{
+				Execute(job);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::ParallelFor(std::size_t count, std::size_t grain, const RangeFunc& func)
+	{
+		if (count == 0) return;
+		if (grain == 0) grain = 1;
+
+		// ワーカーが居ない / 分割するほどの量が無い場合はそのまま実行
+		const std::size_t workers = GetWorkerCount();
+		if (workers == 0 || count <= grain)
+		{
+			JobScope scope;
+			func(0, count);
+			return;
+		}
+
+		// 盗み合いで偏りを均せるよう、スレッド数の数倍程度に分割する
+		const std::size_t maxChunks = (workers + 1) * 4;
+		const std::size_t chunks = std::min((count + grain - 1) / grain, maxChunks);
+		const std::size_t chunkSize = (count + chunks - 1) / chunks;
+
+		JobCounter counter;
+		for (std::size_t begin = chunkSize; begin < count; begin += chunkSize)
+		{
+			const std::size_t end = std::min(begin + chunkSize, count);
+			Run([&func, begin, end]() { func(begin, end); }, counter);
+		}
+
+		// 先頭の塊は呼び出しスレッドが担当し、残りは待ちながら手伝う
+		{
+			JobScope scope;
+			func(0, std::min(chunkSize, count));
+		}
+		Wait(counter);
+	}
+
+}	// namespace Arche
@@ -0,0 +1,76 @@
+﻿/*****************************************************************//**
+ * @file	JobSystem.h
+ * @brief	ワークスティーリング方式のジョブシステム
+ *
+ * @details
+ * ワーカースレッドごとにジョブキューを持ち、自分のキューが空になったら
+ * 他のワーカーのキューの先頭からジョブを盗んで実行する。
+ * 完了待ち（Wait）をしているスレッドも待っている間はジョブを実行する。
+ *
+ * 主な用途は ParallelFor による配列の分割処理（View / Query / Group の par_each）。
+ * Initialize() されていない場合は呼び出しスレッドでそのまま実行する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___JOB_SYSTEM_H___
+#define ___JOB_SYSTEM_H___
+
+// ===== インクルード =====
+#ifdef ARCHE_ECS_STANDALONE
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#ifndef ARCHE_API
+#define ARCHE_API
+#endif // !ARCHE_API
+#else
+#include "Engine/pch.h"
+#endif // ARCHE_ECS_STANDALONE
+
+namespace Arche
+{
+	// ジョブの完了待ちカウンタ（Run で加算、ジョブ完了で減算）
+	struct JobCounter
+	{
+		std::atomic<std::size_t> pending{ 0 };
+
+		bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+	};
+
+	class ARCHE_API JobSystem
+	{
+	public:
+		using Job = std::function<void()>;
+		using RangeFunc = std::function<void(std::size_t begin, std::size_t end)>;
+
+		// 初期化（workerCount = 0 なら 論理コア数 - 1）
+		static void Initialize(std::size_t workerCount = 0);
+
+		// 終了（全ワーカーを停止して合流する）
+		static void Shutdown();
+
+		// ワーカースレッド数（未初期化なら 0）
+		static std::size_t GetWorkerCount();
+
+		// 現在のスレッドがワーカーか
+		static bool IsWorkerThread();
+
+		// 現在のスレッドがジョブを実行中か（呼び出しスレッドが担当する ParallelFor の塊も含む）
+		static bool IsInsideJob();
+
+		// ジョブの投入（counter は完了時に減算される）
+		static void Run(Job job, JobCounter& counter);
+
+		// counter が 0 になるまで待つ（待っている間は他のジョブを実行する）
+		static void Wait(JobCounter& counter);
+
+		// [0, count) を grain 個以上の塊に分けて並列実行し、全て終わるまで待つ
+		static void ParallelFor(std::size_t count, std::size_t grain, const RangeFunc& func);
+	};
+
+}	// namespace Arche
+
+#endif // !___JOB_SYSTEM_H___
@@ -0,0 +1,168 @@
+﻿// ===== インクルード =====
+#include "Engine/pch.h"
+#include "FrameStats.h"
+#include "Engine/Core/Profiler/Profiler.h"
+#include "Engine/Core/Base/Logger.h"
+
+namespace Arche
+{
+	// ======================================================================
+	// FrameStats
+	// ======================================================================
+	namespace
+	{
+		struct State
+		{
+			std::size_t window = 300;
+			RollingHistogram frame{ 300 };
+			std::map<std::string, RollingHistogram> systems;
+
+			std::chrono::steady_clock::time_point lastFrame;
+			bool hasLastFrame = false;
+
+			float hitchThresholdMs = 50.0f;
+			int hitchCaptureFrames = 5;
+			uint32_t hitchCount = 0;
+			std::string lastHitchPath;
+			std::chrono::steady_clock::time_point lastReport;
+			bool hasReported = false;
+			bool skipNext = false;
+		};
+
+		State& GetState()
+		{
+			static State state;
+			return state;
+		}
+
+		// 書き出しが続けてヒッチを起こさないよう、次の報告まで空ける時間
+		constexpr std::chrono::seconds HitchReportCooldown{ 2 };
+	}
+
+	void FrameStats::Update(World& world)
+	{
+		State& s = GetState();
+		const auto now = std::chrono::steady_clock::now();
+
+		if (!s.hasLastFrame || s.skipNext)
+		{
+			// 初回と、ヒッチを書き出した直後のフレーム（書き出しの時間を含む）は数えない
+			s.lastFrame = now;
+			s.hasLastFrame = true;
+			s.skipNext = false;
+			return;
+		}
+
+		const float frameMs = std::chrono::duration<float, std::milli>(now - s.lastFrame).count();
+		s.lastFrame = now;
+		s.frame.Add(frameMs);
+
+		// 前のフレームで実行したシステム（Update + Render の合計）
+		for (const auto& sys : world.getSystems())
+		{
+			if (!sys->m_isEnabled || sys->m_lastExecutionTime <= 0.0) continue;
+
+			auto it = s.systems.find(sys->m_systemName);
+			if (it == s.systems.end()) it = s.systems.emplace(sys->m_systemName, RollingHistogram(s.window)).first;
+			it->second.Add((float)sys->m_lastExecutionTime);
+		}
+
+		// ヒッチ
+		if (s.hitchThresholdMs <= 0.0f || frameMs < s.hitchThresholdMs) return;
+
+		++s.hitchCount;
+		if (s.hasReported && now - s.lastReport < HitchReportCooldown) return;
+		s.hasReported = true;
+		s.lastReport = now;
+
+		char message[64];
+		snprintf(message, sizeof(message), "Hitch: %.2f ms", frameMs);
+
+		// 直前に締めたフレーム（ヒッチしたフレーム）までを書き出す
+		// ※ Profiler が無効なビルドでは記録が無いので、回数とログだけ残す
+		auto frames = Profiler::GetRecentFrames((std::size_t)s.hitchCaptureFrames);
+		if (!frames.empty())
+		{
+			std::string path = "Profiles/hitch_frame" + std::to_string(frames.back()->index) + ".json";
+			if (Profiler::ExportChromeTrace(path, frames))
+			{
+				s.lastHitchPath = path;
+				s.skipNext = true;
+				Logger::LogWarning(std::string(message) + " -> " + path);
+				return;
+			}
+		}
+		Logger::LogWarning(message);
+	}
+
+	const RollingHistogram& FrameStats::GetFrame()
+	{
+		return GetState().frame;
+	}
+
+	const std::map<std::string, RollingHistogram>& FrameStats::GetSystems()
+	{
+		return GetState().systems;
+	}
+
+	const RollingHistogram* FrameStats::FindSystem(const std::string& name)
+	{
+		const auto& systems = GetState().systems;
+		auto it = systems.find(name);
+		return (it != systems.end()) ? &it->second : nullptr;
+	}
+
+	void FrameStats::SetWindowSize(std::size_t frames)
+	{
+		State& s = GetState();
+		s.window = std::max<std::size_t>(frames, 1);
+		s.frame.SetWindow(s.window);
+		for (auto& [name, hist] : s.systems) hist.SetWindow(s.window);
+	}
+
+	std::size_t FrameStats::GetWindowSize()
+	{
+		return GetState().window;
+	}
+
+	void FrameStats::SetHitchThreshold(float ms)
+	{
+		GetState().hitchThresholdMs = ms;
+	}
+
+	float FrameStats::GetHitchThreshold()
+	{
+		return GetState().hitchThresholdMs;
+	}
+
+	void FrameStats::SetHitchCaptureFrames(int frames)
+	{
+		GetState().hitchCaptureFrames = std::max(frames, 1);
+	}
+
+	int FrameStats::GetHitchCaptureFrames()
+	{
+		return GetState().hitchCaptureFrames;
+	}
+
+	uint32_t FrameStats::GetHitchCount()
+	{
+		return GetState().hitchCount;
+	}
+
+	const std::string& FrameStats::GetLastHitchPath()
+	{
+		return GetState().lastHitchPath;
+	}
+
+	void FrameStats::Reset()
+	{
+		State& s = GetState();
+		s.frame.Clear();
+		s.systems.clear();
+		s.hitchCount = 0;
+		s.hasLastFrame = false;
+		s.hasReported = false;
+	}
+
+}	// namespace Arche
@@ -0,0 +1,55 @@
+﻿/*****************************************************************//**
+ * @file	FrameStats.h
+ * @brief	フレーム時間の分布（p50 / p95 / p99 / max）とヒッチの記録
+ *
+ * @details
+ * 直近のフレーム時間とシステムごとの処理時間をヒストグラムに積み、パーセンタイルを出す。
+ * 閾値を超えたフレーム（ヒッチ）が出た時は、Profiler の直近フレームをファイルに書き出す。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___FRAME_STATS_H___
+#define ___FRAME_STATS_H___
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Core/Profiler/RollingHistogram.h"
+
+namespace Arche
+{
+	class ARCHE_API FrameStats
+	{
+	public:
+		// 毎フレームの先頭で呼ぶ（前のフレームの時間と、各システムの処理時間を積む）
+		static void Update(World& world);
+
+		// フレーム全体 / システムごと（名前順）
+		static const RollingHistogram& GetFrame();
+		static const std::map<std::string, RollingHistogram>& GetSystems();
+		static const RollingHistogram* FindSystem(const std::string& name);
+
+		// 集計するフレーム数
+		static void SetWindowSize(std::size_t frames);
+		static std::size_t GetWindowSize();
+
+		// ヒッチ判定の閾値（ms / 0 以下で無効）
+		static void SetHitchThreshold(float ms);
+		static float GetHitchThreshold();
+
+		// ヒッチ時に書き出すフレーム数（ヒッチしたフレームを含む直近）
+		static void SetHitchCaptureFrames(int frames);
+		static int GetHitchCaptureFrames();
+
+		static uint32_t GetHitchCount();
+		static const std::string& GetLastHitchPath();
+
+		static void Reset();
+	};
+
+}	// namespace Arche
+
+#endif // !___FRAME_STATS_H___
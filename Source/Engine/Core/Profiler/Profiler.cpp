@@ -0,0 +1,285 @@
+﻿// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Profiler.h"
+#include <unordered_set>
+
+namespace Arche
+{
+	namespace
+	{
+		// スレッドごとの記録先（書き込みは所有スレッドのみ、読み出しは BeginFrame のみ）
+		struct ThreadBuffer
+		{
+			static constexpr std::size_t Capacity = 1 << 13;	// 2の累乗
+			static constexpr std::size_t Mask = Capacity - 1;
+
+			std::vector<ProfileEvent> slots = std::vector<ProfileEvent>(Capacity);
+			std::atomic<uint64_t> written{ 0 };	// 書き込んだ総数
+			uint64_t read = 0;					// 読み出し済みの総数（State::mutex で保護）
+			uint32_t id = 0;
+			std::string name;					// State::mutex で保護
+			bool released = false;				// 所有スレッドが終了した（State::mutex で保護）
+		};
+
+		struct State
+		{
+			std::mutex mutex;
+			std::vector<std::unique_ptr<ThreadBuffer>> buffers;	// スレッド終了後も残し、次に作られたスレッドで使い回す
+			std::deque<std::shared_ptr<const ProfileFrame>> history;
+			std::size_t historySize = 120;
+			uint64_t frameIndex = 0;
+			int64_t frameStart = 0;
+			bool paused = false;
+
+			std::mutex internMutex;
+			std::unordered_set<std::string> interned;
+		};
+
+		State& GetState()
+		{
+			static State state;
+			return state;
+		}
+
+		// スレッド終了時にバッファを手放す（JobSystem の再起動でバッファが増え続けないように）
+		struct BufferOwner
+		{
+			ThreadBuffer* buffer = nullptr;
+
+			~BufferOwner()
+			{
+				if (!buffer) return;
+				std::lock_guard<std::mutex> lock(GetState().mutex);
+				buffer->released = true;
+			}
+		};
+
+		thread_local BufferOwner t_owner;
+		thread_local uint32_t t_depth = 0;
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (!t_owner.buffer)
+			{
+				State& s = GetState();
+				std::lock_guard<std::mutex> lock(s.mutex);
+
+				// 未読の記録は残したまま、書き込み位置の続きから使う
+				for (auto& buffer : s.buffers)
+				{
+					if (!buffer->released) continue;
+					buffer->released = false;
+					buffer->name = "Thread " + std::to_string(buffer->id);
+					t_owner.buffer = buffer.get();
+					return *t_owner.buffer;
+				}
+
+				auto buffer = std::make_unique<ThreadBuffer>();
+				buffer->id = (uint32_t)s.buffers.size();
+				buffer->name = "Thread " + std::to_string(buffer->id);
+				t_owner.buffer = buffer.get();
+				s.buffers.push_back(std::move(buffer));
+			}
+			return *t_owner.buffer;
+		}
+
+		// 未読の記録を取り出す（State::mutex を取った状態で呼ぶ）
+		void Drain(ThreadBuffer& buffer, std::vector<ProfileEvent>& out)
+		{
+			const uint64_t end = buffer.written.load(std::memory_order_acquire);
+			uint64_t begin = buffer.read;
+
+			// 1フレームで一周した分は古い方から捨てる
+			if (end - begin > ThreadBuffer::Capacity) begin = end - ThreadBuffer::Capacity;
+
+			out.reserve(out.size() + (std::size_t)(end - begin));
+			const std::size_t first = out.size();
+			for (uint64_t i = begin; i < end; ++i)
+			{
+				out.push_back(buffer.slots[i & ThreadBuffer::Mask]);
+			}
+
+			// コピー中に書き込み側が追い越した分は壊れている可能性があるので捨てる
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const uint64_t after = buffer.written.load(std::memory_order_relaxed);
+			if (after > ThreadBuffer::Capacity && after - ThreadBuffer::Capacity > begin)
+			{
+				const std::size_t overwritten = (std::size_t)std::min<uint64_t>(after - ThreadBuffer::Capacity - begin, end - begin);
+				out.erase(out.begin() + first, out.begin() + first + overwritten);
+			}
+
+			buffer.read = end;
+		}
+	}
+
+	void Profiler::BeginFrame()
+	{
+		const int64_t now = Now();
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.mutex);
+
+		if (s.frameStart != 0)
+		{
+			auto frame = std::make_shared<ProfileFrame>();
+			frame->index = s.frameIndex++;
+			frame->start = s.frameStart;
+			frame->end = now;
+
+			for (auto& buffer : s.buffers)
+			{
+				ProfileThread thread;
+				thread.id = buffer->id;
+				thread.name = buffer->name;
+				Drain(*buffer, thread.events);
+				if (!thread.events.empty()) frame->threads.push_back(std::move(thread));
+			}
+
+			if (!s.paused)
+			{
+				s.history.push_back(std::move(frame));
+				while (s.history.size() > s.historySize) s.history.pop_front();
+			}
+		}
+		s.frameStart = now;
+	}
+
+	void Profiler::SetThreadName(const std::string& name)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(GetState().mutex);
+		buffer.name = name;
+	}
+
+	const char* Profiler::Intern(const std::string& name)
+	{
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.internMutex);
+		return s.interned.insert(name).first->c_str();
+	}
+
+	int64_t Profiler::Now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	uint32_t Profiler::BeginScope()
+	{
+		return t_depth++;
+	}
+
+	void Profiler::EndScope(const char* name, int64_t start, uint32_t depth)
+	{
+		const int64_t end = Now();
+		t_depth = depth;
+
+		ThreadBuffer& buffer = GetThreadBuffer();
+		const uint64_t index = buffer.written.load(std::memory_order_relaxed);
+		buffer.slots[index & ThreadBuffer::Mask] = { name, start, end, depth };
+		buffer.written.store(index + 1, std::memory_order_release);
+	}
+
+	std::vector<std::shared_ptr<const ProfileFrame>> Profiler::GetRecentFrames(std::size_t count)
+	{
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		count = std::min(count, s.history.size());
+		return { s.history.end() - count, s.history.end() };
+	}
+
+	void Profiler::SetHistorySize(std::size_t frames)
+	{
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		s.historySize = std::max<std::size_t>(frames, 1);
+		while (s.history.size() > s.historySize) s.history.pop_front();
+	}
+
+	std::size_t Profiler::GetHistorySize()
+	{
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		return s.historySize;
+	}
+
+	void Profiler::SetPaused(bool paused)
+	{
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		s.paused = paused;
+	}
+
+	bool Profiler::IsPaused()
+	{
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		return s.paused;
+	}
+
+	void Profiler::Clear()
+	{
+		State& s = GetState();
+		std::lock_guard<std::mutex> lock(s.mutex);
+		s.history.clear();
+		for (auto& buffer : s.buffers) buffer->read = buffer->written.load(std::memory_order_acquire);
+	}
+
+	bool Profiler::ExportChromeTrace(const std::string& path, std::size_t frameCount)
+	{
+		return ExportChromeTrace(path, GetRecentFrames(frameCount));
+	}
+
+	bool Profiler::ExportChromeTrace(const std::string& path, const std::vector<std::shared_ptr<const ProfileFrame>>& frames)
+	{
+		if (frames.empty()) return false;
+
+		// 時刻は先頭フレームからの µs
+		const int64_t origin = frames.front()->start;
+		auto toUs = [origin](int64_t ns) { return (ns - origin) / 1000.0; };
+
+		nlohmann::json events = nlohmann::json::array();
+		events.push_back({ { "name", "process_name" }, { "ph", "M" }, { "pid", 1 }, { "args", { { "name", "Arche" } } } });
+		events.push_back({ { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", 0 }, { "args", { { "name", "Frames" } } } });
+
+		// tid 0 はフレームの区切り、スレッドは id + 1
+		std::map<uint32_t, std::string> threadNames;
+		for (const auto& frame : frames)
+		{
+			events.push_back({
+				{ "name", "Frame " + std::to_string(frame->index) }, { "cat", "frame" }, { "ph", "X" },
+				{ "ts", toUs(frame->start) }, { "dur", (frame->end - frame->start) / 1000.0 }, { "pid", 1 }, { "tid", 0 }
+			});
+
+			for (const auto& thread : frame->threads)
+			{
+				threadNames[thread.id] = thread.name;
+				for (const auto& e : thread.events)
+				{
+					events.push_back({
+						{ "name", e.name ? e.name : "?" }, { "cat", "scope" }, { "ph", "X" },
+						{ "ts", toUs(e.start) }, { "dur", (e.end - e.start) / 1000.0 }, { "pid", 1 }, { "tid", thread.id + 1 }
+					});
+				}
+			}
+		}
+
+		for (const auto& [id, name] : threadNames)
+		{
+			events.push_back({ { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", id + 1 }, { "args", { { "name", name } } } });
+		}
+
+		std::filesystem::path filePath(path);
+		if (filePath.has_parent_path())
+		{
+			std::error_code ec;
+			std::filesystem::create_directories(filePath.parent_path(), ec);
+		}
+
+		std::ofstream ofs(filePath);
+		if (!ofs) return false;
+
+		nlohmann::json trace = { { "traceEvents", std::move(events) }, { "displayTimeUnit", "ms" } };
+		ofs << trace.dump();
+		return (bool)ofs;
+	}
+
+}	// namespace Arche
@@ -0,0 +1,148 @@
+﻿/*****************************************************************//**
+ * @file	Profiler.h
+ * @brief	区間計測プロファイラ（フレーム単位の記録 / Chrome Trace 出力）
+ *
+ * @details
+ * ARCHE_PROFILE_SCOPE("Name") を置いたスコープの開始・終了時刻を、
+ * スレッドごとのリングバッファへロックなしで記録する。
+ * Profiler::BeginFrame() がフレームの区切りで、各スレッドの記録をまとめて履歴に移す。
+ * ARCHE_PROFILE_ENABLED が 0 の場合、マクロは何も生成しない（既定では Debug のみ有効）。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___PROFILER_H___
+#define ___PROFILER_H___
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+
+// 計測の有効 / 無効（プロジェクト設定で上書き可能）
+#ifndef ARCHE_PROFILE_ENABLED
+	#ifdef _DEBUG
+		#define ARCHE_PROFILE_ENABLED 1
+	#else
+		#define ARCHE_PROFILE_ENABLED 0
+	#endif // _DEBUG
+#endif // !ARCHE_PROFILE_ENABLED
+
+namespace Arche
+{
+	// 1区間分の記録（時刻は ns）
+	struct ProfileEvent
+	{
+		const char* name = nullptr;
+		int64_t start = 0;
+		int64_t end = 0;
+		uint32_t depth = 0;	// 入れ子の深さ（0 が最上位）
+	};
+
+	// 1スレッド分の記録
+	struct ProfileThread
+	{
+		uint32_t id = 0;
+		std::string name;
+		std::vector<ProfileEvent> events;	// 終了順
+	};
+
+	// 1フレーム分の記録
+	struct ProfileFrame
+	{
+		uint64_t index = 0;
+		int64_t start = 0;
+		int64_t end = 0;
+		std::vector<ProfileThread> threads;
+
+		double DurationMs() const { return (end - start) / 1000000.0; }
+	};
+
+	class ARCHE_API Profiler
+	{
+	public:
+		// フレームの区切り（前のフレームを締めて履歴に積む / メインループの先頭で呼ぶ）
+		static void BeginFrame();
+
+		// 呼び出したスレッドの表示名を設定
+		static void SetThreadName(const std::string& name);
+
+		// 動的な名前を記録できる形にする（同じ文字列には同じポインタを返す）
+		static const char* Intern(const std::string& name);
+
+		// 計測用の現在時刻（ns）
+		static int64_t Now();
+
+		// 区間の開始 / 終了（ProfileScope から呼ばれる）
+		static uint32_t BeginScope();
+		static void EndScope(const char* name, int64_t start, uint32_t depth);
+
+		// 直近 count フレームの記録（古い順）
+		static std::vector<std::shared_ptr<const ProfileFrame>> GetRecentFrames(std::size_t count);
+
+		// 保持するフレーム数
+		static void SetHistorySize(std::size_t frames);
+		static std::size_t GetHistorySize();
+
+		// 一時停止中は履歴を更新しない（記録は捨てる）
+		static void SetPaused(bool paused);
+		static bool IsPaused();
+
+		// 履歴と未読の記録を全て破棄
+		// ※ 記録した名前は各モジュールの文字列を指しているため、DLL の解放前に呼ぶ
+		static void Clear();
+
+		// 直近 frameCount フレームを Chrome Trace 形式（chrome://tracing / Perfetto）で書き出す
+		static bool ExportChromeTrace(const std::string& path, std::size_t frameCount);
+		static bool ExportChromeTrace(const std::string& path, const std::vector<std::shared_ptr<const ProfileFrame>>& frames);
+	};
+
+	// スコープを抜けるまでの区間を記録する
+	class ProfileScope
+	{
+	public:
+		explicit ProfileScope(const char* name)
+			: m_name(name), m_depth(Profiler::BeginScope()), m_start(Profiler::Now())
+		{
+		}
+
+		~ProfileScope()
+		{
+			Profiler::EndScope(m_name, m_start, m_depth);
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* m_name;
+		uint32_t m_depth;
+		int64_t m_start;
+	};
+
+}	// namespace Arche
+
+// ===== マクロ =====
+#if ARCHE_PROFILE_ENABLED
+	#define ARCHE_PROFILE_CONCAT_INNER(a, b) a##b
+	#define ARCHE_PROFILE_CONCAT(a, b) ARCHE_PROFILE_CONCAT_INNER(a, b)
+
+	// 文字列リテラルの名前で計測
+	#define ARCHE_PROFILE_SCOPE(name) ::Arche::ProfileScope ARCHE_PROFILE_CONCAT(_archeProfileScope, __LINE__)(name)
+	// std::string の名前で計測（Intern するので毎回ロックが入る。システム単位など粗い粒度で使う）
+	#define ARCHE_PROFILE_SCOPE_DYNAMIC(name) ::Arche::ProfileScope ARCHE_PROFILE_CONCAT(_archeProfileScope, __LINE__)(::Arche::Profiler::Intern(name))
+	// 関数名で計測
+	#define ARCHE_PROFILE_FUNCTION() ARCHE_PROFILE_SCOPE(__FUNCTION__)
+	// フレームの区切り
+	#define ARCHE_PROFILE_FRAME() ::Arche::Profiler::BeginFrame()
+	// スレッド名の設定
+	#define ARCHE_PROFILE_THREAD(name) ::Arche::Profiler::SetThreadName(name)
+#else
+	#define ARCHE_PROFILE_SCOPE(name)
+	#define ARCHE_PROFILE_SCOPE_DYNAMIC(name)
+	#define ARCHE_PROFILE_FUNCTION()
+	#define ARCHE_PROFILE_FRAME()
+	#define ARCHE_PROFILE_THREAD(name)
+#endif // ARCHE_PROFILE_ENABLED
+
+#endif // !___PROFILER_H___
@@ -0,0 +1,98 @@
+﻿// ===== インクルード =====
+#ifndef ARCHE_ECS_STANDALONE
+#include "Engine/pch.h"
+#endif // !ARCHE_ECS_STANDALONE
+#include "RollingHistogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Arche
+{
+	RollingHistogram::RollingHistogram(std::size_t window)
+		: m_samples(std::max<std::size_t>(window, 1), 0.0f)
+	{
+	}
+
+	void RollingHistogram::Add(float ms)
+	{
+		// 窓から外れる値を区間から引く
+		if (m_count == m_samples.size()) --m_bins[BinOf(m_samples[m_head])];
+		else ++m_count;
+
+		m_samples[m_head] = ms;
+		++m_bins[BinOf(ms)];
+		m_head = (m_head + 1) % m_samples.size();
+	}
+
+	void RollingHistogram::Clear()
+	{
+		m_head = 0;
+		m_count = 0;
+		m_bins.fill(0);
+	}
+
+	void RollingHistogram::SetWindow(std::size_t window)
+	{
+		window = std::max<std::size_t>(window, 1);
+		if (window == m_samples.size()) return;
+
+		// 新しい方から残す
+		std::vector<float> recent;
+		recent.reserve(std::min(window, m_count));
+		for (std::size_t i = std::min(window, m_count); i > 0; --i)
+		{
+			recent.push_back(m_samples[(m_head + m_samples.size() - i) % m_samples.size()]);
+		}
+
+		m_samples.assign(window, 0.0f);
+		Clear();
+		for (float ms : recent) Add(ms);
+	}
+
+	float RollingHistogram::Percentile(float p) const
+	{
+		if (m_count == 0) return 0.0f;
+
+		const float target = std::clamp(p, 0.0f, 1.0f) * (float)m_count;
+		float cumulative = 0.0f;
+		for (int i = 0; i < BinCount; ++i)
+		{
+			if (m_bins[i] == 0) continue;
+			if (cumulative + m_bins[i] >= target)
+			{
+				const float lower = (i == 0) ? 0.0f : BinUpper(i - 1);
+				const float t = (target - cumulative) / (float)m_bins[i];
+				return std::min(lower + (BinUpper(i) - lower) * t, Max());
+			}
+			cumulative += m_bins[i];
+		}
+		return Max();
+	}
+
+	float RollingHistogram::Max() const
+	{
+		float result = 0.0f;
+		for (std::size_t i = 0; i < m_count; ++i) result = std::max(result, m_samples[i]);
+		return result;
+	}
+
+	float RollingHistogram::Latest() const
+	{
+		if (m_count == 0) return 0.0f;
+		return m_samples[(m_head + m_samples.size() - 1) % m_samples.size()];
+	}
+
+	float RollingHistogram::BinUpper(int i)
+	{
+		return MinMs * std::exp2((float)i / BinsPerOctave);
+	}
+
+	int RollingHistogram::BinOf(float ms)
+	{
+		// 0 番は MinMs 未満、最後の区間は上限を超えた値も受ける
+		if (!(ms >= MinMs)) return 0;
+		const int bin = (int)std::floor(std::log2(ms / MinMs) * BinsPerOctave) + 1;
+		return std::min(bin, BinCount - 1);
+	}
+
+}	// namespace Arche
@@ -0,0 +1,68 @@
+﻿/*****************************************************************//**
+ * @file	RollingHistogram.h
+ * @brief	直近の処理時間の分布（パーセンタイル）
+ *
+ * @details
+ * FrameStats（エディタ / ランタイム）とヘッドレス実行の集計で共通に使う。
+ * エンジン本体に依存しないため、Windows以外でもビルドできる。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___ROLLING_HISTOGRAM_H___
+#define ___ROLLING_HISTOGRAM_H___
+
+// ===== インクルード =====
+#ifdef ARCHE_ECS_STANDALONE
+#ifndef ARCHE_API
+#define ARCHE_API
+#endif // !ARCHE_API
+#else
+#include "Engine/pch.h"
+#endif // ARCHE_ECS_STANDALONE
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Arche
+{
+	// 直近 window 個の値（ms）の分布
+	// ※ 区間は対数（1オクターブを BinsPerOctave 分割）で、パーセンタイルは区間内を線形補間する
+	class ARCHE_API RollingHistogram
+	{
+	public:
+		static constexpr int BinsPerOctave = 8;
+		static constexpr int BinCount = 160;		// 0.01ms ～ 約10秒
+		static constexpr float MinMs = 0.01f;
+
+		explicit RollingHistogram(std::size_t window = 300);
+
+		void Add(float ms);
+		void Clear();
+		void SetWindow(std::size_t window);
+
+		// p は 0.0 ～ 1.0
+		float Percentile(float p) const;
+		float Max() const;
+		float Latest() const;
+		std::size_t Count() const { return m_count; }
+
+		const std::array<uint32_t, BinCount>& Bins() const { return m_bins; }
+
+		// i 番目の区間の上端（ms）
+		static float BinUpper(int i);
+		static int BinOf(float ms);
+
+	private:
+		std::vector<float> m_samples;	// リングバッファ
+		std::size_t m_head = 0;			// 次に書き込む位置
+		std::size_t m_count = 0;
+		std::array<uint32_t, BinCount> m_bins = {};
+	};
+
+}	// namespace Arche
+
+#endif // !___ROLLING_HISTOGRAM_H___
@@ -1,45 +1,66 @@
 ﻿// ===== インクルード =====
+#ifndef ARCHE_ECS_STANDALONE
 #include "Engine/pch.h"
+#endif // !ARCHE_ECS_STANDALONE
 #include "Time.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
 
 namespace Arche
 {
 	// 静的変数の実体定義
-	LARGE_INTEGER Time::s_cpuFreq = {};
-	LARGE_INTEGER Time::s_lastTime = {};
-	LARGE_INTEGER Time::s_startTime = {};
+	Time::Clock::time_point Time::s_lastTime = Time::Clock::now();
+	Time::Clock::time_point Time::s_startTime = Time::Clock::now();
 	double Time::s_deltaTime = 0.0;
 	bool Time::s_isStepNext = false;
 	double Time::s_targetFrameTime = 1.0 / 60.0;
+	double Time::s_fixedDeltaTime = 1.0 / 60.0;
+	double Time::s_fixedAccumulator = 0.0;
+	int Time::s_maxFixedSteps = 5;
+	int Time::s_fixedStepIndex = -1;
+	bool Time::s_isFixedStepNext = false;
 	float Time::timeScale = 1.0f;
 	bool Time::isPaused = false;
 
 	void Time::Initialize()
 	{
-		QueryPerformanceFrequency(&s_cpuFreq);
-		QueryPerformanceCounter(&s_startTime);
+		s_startTime = Clock::now();
 		s_lastTime = s_startTime;
+#ifndef ARCHE_ECS_STANDALONE
+		// Sleep の分解能を 1ms にする（WaitFrame の待ち過ぎを防ぐ）
 		timeBeginPeriod(1);
+#endif // !ARCHE_ECS_STANDALONE
 	}
 
 	void Time::Update()
 	{
-		LARGE_INTEGER currentTime;
-		QueryPerformanceCounter(&currentTime);
-
-		long long diff = currentTime.QuadPart - s_lastTime.QuadPart;
-		s_deltaTime = static_cast<double>(diff) / static_cast<double>(s_cpuFreq.QuadPart);
+		const Clock::time_point currentTime = Clock::now();
+		s_deltaTime = std::chrono::duration<double>(currentTime - s_lastTime).count();
 
 		s_lastTime = currentTime;
 	}
 
+	void Time::Advance(float seconds)
+	{
+		s_deltaTime = std::max(static_cast<double>(seconds), 0.0);
+		s_lastTime = Clock::now();
+	}
+
 	void Time::StepFrame()
 	{
 		s_isStepNext = true;
+		s_isFixedStepNext = true;
 	}
 
 	float Time::DeltaTime()
 	{
+		// 固定ステップ中は一定（timeScale は積む側で掛けているのでここでは掛けない）
+		if (s_fixedStepIndex >= 0)
+		{
+			return static_cast<float>(s_fixedDeltaTime);
+		}
+
 		if (s_isStepNext)
 		{
 			s_isStepNext = false;
@@ -56,10 +77,7 @@ namespace Arche
 
 	float Time::TotalTime()
 	{
-		LARGE_INTEGER currentTime;
-		QueryPerformanceCounter(&currentTime);
-		long long diff = currentTime.QuadPart - s_startTime.QuadPart;
-		return static_cast<float>(static_cast<double>(diff) / static_cast<double>(s_cpuFreq.QuadPart));
+		return static_cast<float>(std::chrono::duration<double>(Clock::now() - s_startTime).count());
 	}
 
 	void Time::SetFrameRate(int fps)
@@ -72,20 +90,90 @@ namespace Arche
 
 	void Time::WaitFrame()
 	{
-		LARGE_INTEGER currentTime;
-		QueryPerformanceCounter(&currentTime);
-
-		double elapsed = static_cast<double>(currentTime.QuadPart - s_lastTime.QuadPart) / static_cast<double>(s_cpuFreq.QuadPart);
+		double elapsed = std::chrono::duration<double>(Clock::now() - s_lastTime).count();
 
 		while (elapsed < s_targetFrameTime)
 		{
 			double remaining = s_targetFrameTime - elapsed;
 			if (remaining > 0.001)
 			{
-				Sleep(static_cast<DWORD>(remaining * 1000.0));
+				std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<long long>(remaining * 1000.0)));
 			}
-			QueryPerformanceCounter(&currentTime);
-			elapsed = static_cast<double>(currentTime.QuadPart - s_lastTime.QuadPart) / static_cast<double>(s_cpuFreq.QuadPart);
+			elapsed = std::chrono::duration<double>(Clock::now() - s_lastTime).count();
+		}
+	}
+
+	void Time::SetFixedRate(int hz)
+	{
+		if (hz > 0)
+		{
+			s_fixedDeltaTime = 1.0 / static_cast<double>(hz);
+		}
+	}
+
+	void Time::SetMaxFixedSteps(int steps)
+	{
+		s_maxFixedSteps = std::max(steps, 1);
+	}
+
+	int Time::GetMaxFixedSteps()
+	{
+		return s_maxFixedSteps;
+	}
+
+	float Time::FixedDeltaTime()
+	{
+		return static_cast<float>(s_fixedDeltaTime);
+	}
+
+	int Time::ConsumeFixedSteps()
+	{
+		// コマ送りは固定ステップを1回だけ進める
+		// ※ DeltaTime() のコマ送りフラグは先に読んだ側で消えるため、固定ステップ用に別で持つ
+		if (s_isFixedStepNext)
+		{
+			s_isFixedStepNext = false;
+			return 1;
+		}
+
+		// 一時停止中は積まない
+		if (!isPaused)
+		{
+			s_fixedAccumulator += s_deltaTime * timeScale;
+		}
+
+		int steps = 0;
+		while (s_fixedAccumulator >= s_fixedDeltaTime && steps < s_maxFixedSteps)
+		{
+			s_fixedAccumulator -= s_fixedDeltaTime;
+			++steps;
+		}
+
+		// 上限で追いつけなかった分は捨てる（追いかけて更に重くなるのを防ぐ）
+		if (s_fixedAccumulator >= s_fixedDeltaTime)
+		{
+			s_fixedAccumulator = std::fmod(s_fixedAccumulator, s_fixedDeltaTime);
 		}
+		return steps;
+	}
+
+	void Time::BeginFixedStep(int index)
+	{
+		s_fixedStepIndex = index;
+	}
+
+	void Time::EndFixedStep()
+	{
+		s_fixedStepIndex = -1;
+	}
+
+	int Time::FixedStepIndex()
+	{
+		return s_fixedStepIndex;
+	}
+
+	float Time::FixedAlpha()
+	{
+		return static_cast<float>(std::clamp(s_fixedAccumulator / s_fixedDeltaTime, 0.0, 1.0));
 	}
 }
\ No newline at end of file
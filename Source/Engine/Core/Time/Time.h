@@ -21,7 +21,15 @@
 #define ___TIME_H___
 
 // ===== インクルード =====
+#ifdef ARCHE_ECS_STANDALONE
+// エンジン本体を使わない構成（World だけを回すヘッドレス実行など）
+#ifndef ARCHE_API
+#define ARCHE_API
+#endif // !ARCHE_API
+#else
 #include "Engine/pch.h"
+#endif // ARCHE_ECS_STANDALONE
+#include <chrono>
 
 namespace Arche
 {
@@ -35,6 +43,9 @@ namespace Arche
 		// 更新
 		static void Update();
 
+		// 実時間を使わずに経過時間を指定して進める（ヘッドレス実行用 / Update の代わりに呼ぶ）
+		static void Advance(float seconds);
+
 		// コマ送り用
 		static void StepFrame();
 
@@ -50,17 +61,47 @@ namespace Arche
 		// 待機
 		static void WaitFrame();
 
+		// ---- 固定ステップ ----
+		// 固定ステップの頻度（Hz）
+		static void SetFixedRate(int hz);
+
+		// 1フレームで実行する固定ステップの上限（処理落ちで溜まった分はそれ以上追いかけない）
+		static void SetMaxFixedSteps(int steps);
+		static int GetMaxFixedSteps();
+
+		// 固定ステップの間隔（秒）
+		static float FixedDeltaTime();
+
+		// 経過時間を積み、このフレームで実行する固定ステップ数を返す（フレームに1回呼ぶ）
+		static int ConsumeFixedSteps();
+
+		// 固定ステップの開始 / 終了（間は DeltaTime() が固定ステップの間隔を返す）
+		static void BeginFixedStep(int index);
+		static void EndFixedStep();
+
+		// 実行中の固定ステップの番号（フレーム内で 0 から / 固定ステップ外は -1）
+		static int FixedStepIndex();
+
+		// 積み残した時間の割合（0～1 / 直前のステップと最新のステップの間を補間して描画するのに使う）
+		static float FixedAlpha();
+
 		// 公開変数（これらも実体はcppに置く）
 		static float timeScale;
 		static bool isPaused;
 
 	private:
-		static LARGE_INTEGER s_cpuFreq;
-		static LARGE_INTEGER s_lastTime;
-		static LARGE_INTEGER s_startTime;
+		using Clock = std::chrono::steady_clock;
+
+		static Clock::time_point s_lastTime;
+		static Clock::time_point s_startTime;
 		static double s_deltaTime;
 		static bool s_isStepNext;
 		static double s_targetFrameTime;
+		static double s_fixedDeltaTime;
+		static double s_fixedAccumulator;
+		static int s_maxFixedSteps;
+		static int s_fixedStepIndex;
+		static bool s_isFixedStepNext;
 	};
 
 }	// namespace Arche
@@ -57,7 +57,7 @@ namespace Arche
 		device->CreateDepthStencilView(depthTex.Get(), nullptr, m_dsv.GetAddressOf());
 	}
 
-	void RenderTarget::Bind(ID3D11DeviceContext* context)
+	void RenderTarget::Bind(IRenderBackend* backend)
 	{
 		if (!m_rtv || !m_dsv) return;
 
@@ -66,18 +66,18 @@ namespace Arche
 		vp.Height = (float)m_height;
 		vp.MinDepth = 0.0f;
 		vp.MaxDepth = 1.0f;
-		context->RSSetViewports(1, &vp);
+		backend->RSSetViewports(1, &vp);
 
-		context->OMSetRenderTargets(1, m_rtv.GetAddressOf(), m_dsv.Get());
+		backend->OMSetRenderTargets(1, m_rtv.GetAddressOf(), m_dsv.Get());
 	}
 
-	void RenderTarget::Clear(ID3D11DeviceContext* context, float r, float g, float b, float a)
+	void RenderTarget::Clear(IRenderBackend* backend, float r, float g, float b, float a)
 	{
 		if (!m_rtv || !m_dsv) return;
 
 		float color[] = { r, g, b, a };
-		context->ClearRenderTargetView(m_rtv.Get(), color);
-		context->ClearDepthStencilView(m_dsv.Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+		backend->ClearRenderTargetView(m_rtv.Get(), color);
+		backend->ClearDepthStencilView(m_dsv.Get(), D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
 	}
 
 }	// namespace Arche
\ No newline at end of file
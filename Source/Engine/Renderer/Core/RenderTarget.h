@@ -35,19 +35,19 @@ namespace Arche
 
 		/**
 		 * @brief	描画先として設定
-		 * @param	context	コンテキスト
+		 * @param	backend	描画コマンドの発行先
 		 */
-		void Bind(ID3D11DeviceContext* context);
+		void Bind(IRenderBackend* backend);
 
 		/**
 		 * @brief	描画結果をクリア
-		 * @param	context	コンテキスト
+		 * @param	backend	描画コマンドの発行先
 		 * @param	r		背景色（R）
 		 * @param	g		背景色（G）
 		 * @param	b		背景色（B）
 		 * @param	a		背景色（A）
 		 */
-		void Clear(ID3D11DeviceContext* context, float r, float g, float b, float a);
+		void Clear(IRenderBackend* backend, float r, float g, float b, float a);
 
 		/**
 		 * @brief	ImGuiやテクスチャとして扱うためのSRV
@@ -69,21 +69,21 @@ namespace Arche
 		m_viewport.MaxDepth = 1.0f;
 	}
 
-	void ShadowMap::Begin(ID3D11DeviceContext* context)
+	void ShadowMap::Begin(IRenderBackend* backend)
 	{
 		// レンダーターゲットを解除し、深度バッファのみをセット
 		// (カラー出力は不要なため、RTVはnullptr)
 		ID3D11RenderTargetView* nullRTV = nullptr;
-		context->OMSetRenderTargets(0, &nullRTV, m_dsv.Get());
+		backend->OMSetRenderTargets(0, &nullRTV, m_dsv.Get());
 
 		// 深度クリア
-		context->ClearDepthStencilView(m_dsv.Get(), D3D11_CLEAR_DEPTH, 1.0f, 0);
+		backend->ClearDepthStencilView(m_dsv.Get(), D3D11_CLEAR_DEPTH, 1.0f, 0);
 
 		// ビューポート設定
-		context->RSSetViewports(1, &m_viewport);
+		backend->RSSetViewports(1, &m_viewport);
 	}
 
-	void ShadowMap::End(ID3D11DeviceContext* context)
+	void ShadowMap::End(IRenderBackend* backend)
 	{
 		// 特に処理は不要だが、SRVとして使うためにバインド解除が必要な場合に備える
 		// (今回はRenderSystem側でRTVを再設定することで自動的に解除されるため空でOK)
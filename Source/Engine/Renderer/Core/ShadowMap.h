@@ -14,6 +14,7 @@
 
 // ===== インクルード =====
 #include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 
 namespace Arche
 {
@@ -27,10 +28,10 @@ namespace Arche
 		void Initialize(ID3D11Device* device, float width, float height);
 
 		// 影描画の開始 (レンダーターゲットを切り替え)
-		void Begin(ID3D11DeviceContext* context);
+		void Begin(IRenderBackend* backend);
 
 		// 影描画の終了 (レンダーターゲットを元に戻す処理はRenderSystemで行うため、ここではリソース化の準備のみ)
-		void End(ID3D11DeviceContext* context);
+		void End(IRenderBackend* backend);
 
 		// シェーダーに渡すリソースビューを取得
 		ID3D11ShaderResourceView* GetSRV() const { return m_srv.Get(); }
@@ -1,12 +1,10 @@
 ﻿#include "Engine/pch.h"
 #include "MeshBuffer.h"
-#include "Engine/Core/Application.h" // Device取得用
+#include "Engine/Renderer/RHI/RenderBackend.h"
 
 namespace Arche
 {
 
-	using namespace Arche; // Applicationクラスのある名前空間
-
 	MeshBuffer::MeshBuffer() : m_desc{} {}
 	MeshBuffer::~MeshBuffer() {}
 
@@ -34,23 +32,23 @@ namespace Arche
 
 	void MeshBuffer::Draw()
 	{
-		auto context = Application::Instance().GetContext();
+		IRenderBackend* backend = &RenderBackend::Get();
 
 		UINT stride = m_desc.vtxSize;
 		UINT offset = 0;
 
-		context->IASetPrimitiveTopology(m_desc.topology);
-		context->IASetVertexBuffers(0, 1, m_pVtxBuffer.GetAddressOf(), &stride, &offset);
+		backend->IASetPrimitiveTopology(m_desc.topology);
+		backend->IASetVertexBuffers(0, 1, m_pVtxBuffer.GetAddressOf(), &stride, &offset);
 
 		if (m_desc.idxCount > 0)
 		{
 			DXGI_FORMAT format = (m_desc.idxSize == 4) ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT;
-			context->IASetIndexBuffer(m_pIdxBuffer.Get(), format, 0);
-			context->DrawIndexed(m_desc.idxCount, 0, 0);
+			backend->IASetIndexBuffer(m_pIdxBuffer.Get(), format, 0);
+			backend->DrawIndexed(m_desc.idxCount, 0, 0);
 		}
 		else
 		{
-			context->Draw(m_desc.vtxCount, 0);
+			backend->Draw(m_desc.vtxCount, 0);
 		}
 	}
 
@@ -58,20 +56,24 @@ namespace Arche
 	{
 		if (!m_desc.isWrite) return E_FAIL;
 
-		auto context = Application::Instance().GetContext();
+		IRenderBackend* backend = &RenderBackend::Get();
 		D3D11_MAPPED_SUBRESOURCE mapResource;
 
-		HRESULT hr = context->Map(m_pVtxBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapResource);
+		HRESULT hr = backend->Map(m_pVtxBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapResource);
 		if (SUCCEEDED(hr))
 		{
 			memcpy(mapResource.pData, pVtx, m_desc.vtxCount * m_desc.vtxSize);
-			context->Unmap(m_pVtxBuffer.Get(), 0);
+			backend->Unmap(m_pVtxBuffer.Get(), 0);
 		}
 		return hr;
 	}
 
 	HRESULT MeshBuffer::CreateVertexBuffer(const void* pVtx, UINT size, UINT count, bool isWrite)
 	{
+		// デバイス無しで初期化された（描画しない実行）なら作らない
+		ID3D11Device* device = RenderBackend::GetDevice();
+		if (!device) return E_FAIL;
+
 		D3D11_BUFFER_DESC bufDesc = {};
 		bufDesc.ByteWidth = size * count;
 		bufDesc.Usage = isWrite ? D3D11_USAGE_DYNAMIC : D3D11_USAGE_DEFAULT;
@@ -81,11 +83,14 @@ namespace Arche
 		D3D11_SUBRESOURCE_DATA subResource = {};
 		subResource.pSysMem = pVtx;
 
-		return Application::Instance().GetDevice()->CreateBuffer(&bufDesc, &subResource, &m_pVtxBuffer);
+		return device->CreateBuffer(&bufDesc, &subResource, &m_pVtxBuffer);
 	}
 
 	HRESULT MeshBuffer::CreateIndexBuffer(const void* pIdx, UINT size, UINT count)
 	{
+		ID3D11Device* device = RenderBackend::GetDevice();
+		if (!device) return E_FAIL;
+
 		D3D11_BUFFER_DESC bufDesc = {};
 		bufDesc.ByteWidth = size * count;
 		bufDesc.Usage = D3D11_USAGE_DEFAULT;
@@ -94,6 +99,6 @@ namespace Arche
 		D3D11_SUBRESOURCE_DATA subResource = {};
 		subResource.pSysMem = pIdx;
 
-		return Application::Instance().GetDevice()->CreateBuffer(&bufDesc, &subResource, &m_pIdxBuffer);
+		return device->CreateBuffer(&bufDesc, &subResource, &m_pIdxBuffer);
 	}
 }
\ No newline at end of file
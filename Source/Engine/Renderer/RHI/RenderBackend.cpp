@@ -0,0 +1,443 @@
+﻿/*****************************************************************//**
+ * @file	RenderBackend.cpp
+ * @brief	描画コマンドの発行先（D3D11 / Null）の実装
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
+
+namespace Arche
+{
+	namespace
+	{
+		struct State
+		{
+			ID3D11Device* device = nullptr;
+			std::unique_ptr<IRenderBackend> backend;
+			RenderStats lastFrame;
+		};
+
+		State& GetState()
+		{
+			static State state;
+			return state;
+		}
+
+		bool IsWriteMap(D3D11_MAP mapType)
+		{
+			return mapType != D3D11_MAP_READ;
+		}
+	}
+
+	// ======================================================================
+	// IRenderBackend
+	// ======================================================================
+	uint64_t IRenderBackend::CalcUploadBytes(ID3D11Resource* resource, UINT subresource, const D3D11_BOX* box, UINT rowPitch, UINT depthPitch)
+	{
+		if (!resource) return 0;
+
+		D3D11_RESOURCE_DIMENSION dimension = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+		resource->GetType(&dimension);
+
+		// バッファは範囲指定が無ければ全体
+		if (dimension == D3D11_RESOURCE_DIMENSION_BUFFER)
+		{
+			if (box) return box->right - box->left;
+
+			D3D11_BUFFER_DESC desc;
+			static_cast<ID3D11Buffer*>(resource)->GetDesc(&desc);
+			return desc.ByteWidth;
+		}
+
+		// テクスチャは 行ピッチ × 行数（× 奥行き）
+		UINT rows = 1;
+		UINT depth = 1;
+		if (box)
+		{
+			rows = box->bottom - box->top;
+			depth = box->back - box->front;
+		}
+		else if (dimension == D3D11_RESOURCE_DIMENSION_TEXTURE2D)
+		{
+			D3D11_TEXTURE2D_DESC desc;
+			static_cast<ID3D11Texture2D*>(resource)->GetDesc(&desc);
+			const UINT mip = subresource % std::max<UINT>(desc.MipLevels, 1);
+			rows = std::max<UINT>(desc.Height >> mip, 1);
+
+			// ブロック圧縮は 4 行で 1 ブロック行
+			if (desc.Format >= DXGI_FORMAT_BC1_TYPELESS && desc.Format <= DXGI_FORMAT_BC5_SNORM) rows = (rows + 3) / 4;
+			if (desc.Format >= DXGI_FORMAT_BC6H_TYPELESS && desc.Format <= DXGI_FORMAT_BC7_UNORM_SRGB) rows = (rows + 3) / 4;
+		}
+
+		if (depth > 1 && depthPitch > 0) return (uint64_t)depthPitch * depth;
+		return (uint64_t)rowPitch * rows;
+	}
+
+	// ======================================================================
+	// D3D11RenderBackend
+	// ======================================================================
+	void D3D11RenderBackend::Draw(UINT vertexCount, UINT startVertexLocation)
+	{
+		++m_stats.drawCalls;
+		m_context->Draw(vertexCount, startVertexLocation);
+	}
+
+	void D3D11RenderBackend::DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation)
+	{
+		++m_stats.drawCalls;
+		m_context->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
+	}
+
+	void D3D11RenderBackend::IASetInputLayout(ID3D11InputLayout* inputLayout)
+	{
+		++m_stats.stateChanges;
+		m_context->IASetInputLayout(inputLayout);
+	}
+
+	void D3D11RenderBackend::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
+	{
+		++m_stats.stateChanges;
+		m_context->IASetPrimitiveTopology(topology);
+	}
+
+	void D3D11RenderBackend::IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets)
+	{
+		++m_stats.stateChanges;
+		m_context->IASetVertexBuffers(startSlot, numBuffers, vertexBuffers, strides, offsets);
+	}
+
+	void D3D11RenderBackend::IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset)
+	{
+		++m_stats.stateChanges;
+		m_context->IASetIndexBuffer(indexBuffer, format, offset);
+	}
+
+	void D3D11RenderBackend::VSSetShader(ID3D11VertexShader* vertexShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances)
+	{
+		++m_stats.stateChanges;
+		m_context->VSSetShader(vertexShader, classInstances, numClassInstances);
+	}
+
+	void D3D11RenderBackend::PSSetShader(ID3D11PixelShader* pixelShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances)
+	{
+		++m_stats.stateChanges;
+		m_context->PSSetShader(pixelShader, classInstances, numClassInstances);
+	}
+
+	void D3D11RenderBackend::VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers)
+	{
+		++m_stats.stateChanges;
+		m_context->VSSetConstantBuffers(startSlot, numBuffers, constantBuffers);
+	}
+
+	void D3D11RenderBackend::PSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers)
+	{
+		++m_stats.stateChanges;
+		m_context->PSSetConstantBuffers(startSlot, numBuffers, constantBuffers);
+	}
+
+	void D3D11RenderBackend::PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* shaderResourceViews)
+	{
+		++m_stats.stateChanges;
+		m_context->PSSetShaderResources(startSlot, numViews, shaderResourceViews);
+	}
+
+	void D3D11RenderBackend::PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers)
+	{
+		++m_stats.stateChanges;
+		m_context->PSSetSamplers(startSlot, numSamplers, samplers);
+	}
+
+	void D3D11RenderBackend::RSSetState(ID3D11RasterizerState* rasterizerState)
+	{
+		++m_stats.stateChanges;
+		m_context->RSSetState(rasterizerState);
+	}
+
+	void D3D11RenderBackend::RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports)
+	{
+		++m_stats.stateChanges;
+		m_context->RSSetViewports(numViewports, viewports);
+	}
+
+	void D3D11RenderBackend::RSGetViewports(UINT* numViewports, D3D11_VIEWPORT* viewports)
+	{
+		m_context->RSGetViewports(numViewports, viewports);
+	}
+
+	void D3D11RenderBackend::OMSetBlendState(ID3D11BlendState* blendState, const FLOAT blendFactor[4], UINT sampleMask)
+	{
+		++m_stats.stateChanges;
+		m_context->OMSetBlendState(blendState, blendFactor, sampleMask);
+	}
+
+	void D3D11RenderBackend::OMSetDepthStencilState(ID3D11DepthStencilState* depthStencilState, UINT stencilRef)
+	{
+		++m_stats.stateChanges;
+		m_context->OMSetDepthStencilState(depthStencilState, stencilRef);
+	}
+
+	void D3D11RenderBackend::OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView)
+	{
+		++m_stats.stateChanges;
+		m_context->OMSetRenderTargets(numViews, renderTargetViews, depthStencilView);
+	}
+
+	void D3D11RenderBackend::OMGetRenderTargets(UINT numViews, ID3D11RenderTargetView** renderTargetViews, ID3D11DepthStencilView** depthStencilView)
+	{
+		m_context->OMGetRenderTargets(numViews, renderTargetViews, depthStencilView);
+	}
+
+	void D3D11RenderBackend::ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4])
+	{
+		m_context->ClearRenderTargetView(renderTargetView, colorRGBA);
+	}
+
+	void D3D11RenderBackend::ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil)
+	{
+		m_context->ClearDepthStencilView(depthStencilView, clearFlags, depth, stencil);
+	}
+
+	void D3D11RenderBackend::UpdateSubresource(ID3D11Resource* dstResource, UINT dstSubresource, const D3D11_BOX* dstBox, const void* srcData, UINT srcRowPitch, UINT srcDepthPitch)
+	{
+		m_stats.bytesUploaded += CalcUploadBytes(dstResource, dstSubresource, dstBox, srcRowPitch, srcDepthPitch);
+		m_context->UpdateSubresource(dstResource, dstSubresource, dstBox, srcData, srcRowPitch, srcDepthPitch);
+	}
+
+	HRESULT D3D11RenderBackend::Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource)
+	{
+		HRESULT hr = m_context->Map(resource, subresource, mapType, mapFlags, mappedResource);
+		if (SUCCEEDED(hr) && IsWriteMap(mapType))
+		{
+			m_stats.bytesUploaded += CalcUploadBytes(resource, subresource, nullptr, mappedResource->RowPitch, mappedResource->DepthPitch);
+		}
+		return hr;
+	}
+
+	void D3D11RenderBackend::Unmap(ID3D11Resource* resource, UINT subresource)
+	{
+		m_context->Unmap(resource, subresource);
+	}
+
+	// ======================================================================
+	// NullRenderBackend
+	// ======================================================================
+	void NullRenderBackend::Draw(UINT, UINT)
+	{
+		++m_stats.drawCalls;
+	}
+
+	void NullRenderBackend::DrawIndexed(UINT, UINT, INT)
+	{
+		++m_stats.drawCalls;
+	}
+
+	void NullRenderBackend::IASetInputLayout(ID3D11InputLayout*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::IASetVertexBuffers(UINT, UINT, ID3D11Buffer* const*, const UINT*, const UINT*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::IASetIndexBuffer(ID3D11Buffer*, DXGI_FORMAT, UINT)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::VSSetShader(ID3D11VertexShader*, ID3D11ClassInstance* const*, UINT)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::PSSetShader(ID3D11PixelShader*, ID3D11ClassInstance* const*, UINT)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::VSSetConstantBuffers(UINT, UINT, ID3D11Buffer* const*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::PSSetConstantBuffers(UINT, UINT, ID3D11Buffer* const*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::PSSetShaderResources(UINT, UINT, ID3D11ShaderResourceView* const*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::PSSetSamplers(UINT, UINT, ID3D11SamplerState* const*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::RSSetState(ID3D11RasterizerState*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports)
+	{
+		++m_stats.stateChanges;
+		m_numViewports = std::min<UINT>(numViewports, (UINT)m_viewports.size());
+		for (UINT i = 0; i < m_numViewports; ++i) m_viewports[i] = viewports[i];
+	}
+
+	void NullRenderBackend::RSGetViewports(UINT* numViewports, D3D11_VIEWPORT* viewports)
+	{
+		if (!viewports)
+		{
+			*numViewports = m_numViewports;
+			return;
+		}
+
+		// 設定されていない分は 0 で埋める（D3D11 と同じ）
+		for (UINT i = 0; i < *numViewports; ++i) viewports[i] = (i < m_numViewports) ? m_viewports[i] : D3D11_VIEWPORT{};
+	}
+
+	void NullRenderBackend::OMSetBlendState(ID3D11BlendState*, const FLOAT[4], UINT)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::OMSetDepthStencilState(ID3D11DepthStencilState*, UINT)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::OMSetRenderTargets(UINT, ID3D11RenderTargetView* const*, ID3D11DepthStencilView*)
+	{
+		++m_stats.stateChanges;
+	}
+
+	void NullRenderBackend::OMGetRenderTargets(UINT numViews, ID3D11RenderTargetView** renderTargetViews, ID3D11DepthStencilView** depthStencilView)
+	{
+		if (renderTargetViews)
+		{
+			for (UINT i = 0; i < numViews; ++i) renderTargetViews[i] = nullptr;
+		}
+		if (depthStencilView) *depthStencilView = nullptr;
+	}
+
+	void NullRenderBackend::ClearRenderTargetView(ID3D11RenderTargetView*, const FLOAT[4])
+	{
+	}
+
+	void NullRenderBackend::ClearDepthStencilView(ID3D11DepthStencilView*, UINT, FLOAT, UINT8)
+	{
+	}
+
+	void NullRenderBackend::UpdateSubresource(ID3D11Resource* dstResource, UINT dstSubresource, const D3D11_BOX* dstBox, const void*, UINT srcRowPitch, UINT srcDepthPitch)
+	{
+		m_stats.bytesUploaded += CalcUploadBytes(dstResource, dstSubresource, dstBox, srcRowPitch, srcDepthPitch);
+	}
+
+	HRESULT NullRenderBackend::Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT, D3D11_MAPPED_SUBRESOURCE* mappedResource)
+	{
+		if (!resource || !mappedResource) return E_INVALIDARG;
+
+		D3D11_RESOURCE_DIMENSION dimension = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+		resource->GetType(&dimension);
+		if (dimension != D3D11_RESOURCE_DIMENSION_BUFFER) return E_NOTIMPL;
+
+		const uint64_t bytes = CalcUploadBytes(resource, subresource, nullptr, 0, 0);
+		if (m_mapScratch.size() < bytes) m_mapScratch.resize((std::size_t)bytes);
+
+		mappedResource->pData = m_mapScratch.data();
+		mappedResource->RowPitch = (UINT)bytes;
+		mappedResource->DepthPitch = (UINT)bytes;
+
+		if (IsWriteMap(mapType)) m_stats.bytesUploaded += bytes;
+		return S_OK;
+	}
+
+	void NullRenderBackend::Unmap(ID3D11Resource*, UINT)
+	{
+	}
+
+	// ======================================================================
+	// RenderBackend
+	// ======================================================================
+	void RenderBackend::Initialize(ID3D11Device* device, std::unique_ptr<IRenderBackend> backend)
+	{
+		State& s = GetState();
+		s.device = device;
+		s.backend = std::move(backend);
+		s.lastFrame = {};
+	}
+
+	bool RenderBackend::CreateOffscreenDevice(ComPtr<ID3D11Device>& device, ComPtr<ID3D11DeviceContext>& context)
+	{
+		D3D_FEATURE_LEVEL featureLevels[] = { D3D_FEATURE_LEVEL_11_0 };
+		const D3D_DRIVER_TYPE driverTypes[] = { D3D_DRIVER_TYPE_WARP, D3D_DRIVER_TYPE_HARDWARE };
+
+		for (D3D_DRIVER_TYPE driverType : driverTypes)
+		{
+			HRESULT hr = D3D11CreateDevice(
+				nullptr, driverType, nullptr, D3D11_CREATE_DEVICE_BGRA_SUPPORT,
+				featureLevels, 1, D3D11_SDK_VERSION,
+				&device, nullptr, &context
+			);
+			if (SUCCEEDED(hr)) return true;
+		}
+		return false;
+	}
+
+	void RenderBackend::Shutdown()
+	{
+		State& s = GetState();
+		s.backend.reset();
+		s.device = nullptr;
+		s.lastFrame = {};
+	}
+
+	IRenderBackend& RenderBackend::Get()
+	{
+		State& s = GetState();
+		assert(s.backend && "RenderBackend が初期化されていません。");
+		return *s.backend;
+	}
+
+	ID3D11Device* RenderBackend::GetDevice()
+	{
+		return GetState().device;
+	}
+
+	bool RenderBackend::IsInitialized()
+	{
+		return GetState().backend != nullptr;
+	}
+
+	void RenderBackend::BeginFrame()
+	{
+		State& s = GetState();
+		if (!s.backend) return;
+
+		s.lastFrame = s.backend->GetStats();
+		s.backend->ResetStats();
+	}
+
+	const RenderStats& RenderBackend::GetLastFrameStats()
+	{
+		return GetState().lastFrame;
+	}
+
+}	// namespace Arche
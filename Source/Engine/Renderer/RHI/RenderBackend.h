@@ -0,0 +1,207 @@
+﻿/*****************************************************************//**
+ * @file	RenderBackend.h
+ * @brief	描画コマンドの発行先（D3D11 / Null）
+ *
+ * @details
+ * レンダラーは ID3D11DeviceContext を直接触らず、IRenderBackend を通して描画コマンドを発行する。
+ * D3D11RenderBackend はそのままコンテキストへ流し、NullRenderBackend は何も描かずに数だけ数える。
+ * どちらもドローコール数 / ステート変更数 / 転送バイト数を集計する（ヘッドレス実行の計測用）。
+ * ※ リソースの生成は従来通り ID3D11Device で行う（RenderBackend::GetDevice）
+ *   デバイスを渡さずに初期化した場合は GPU リソースを作らない（ヘッドレス実行の --no-render）
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___RENDER_BACKEND_H___
+#define ___RENDER_BACKEND_H___
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+
+namespace Arche
+{
+	// 描画コマンドの集計
+	struct RenderStats
+	{
+		uint64_t drawCalls = 0;		// Draw / DrawIndexed
+		uint64_t stateChanges = 0;	// IA / VS / PS / RS / OM の設定
+		uint64_t bytesUploaded = 0;	// UpdateSubresource / Map（書き込み）で CPU から送った量
+	};
+
+	class ARCHE_API IRenderBackend
+	{
+	public:
+		virtual ~IRenderBackend() = default;
+
+		virtual const char* GetName() const = 0;
+
+		// D3D11 を直接使う処理（ImGui / D2D など）向け（Null は nullptr）
+		virtual ID3D11DeviceContext* GetNativeContext() const = 0;
+
+		// ---- 描画 ----
+		virtual void Draw(UINT vertexCount, UINT startVertexLocation) = 0;
+		virtual void DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation) = 0;
+
+		// ---- 入力アセンブラ ----
+		virtual void IASetInputLayout(ID3D11InputLayout* inputLayout) = 0;
+		virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) = 0;
+		virtual void IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets) = 0;
+		virtual void IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset) = 0;
+
+		// ---- シェーダー ----
+		virtual void VSSetShader(ID3D11VertexShader* vertexShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) = 0;
+		virtual void PSSetShader(ID3D11PixelShader* pixelShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) = 0;
+		virtual void VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers) = 0;
+		virtual void PSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers) = 0;
+		virtual void PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* shaderResourceViews) = 0;
+		virtual void PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) = 0;
+
+		// ---- ラスタライザー ----
+		virtual void RSSetState(ID3D11RasterizerState* rasterizerState) = 0;
+		virtual void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports) = 0;
+		virtual void RSGetViewports(UINT* numViewports, D3D11_VIEWPORT* viewports) = 0;
+
+		// ---- 出力マージャー ----
+		virtual void OMSetBlendState(ID3D11BlendState* blendState, const FLOAT blendFactor[4], UINT sampleMask) = 0;
+		virtual void OMSetDepthStencilState(ID3D11DepthStencilState* depthStencilState, UINT stencilRef) = 0;
+		virtual void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView) = 0;
+		// ※ 取得したビューは参照カウントが増えるので、呼び出し側で Release する（Null は nullptr を返す）
+		virtual void OMGetRenderTargets(UINT numViews, ID3D11RenderTargetView** renderTargetViews, ID3D11DepthStencilView** depthStencilView) = 0;
+
+		// ---- クリア ----
+		virtual void ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4]) = 0;
+		virtual void ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil) = 0;
+
+		// ---- 転送 ----
+		virtual void UpdateSubresource(ID3D11Resource* dstResource, UINT dstSubresource, const D3D11_BOX* dstBox, const void* srcData, UINT srcRowPitch, UINT srcDepthPitch) = 0;
+		virtual HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource) = 0;
+		virtual void Unmap(ID3D11Resource* resource, UINT subresource) = 0;
+
+		// 集計（RenderBackend::BeginFrame でフレームごとに区切る）
+		const RenderStats& GetStats() const { return m_stats; }
+		void ResetStats() { m_stats = {}; }
+
+	protected:
+		// UpdateSubresource / Map で送る量（バイト）
+		static uint64_t CalcUploadBytes(ID3D11Resource* resource, UINT subresource, const D3D11_BOX* box, UINT rowPitch, UINT depthPitch);
+
+		RenderStats m_stats;
+	};
+
+	// ID3D11DeviceContext へそのまま流す
+	class ARCHE_API D3D11RenderBackend : public IRenderBackend
+	{
+	public:
+		explicit D3D11RenderBackend(ID3D11DeviceContext* context) : m_context(context) {}
+
+		const char* GetName() const override { return "D3D11"; }
+		ID3D11DeviceContext* GetNativeContext() const override { return m_context; }
+
+		void Draw(UINT vertexCount, UINT startVertexLocation) override;
+		void DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation) override;
+
+		void IASetInputLayout(ID3D11InputLayout* inputLayout) override;
+		void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) override;
+		void IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets) override;
+		void IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset) override;
+
+		void VSSetShader(ID3D11VertexShader* vertexShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override;
+		void PSSetShader(ID3D11PixelShader* pixelShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override;
+		void VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers) override;
+		void PSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers) override;
+		void PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* shaderResourceViews) override;
+		void PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override;
+
+		void RSSetState(ID3D11RasterizerState* rasterizerState) override;
+		void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports) override;
+		void RSGetViewports(UINT* numViewports, D3D11_VIEWPORT* viewports) override;
+
+		void OMSetBlendState(ID3D11BlendState* blendState, const FLOAT blendFactor[4], UINT sampleMask) override;
+		void OMSetDepthStencilState(ID3D11DepthStencilState* depthStencilState, UINT stencilRef) override;
+		void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView) override;
+		void OMGetRenderTargets(UINT numViews, ID3D11RenderTargetView** renderTargetViews, ID3D11DepthStencilView** depthStencilView) override;
+
+		void ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4]) override;
+		void ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil) override;
+
+		void UpdateSubresource(ID3D11Resource* dstResource, UINT dstSubresource, const D3D11_BOX* dstBox, const void* srcData, UINT srcRowPitch, UINT srcDepthPitch) override;
+		HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource) override;
+		void Unmap(ID3D11Resource* resource, UINT subresource) override;
+
+	private:
+		ID3D11DeviceContext* m_context = nullptr;
+	};
+
+	// 何も描かずに数だけ数える（ヘッドレス実行用）
+	class ARCHE_API NullRenderBackend : public IRenderBackend
+	{
+	public:
+		const char* GetName() const override { return "Null"; }
+		ID3D11DeviceContext* GetNativeContext() const override { return nullptr; }
+
+		void Draw(UINT vertexCount, UINT startVertexLocation) override;
+		void DrawIndexed(UINT indexCount, UINT startIndexLocation, INT baseVertexLocation) override;
+
+		void IASetInputLayout(ID3D11InputLayout* inputLayout) override;
+		void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) override;
+		void IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* vertexBuffers, const UINT* strides, const UINT* offsets) override;
+		void IASetIndexBuffer(ID3D11Buffer* indexBuffer, DXGI_FORMAT format, UINT offset) override;
+
+		void VSSetShader(ID3D11VertexShader* vertexShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override;
+		void PSSetShader(ID3D11PixelShader* pixelShader, ID3D11ClassInstance* const* classInstances, UINT numClassInstances) override;
+		void VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers) override;
+		void PSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* constantBuffers) override;
+		void PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* shaderResourceViews) override;
+		void PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* samplers) override;
+
+		void RSSetState(ID3D11RasterizerState* rasterizerState) override;
+		void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* viewports) override;
+		void RSGetViewports(UINT* numViewports, D3D11_VIEWPORT* viewports) override;
+
+		void OMSetBlendState(ID3D11BlendState* blendState, const FLOAT blendFactor[4], UINT sampleMask) override;
+		void OMSetDepthStencilState(ID3D11DepthStencilState* depthStencilState, UINT stencilRef) override;
+		void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* renderTargetViews, ID3D11DepthStencilView* depthStencilView) override;
+		void OMGetRenderTargets(UINT numViews, ID3D11RenderTargetView** renderTargetViews, ID3D11DepthStencilView** depthStencilView) override;
+
+		void ClearRenderTargetView(ID3D11RenderTargetView* renderTargetView, const FLOAT colorRGBA[4]) override;
+		void ClearDepthStencilView(ID3D11DepthStencilView* depthStencilView, UINT clearFlags, FLOAT depth, UINT8 stencil) override;
+
+		void UpdateSubresource(ID3D11Resource* dstResource, UINT dstSubresource, const D3D11_BOX* dstBox, const void* srcData, UINT srcRowPitch, UINT srcDepthPitch) override;
+		// バッファのみ対応（書き込み先として使い捨ての領域を返す）
+		HRESULT Map(ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mappedResource) override;
+		void Unmap(ID3D11Resource* resource, UINT subresource) override;
+
+	private:
+		// 取得された時に返せるよう、最後に設定されたビューポートを覚えておく
+		std::array<D3D11_VIEWPORT, D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE> m_viewports = {};
+		UINT m_numViewports = 0;
+
+		std::vector<uint8_t> m_mapScratch;
+	};
+
+	// 現在の描画先（Application / ヘッドレス実行が差し替える）
+	class ARCHE_API RenderBackend
+	{
+	public:
+		// device はリソース生成用（nullptr なら GPU リソースを作らない）
+		static void Initialize(ID3D11Device* device, std::unique_ptr<IRenderBackend> backend);
+		// 画面を持たない実行向けのデバイスを作る（WARP → ハードウェアの順に試す）
+		static bool CreateOffscreenDevice(ComPtr<ID3D11Device>& device, ComPtr<ID3D11DeviceContext>& context);
+		static void Shutdown();
+
+		static IRenderBackend& Get();
+		static ID3D11Device* GetDevice();
+		static bool IsInitialized();
+
+		// フレームの区切り（集計を確定して 0 から数え直す / メインループの先頭で呼ぶ）
+		static void BeginFrame();
+
+		// 直前に締めたフレームの集計
+		static const RenderStats& GetLastFrameStats();
+	};
+
+}	// namespace Arche
+
+#endif // !___RENDER_BACKEND_H___
@@ -55,6 +55,13 @@ namespace Arche
 	{
 		if (scratchImage.GetImageCount() == 0) return false;
 
+		// デバイスが無い（描画しない実行）なら GPU には送らず、大きさだけを持つ
+		if (!device)
+		{
+			scratchImage.Release();
+			return true;
+		}
+
 		HRESULT hr = DirectX::CreateShaderResourceView(
 			device,
 			scratchImage.GetImages(),
@@ -15,7 +15,7 @@
 
 namespace Arche
 {
-	ID3D11DeviceContext* BillboardRenderer::s_context = nullptr;
+	IRenderBackend* BillboardRenderer::s_backend = nullptr;
 	ID3D11Device* BillboardRenderer::s_device = nullptr;
 
 	ComPtr<ID3D11VertexShader> BillboardRenderer::s_vs = nullptr;
@@ -33,10 +33,10 @@ namespace Arche
 		XMFLOAT2 uv;
 	};
 
-	void BillboardRenderer::Initialize(ID3D11Device* device, ID3D11DeviceContext* context)
+	void BillboardRenderer::Initialize(ID3D11Device* device, IRenderBackend* backend)
 	{
 		s_device = device;
-		s_context = context;
+		s_backend = backend;
 
 		// 1. シェーダーコンパイル (Billboard.hlsl)
 		ComPtr<ID3DBlob> vsBlob, psBlob, errorBlob;
@@ -115,28 +115,28 @@ namespace Arche
 		s_blendState.Reset();
 
 		s_device = nullptr;
-		s_context = nullptr;
+		s_backend = nullptr;
 	}
 
 	void BillboardRenderer::Begin(const XMMATRIX& view, const XMMATRIX& projection) {
-		s_context->IASetInputLayout(s_inputLayout.Get());
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+		s_backend->IASetInputLayout(s_inputLayout.Get());
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 		UINT stride = sizeof(BillboardVertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_vertexBuffer.GetAddressOf(), &stride, &offset);
+		s_backend->IASetVertexBuffers(0, 1, s_vertexBuffer.GetAddressOf(), &stride, &offset);
 
-		s_context->VSSetShader(s_vs.Get(), nullptr, 0);
-		s_context->PSSetShader(s_ps.Get(), nullptr, 0);
+		s_backend->VSSetShader(s_vs.Get(), nullptr, 0);
+		s_backend->PSSetShader(s_ps.Get(), nullptr, 0);
 
-		s_context->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
-		s_context->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
-		s_context->PSSetSamplers(0, 1, s_samplerState.GetAddressOf());
+		s_backend->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->PSSetSamplers(0, 1, s_samplerState.GetAddressOf());
 
-		s_context->RSSetState(s_rsBillboard.Get());
+		s_backend->RSSetState(s_rsBillboard.Get());
 
 		float blendFactor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-		s_context->OMSetBlendState(s_blendState.Get(), blendFactor, 0xffffffff);
+		s_backend->OMSetBlendState(s_blendState.Get(), blendFactor, 0xffffffff);
 
 		// ビュー・プロジェクション行列セット
 		s_cbData.view = XMMatrixTranspose(view);
@@ -154,13 +154,13 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		// 2. テクスチャセット
-		s_context->PSSetShaderResources(0, 1, texture->srv.GetAddressOf());
+		s_backend->PSSetShaderResources(0, 1, texture->srv.GetAddressOf());
 
 		// 3. 描画
-		s_context->Draw(4, 0);
+		s_backend->Draw(4, 0);
 	}
 
 }	// namespace Arche
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 // ===== インクルード =====
 #include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 #include "Engine/Renderer/RHI/Texture.h"
 
 namespace Arche
@@ -22,7 +23,7 @@ namespace Arche
 	class ARCHE_API BillboardRenderer
 	{
 	public:
-		static void Initialize(ID3D11Device* device, ID3D11DeviceContext* context);
+		static void Initialize(ID3D11Device* device, IRenderBackend* backend);
 
 		static void Shutdown();
 
@@ -32,7 +33,7 @@ namespace Arche
 		static void Draw(Texture* texture, const XMFLOAT3& position, float width, float height, const XMFLOAT4& color = { 1,1,1,1 });
 
 	private:
-		static ID3D11DeviceContext* s_context;
+		static IRenderBackend* s_backend;
 		static ID3D11Device* s_device;
 
 		static ComPtr<ID3D11VertexShader> s_vs;
@@ -12,13 +12,13 @@
 // ===== インクルード =====
 #include "Engine/pch.h"
 #include "GridRenderer.h"
-#include "Engine/Core/Application.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 
 namespace Arche
 {
 	void GridRenderer::Initialize()
 	{
-		auto device = Application::Instance().GetDevice();
+		auto device = RenderBackend::GetDevice();
 
 		// 1. シェーダーコンパイル (埋め込みではなくファイル読み込み)
 		// ※パスはプロジェクト構成に合わせて調整してください
@@ -90,7 +90,7 @@ namespace Arche
 
 	void GridRenderer::Render(const XMMATRIX& view, const XMMATRIX& proj, const XMFLOAT3& cameraPos, float farPlane)
 	{
-		auto context = Application::Instance().GetContext();
+		IRenderBackend* backend = &RenderBackend::Get();
 
 		// 定数バッファ更新
 		VSConstantBuffer cb;
@@ -99,35 +99,35 @@ namespace Arche
 		cb.CameraPos = cameraPos;
 		cb.Near = 0.1f;
 		cb.Far = farPlane;
-		context->UpdateSubresource(m_cbVS, 0, nullptr, &cb, 0, 0);
+		backend->UpdateSubresource(m_cbVS, 0, nullptr, &cb, 0, 0);
 
 		GridConstantBuffer gcb;
 		XMMATRIX viewProj = view * proj;
 		XMVECTOR det;
 		gcb.InverseViewProj = XMMatrixTranspose(XMMatrixInverse(&det, viewProj));
-		context->UpdateSubresource(m_cbGrid, 0, nullptr, &gcb, 0, 0);
+		backend->UpdateSubresource(m_cbGrid, 0, nullptr, &gcb, 0, 0);
 
 		// ステート設定
-		context->OMSetBlendState(m_blendState, nullptr, 0xFFFFFFFF);
-		context->OMSetDepthStencilState(m_depthState, 0);
-		context->RSSetState(m_rasterizerState);
+		backend->OMSetBlendState(m_blendState, nullptr, 0xFFFFFFFF);
+		backend->OMSetDepthStencilState(m_depthState, 0);
+		backend->RSSetState(m_rasterizerState);
 
 		// シェーダー設定
-		context->VSSetShader(m_vs, nullptr, 0);
-		context->PSSetShader(m_ps, nullptr, 0);
-		context->VSSetConstantBuffers(0, 1, &m_cbVS);
-		context->VSSetConstantBuffers(1, 1, &m_cbGrid);
-		context->PSSetConstantBuffers(0, 1, &m_cbVS);
+		backend->VSSetShader(m_vs, nullptr, 0);
+		backend->PSSetShader(m_ps, nullptr, 0);
+		backend->VSSetConstantBuffers(0, 1, &m_cbVS);
+		backend->VSSetConstantBuffers(1, 1, &m_cbGrid);
+		backend->PSSetConstantBuffers(0, 1, &m_cbVS);
 
 		// 頂点バッファなしで6頂点描画（Fullscreen Triangle x 2相当）
-		context->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
-		context->IASetInputLayout(nullptr);
-		context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		backend->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
+		backend->IASetInputLayout(nullptr);
+		backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-		context->Draw(3, 0);
+		backend->Draw(3, 0);
 
 		// ステート復元（必要であれば）
-		context->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
-		context->OMSetDepthStencilState(nullptr, 0); // デフォルトに戻す
+		backend->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
+		backend->OMSetDepthStencilState(nullptr, 0); // デフォルトに戻す
 	}
 }
\ No newline at end of file
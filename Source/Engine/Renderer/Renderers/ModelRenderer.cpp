@@ -22,11 +22,12 @@
 #include "ModelRenderer.h"
 #include "Engine/Renderer/RHI/MeshBuffer.h"
 #include "Engine/Core/Base/Logger.h"
+#include "Engine/Core/Profiler/Profiler.h"
 
 namespace Arche
 {
 	ID3D11Device* ModelRenderer::s_device = nullptr;
-	ID3D11DeviceContext* ModelRenderer::s_context = nullptr;
+	IRenderBackend* ModelRenderer::s_backend = nullptr;
 	ComPtr<ID3D11VertexShader> ModelRenderer::s_vs = nullptr;
 	ComPtr<ID3D11PixelShader> ModelRenderer::s_ps = nullptr;
 	ComPtr<ID3D11InputLayout> ModelRenderer::s_inputLayout = nullptr;
@@ -42,10 +43,10 @@ namespace Arche
 	XMMATRIX ModelRenderer::s_lightView = XMMatrixIdentity();
 	XMMATRIX ModelRenderer::s_lightProj = XMMatrixIdentity();
 
-	void ModelRenderer::Initialize(ID3D11Device* device, ID3D11DeviceContext* context)
+	void ModelRenderer::Initialize(ID3D11Device* device, IRenderBackend* backend)
 	{
 		s_device = device;
-		s_context = context;
+		s_backend = backend;
 
 		// --- シェーダーパスの定義 ---
 		// ワイド文字列リテラルで定義
@@ -162,17 +163,17 @@ namespace Arche
 
 	void ModelRenderer::Begin(const XMMATRIX& view, const XMMATRIX& projection, const XMFLOAT3& lightDir, const XMFLOAT3& lightColor)
 	{
-		s_context->IASetInputLayout(s_inputLayout.Get());
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->RSSetState(s_rsSolid.Get());
+		s_backend->IASetInputLayout(s_inputLayout.Get());
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->RSSetState(s_rsSolid.Get());
 
-		s_context->VSSetShader(s_vs.Get(), nullptr, 0);
-		s_context->PSSetShader(s_ps.Get(), nullptr, 0);
+		s_backend->VSSetShader(s_vs.Get(), nullptr, 0);
+		s_backend->PSSetShader(s_ps.Get(), nullptr, 0);
 
-		s_context->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
-		s_context->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
-		s_context->PSSetConstantBuffers(1, 1, s_lightConstantBuffer.GetAddressOf());
-		s_context->PSSetSamplers(0, 1, s_samplerState.GetAddressOf());
+		s_backend->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->PSSetConstantBuffers(1, 1, s_lightConstantBuffer.GetAddressOf());
+		s_backend->PSSetSamplers(0, 1, s_samplerState.GetAddressOf());
 
 		s_cbData.view = XMMatrixTranspose(view);
 		s_cbData.projection = XMMatrixTranspose(projection);
@@ -181,8 +182,8 @@ namespace Arche
 
 		if (s_shadowSRV)
 		{
-			s_context->PSSetShaderResources(1, 1, s_shadowSRV.GetAddressOf());
-			s_context->PSSetSamplers(1, 1, s_shadowSampler.GetAddressOf());
+			s_backend->PSSetShaderResources(1, 1, s_shadowSRV.GetAddressOf());
+			s_backend->PSSetSamplers(1, 1, s_shadowSampler.GetAddressOf());
 		}
 		// 定数バッファへセット
 		s_cbData.lightView = XMMatrixTranspose(s_lightView);
@@ -206,7 +207,7 @@ namespace Arche
 		}
 
 		// 定数バッファ更新
-		s_context->UpdateSubresource(s_lightConstantBuffer.Get(), 0, nullptr, &s_lightData, 0, 0);
+		s_backend->UpdateSubresource(s_lightConstantBuffer.Get(), 0, nullptr, &s_lightData, 0, 0);
 	}
 
 	void ModelRenderer::SetShadowMap(ID3D11ShaderResourceView* srv)
@@ -235,6 +236,7 @@ namespace Arche
 
 	void ModelRenderer::Draw(std::shared_ptr<Model> model, const DirectX::XMMATRIX& worldMatrix)
 	{
+		ARCHE_PROFILE_FUNCTION();
 		if (!model) return;
 
 		// ワールド行列更新
@@ -274,10 +276,10 @@ namespace Arche
 			}
 			
 			// 定数バッファ更新
-			s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+			s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 			// テクスチャセット
-			s_context->PSSetShaderResources(0, 1, &srv);
+			s_backend->PSSetShaderResources(0, 1, &srv);
 
 			// 描画
 			if (mesh.pMesh) mesh.pMesh->Draw();
@@ -22,6 +22,7 @@
 
 // ===== インクルード =====
 #include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 #include "Engine/Renderer/Data/Model.h"
 
 namespace Arche
@@ -68,7 +69,7 @@ namespace Arche
 		};
 
 	public:
-		static void Initialize(ID3D11Device* device, ID3D11DeviceContext* context);
+		static void Initialize(ID3D11Device* device, IRenderBackend* backend);
 		static void Shutdown();
 
 		static void Begin(const XMMATRIX& view, const XMMATRIX& projection, const XMFLOAT3& lightDir, const XMFLOAT3& lightColor);
@@ -86,7 +87,7 @@ namespace Arche
 
 	private:
 		static ID3D11Device* s_device;
-		static ID3D11DeviceContext* s_context;
+		static IRenderBackend* s_backend;
 
 		static ComPtr<ID3D11VertexShader> s_vs;
 		static ComPtr<ID3D11PixelShader> s_ps;
@@ -14,7 +14,7 @@ namespace Arche
 {
 	// 静的メンバ変数初期化
 	ID3D11Device* PrimitiveRenderer::s_device = nullptr;
-	ID3D11DeviceContext* PrimitiveRenderer::s_context = nullptr;
+	IRenderBackend* PrimitiveRenderer::s_backend = nullptr;
 
 	ComPtr<ID3D11VertexShader>	PrimitiveRenderer::s_vs = nullptr;
 	ComPtr<ID3D11PixelShader>	PrimitiveRenderer::s_ps = nullptr;
@@ -66,10 +66,10 @@ namespace Arche
 		XMFLOAT3 position;
 	};
 
-	void PrimitiveRenderer::Initialize(ID3D11Device* device, ID3D11DeviceContext* context)
+	void PrimitiveRenderer::Initialize(ID3D11Device* device, IRenderBackend* backend)
 	{
 		s_device = device;
-		s_context = context;
+		s_backend = backend;
 
 		// 1. シェーダーコンパイル
 		ComPtr<ID3DBlob> vsBlob, psBlob, errorBlob;
@@ -162,19 +162,19 @@ namespace Arche
 		s_diamondVB.Reset(); s_diamondIB.Reset();
 
 		s_device = nullptr;
-		s_context = nullptr;
+		s_backend = nullptr;
 	}
 
 	void PrimitiveRenderer::Begin(const XMMATRIX& view, const XMMATRIX& projection)
 	{
-		s_context->IASetInputLayout(s_inputLayout.Get());
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->OMSetDepthStencilState(s_depthState.Get(), 0);
+		s_backend->IASetInputLayout(s_inputLayout.Get());
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->OMSetDepthStencilState(s_depthState.Get(), 0);
 
-		s_context->VSSetShader(s_vs.Get(), nullptr, 0);
-		s_context->PSSetShader(s_ps.Get(), nullptr, 0);
-		s_context->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
-		s_context->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->VSSetShader(s_vs.Get(), nullptr, 0);
+		s_backend->PSSetShader(s_ps.Get(), nullptr, 0);
+		s_backend->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
 
 		s_cbData.view = XMMatrixTranspose(view);
 		s_cbData.projection = XMMatrixTranspose(projection);
@@ -182,7 +182,7 @@ namespace Arche
 
 	void PrimitiveRenderer::SetFillMode(bool wireframe)
 	{
-		s_context->RSSetState(wireframe ? s_rsWireframe.Get() : s_rsSolid.Get());
+		s_backend->RSSetState(wireframe ? s_rsWireframe.Get() : s_rsSolid.Get());
 	}
 
 	// =================================================================
@@ -196,14 +196,14 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_vertexBuffer.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_indexBuffer.Get(), DXGI_FORMAT_R16_UINT, 0);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(36, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_vertexBuffer.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_indexBuffer.Get(), DXGI_FORMAT_R16_UINT, 0);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(36, 0, 0);
 
 		if (wireframe) SetFillMode(false); // Restore
 	}
@@ -215,14 +215,14 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_sphereVB.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_sphereIB.Get(), DXGI_FORMAT_R16_UINT, 0);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(s_sphereIndexCount, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_sphereVB.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_sphereIB.Get(), DXGI_FORMAT_R16_UINT, 0);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(s_sphereIndexCount, 0, 0);
 
 		if (wireframe) SetFillMode(false);
 	}
@@ -234,14 +234,14 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_cylinderVB.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_cylinderIB.Get(), DXGI_FORMAT_R16_UINT, 0);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(s_cylinderIndexCount, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_cylinderVB.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_cylinderIB.Get(), DXGI_FORMAT_R16_UINT, 0);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(s_cylinderIndexCount, 0, 0);
 
 		if (wireframe) SetFillMode(false);
 	}
@@ -253,14 +253,14 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_capsuleVB.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_capsuleIB.Get(), DXGI_FORMAT_R16_UINT, 0);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(s_capsuleIndexCount, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_capsuleVB.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_capsuleIB.Get(), DXGI_FORMAT_R16_UINT, 0);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(s_capsuleIndexCount, 0, 0);
 
 		if (wireframe) SetFillMode(false);
 	}
@@ -272,14 +272,14 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_pyramidVB.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_pyramidIB.Get(), DXGI_FORMAT_R32_UINT, 0); // 32bit index for robust
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(s_pyramidIndexCount, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_pyramidVB.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_pyramidIB.Get(), DXGI_FORMAT_R32_UINT, 0); // 32bit index for robust
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(s_pyramidIndexCount, 0, 0);
 
 		if (wireframe) SetFillMode(false);
 	}
@@ -291,14 +291,14 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_coneVB.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_coneIB.Get(), DXGI_FORMAT_R32_UINT, 0);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(s_coneIndexCount, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_coneVB.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_coneIB.Get(), DXGI_FORMAT_R32_UINT, 0);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(s_coneIndexCount, 0, 0);
 
 		if (wireframe) SetFillMode(false);
 	}
@@ -310,14 +310,14 @@ namespace Arche
 
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_torusVB.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_torusIB.Get(), DXGI_FORMAT_R32_UINT, 0);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(s_torusIndexCount, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_torusVB.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_torusIB.Get(), DXGI_FORMAT_R32_UINT, 0);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(s_torusIndexCount, 0, 0);
 
 		if (wireframe) SetFillMode(false);
 	}
@@ -327,14 +327,14 @@ namespace Arche
 		SetFillMode(wireframe);
 		s_cbData.world = XMMatrixTranspose(world);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_diamondVB.GetAddressOf(), &stride, &offset);
-		s_context->IASetIndexBuffer(s_diamondIB.Get(), DXGI_FORMAT_R32_UINT, 0);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		s_context->DrawIndexed(s_diamondIndexCount, 0, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_diamondVB.GetAddressOf(), &stride, &offset);
+		s_backend->IASetIndexBuffer(s_diamondIB.Get(), DXGI_FORMAT_R32_UINT, 0);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->DrawIndexed(s_diamondIndexCount, 0, 0);
 
 		if (wireframe) SetFillMode(false);
 	}
@@ -421,22 +421,22 @@ namespace Arche
 	{
 		s_cbData.world = XMMatrixIdentity();
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		D3D11_MAPPED_SUBRESOURCE ms;
-		if (SUCCEEDED(s_context->Map(s_lineVertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &ms)))
+		if (SUCCEEDED(s_backend->Map(s_lineVertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &ms)))
 		{
 			Vertex* v = (Vertex*)ms.pData;
 			v[0].position = p1;
 			v[1].position = p2;
-			s_context->Unmap(s_lineVertexBuffer.Get(), 0);
+			s_backend->Unmap(s_lineVertexBuffer.Get(), 0);
 		}
 
 		UINT stride = sizeof(Vertex);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_lineVertexBuffer.GetAddressOf(), &stride, &offset);
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
-		s_context->Draw(2, 0);
+		s_backend->IASetVertexBuffers(0, 1, s_lineVertexBuffer.GetAddressOf(), &stride, &offset);
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+		s_backend->Draw(2, 0);
 	}
 
 	void PrimitiveRenderer::DrawArrow(const XMFLOAT3& start, const XMFLOAT3& end, const XMFLOAT4& color)
@@ -14,6 +14,7 @@
 
  // ===== インクルード =====
 #include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 
 namespace Arche
 {
@@ -24,9 +25,9 @@ namespace Arche
 		/**
 		 * @brief	初期化
 		 * @param	device	デバイス
-		 * @param	context	コンテキスト
+		 * @param	backend	描画コマンドの発行先
 		 */
-		static void Initialize(ID3D11Device* device, ID3D11DeviceContext* context);
+		static void Initialize(ID3D11Device* device, IRenderBackend* backend);
 
 		static void Shutdown();
 
@@ -74,7 +75,7 @@ namespace Arche
 		// 座標軸を描画
 		static void DrawAxis(float length = 5.0f);
 
-		static ID3D11DeviceContext* GetDeviceContext() { return s_context; }
+		static IRenderBackend* GetBackend() { return s_backend; }
 
 	private:
 		// メッシュ生成ヘルパー
@@ -101,7 +102,7 @@ namespace Arche
 
 		// 静的メンバ変数
 		static ID3D11Device* s_device;
-		static ID3D11DeviceContext* s_context;
+		static IRenderBackend* s_backend;
 
 		static ComPtr<ID3D11VertexShader>	s_vs;
 		static ComPtr<ID3D11PixelShader>	s_ps;
@@ -17,17 +17,17 @@
 namespace Arche
 {
 	ID3D11Device* ShadowRenderer::s_device = nullptr;
-	ID3D11DeviceContext* ShadowRenderer::s_context = nullptr;
+	IRenderBackend* ShadowRenderer::s_backend = nullptr;
 	ComPtr<ID3D11VertexShader> ShadowRenderer::s_vs = nullptr;
 	ComPtr<ID3D11PixelShader> ShadowRenderer::s_ps = nullptr;
 	ComPtr<ID3D11InputLayout> ShadowRenderer::s_inputLayout = nullptr;
 	ComPtr<ID3D11Buffer> ShadowRenderer::s_constantBuffer = nullptr;
 	ShadowRenderer::CBData ShadowRenderer::s_cbData = {};
 
-	void ShadowRenderer::Initialize(ID3D11Device* device, ID3D11DeviceContext* context)
+	void ShadowRenderer::Initialize(ID3D11Device* device, IRenderBackend* backend)
 	{
 		s_device = device;
-		s_context = context;
+		s_backend = backend;
 
 		std::wstring shaderPath = L"Resources/Engine/Shaders/ShadowMap.hlsl";
 
@@ -77,14 +77,14 @@ namespace Arche
 
 	void ShadowRenderer::Begin(const XMMATRIX& lightView, const XMMATRIX& lightProj)
 	{
-		s_context->IASetInputLayout(s_inputLayout.Get());
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		s_backend->IASetInputLayout(s_inputLayout.Get());
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-		s_context->VSSetShader(s_vs.Get(), nullptr, 0);
+		s_backend->VSSetShader(s_vs.Get(), nullptr, 0);
 		// 深度のみならPSはnullptrでも良いが、今回は空のPSを使用
-		s_context->PSSetShader(s_ps.Get(), nullptr, 0);
+		s_backend->PSSetShader(s_ps.Get(), nullptr, 0);
 
-		s_context->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
 
 		// 共通データのセット
 		s_cbData.view = XMMatrixTranspose(lightView);
@@ -119,7 +119,7 @@ namespace Arche
 			}
 
 			// バッファ更新 & 描画
-			s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+			s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 			if (mesh.pMesh) mesh.pMesh->Draw();
 		}
 	}
@@ -14,6 +14,7 @@
 
 // ===== インクルード =====
 #include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 #include "Engine/Renderer/Data/Model.h"
 
 namespace Arche
@@ -32,7 +33,7 @@ namespace Arche
 			float padding[3];
 		};
 
-		static void Initialize(ID3D11Device* device, ID3D11DeviceContext* context);
+		static void Initialize(ID3D11Device* device, IRenderBackend* backend);
 		static void Shutdown();
 
 		// 描画開始 (ライトのビュー・プロジェクション行列を渡す)
@@ -43,7 +44,7 @@ namespace Arche
 
 	private:
 		static ID3D11Device* s_device;
-		static ID3D11DeviceContext* s_context;
+		static IRenderBackend* s_backend;
 
 		static ComPtr<ID3D11VertexShader> s_vs;
 		static ComPtr<ID3D11InputLayout> s_inputLayout;
@@ -12,13 +12,13 @@
 // ===== インクルード =====
 #include "Engine/pch.h"
 #include "SkyboxRenderer.h"
-#include "Engine/Core/Application.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 
 namespace Arche
 {
 	void SkyboxRenderer::Initialize()
 	{
-		auto device = Application::Instance().GetDevice();
+		auto device = RenderBackend::GetDevice();
 
 		// 1. シェーダーコンパイル
 		std::wstring shaderPath = L"Resources/Engine/Shaders/Skybox.hlsl";
@@ -84,7 +84,7 @@ namespace Arche
 	{
 		if (!m_cbVS) return;
 
-		auto context = Application::Instance().GetContext();
+		IRenderBackend* backend = &RenderBackend::Get();
 
 		XMMATRIX viewNoTrans = view;
 		viewNoTrans.r[3] = XMVectorSet(0, 0, 0, 1);
@@ -103,42 +103,42 @@ namespace Arche
 		cb.ColorHorizon = env.skyColorHorizon;
 		cb.ColorBottom = env.skyColorBottom;
 
-		context->UpdateSubresource(m_cbVS, 0, nullptr, &cb, 0, 0);
+		backend->UpdateSubresource(m_cbVS, 0, nullptr, &cb, 0, 0);
 
 		// ステート設定
-		context->OMSetDepthStencilState(m_depthState, 0);
-		context->RSSetState(m_rasterizerState);
+		backend->OMSetDepthStencilState(m_depthState, 0);
+		backend->RSSetState(m_rasterizerState);
 
 		// シェーダー設定
-		context->VSSetShader(m_vs, nullptr, 0);
-		context->PSSetShader(m_ps, nullptr, 0);
-		context->VSSetConstantBuffers(0, 1, &m_cbVS);
-		context->PSSetConstantBuffers(0, 1, &m_cbVS);
+		backend->VSSetShader(m_vs, nullptr, 0);
+		backend->PSSetShader(m_ps, nullptr, 0);
+		backend->VSSetConstantBuffers(0, 1, &m_cbVS);
+		backend->PSSetConstantBuffers(0, 1, &m_cbVS);
 
 		// テクスチャ設定
 		if (hasTexture)
 		{
 			ID3D11ShaderResourceView* srv = m_skyboxTexture->GetSRV();
-			context->PSSetShaderResources(0, 1, &srv);
-			context->PSSetSamplers(0, 1, &m_samplerState);
+			backend->PSSetShaderResources(0, 1, &srv);
+			backend->PSSetSamplers(0, 1, &m_samplerState);
 		}
 		else
 		{
 			// テクスチャ解除
 			ID3D11ShaderResourceView* nullSRV = nullptr;
-			context->PSSetShaderResources(0, 1, &nullSRV);
+			backend->PSSetShaderResources(0, 1, &nullSRV);
 		}
 
 		// 描画 (36頂点)
-		context->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
-		context->IASetInputLayout(nullptr);
-		context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		backend->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
+		backend->IASetInputLayout(nullptr);
+		backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-		context->Draw(36, 0);
+		backend->Draw(36, 0);
 
 		// ステート復元
-		context->OMSetDepthStencilState(nullptr, 0);
+		backend->OMSetDepthStencilState(nullptr, 0);
 		ID3D11ShaderResourceView* nullSRV = nullptr;
-		context->PSSetShaderResources(0, 1, &nullSRV); // バインド解除
+		backend->PSSetShaderResources(0, 1, &nullSRV); // バインド解除
 	}
 }
\ No newline at end of file
@@ -18,7 +18,7 @@ namespace Arche
 {
 	// 静的メンバ定義
 	ID3D11Device* SpriteRenderer::s_device = nullptr;
-	ID3D11DeviceContext* SpriteRenderer::s_context = nullptr;
+	IRenderBackend* SpriteRenderer::s_backend = nullptr;
 	float SpriteRenderer::s_screenWidth = 0.0f;
 	float SpriteRenderer::s_screenHeight = 0.0f;
 	ComPtr<ID3D11VertexShader> SpriteRenderer::s_vs = nullptr;
@@ -37,10 +37,10 @@ namespace Arche
 		XMFLOAT2 uv;
 	};
 
-	void SpriteRenderer::Initialize(ID3D11Device* device, ID3D11DeviceContext* context, float w, float h)
+	void SpriteRenderer::Initialize(ID3D11Device* device, IRenderBackend* backend, float w, float h)
 	{
 		s_device = device;
-		s_context = context;
+		s_backend = backend;
 		s_screenWidth = w;
 		s_screenHeight = h;
 
@@ -129,31 +129,31 @@ namespace Arche
 		s_samplerState.Reset();
 
 		s_device = nullptr;
-		s_context = nullptr;
+		s_backend = nullptr;
 	}
 
 	void SpriteRenderer::Begin()
 	{
 		// 2D用のパイプライン設定
-		s_context->IASetInputLayout(s_inputLayout.Get());
-		s_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP); // ストリップ
+		s_backend->IASetInputLayout(s_inputLayout.Get());
+		s_backend->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP); // ストリップ
 
 		UINT stride = sizeof(Vertex2D);
 		UINT offset = 0;
-		s_context->IASetVertexBuffers(0, 1, s_vertexBuffer.GetAddressOf(), &stride, &offset);
+		s_backend->IASetVertexBuffers(0, 1, s_vertexBuffer.GetAddressOf(), &stride, &offset);
 
-		s_context->VSSetShader(s_vs.Get(), nullptr, 0);
-		s_context->PSSetShader(s_ps.Get(), nullptr, 0);
+		s_backend->VSSetShader(s_vs.Get(), nullptr, 0);
+		s_backend->PSSetShader(s_ps.Get(), nullptr, 0);
 
-		s_context->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
-		s_context->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->VSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
+		s_backend->PSSetConstantBuffers(0, 1, s_constantBuffer.GetAddressOf());
 
 		// サンプラーセット
-		s_context->PSSetSamplers(0, 1, s_samplerState.GetAddressOf());
+		s_backend->PSSetSamplers(0, 1, s_samplerState.GetAddressOf());
 
 		// ブレンドステートセット
 		float blendFactor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-		s_context->OMSetBlendState(s_blendState.Get(), blendFactor, 0xffffffff);
+		s_backend->OMSetBlendState(s_blendState.Get(), blendFactor, 0xffffffff);
 
 		// 2D正射影行列 (左上0,0 ～ 右下W,H)
 		// Z範囲は 0.0～1.0
@@ -161,8 +161,8 @@ namespace Arche
 		float h = static_cast<float>(Config::SCREEN_HEIGHT);
 		s_cbData.projection = XMMatrixTranspose(XMMatrixOrthographicLH(w, h, 0.0f, 100.0f));
 
-		s_context->RSSetState(s_rs2D.Get());
-		s_context->OMSetDepthStencilState(s_ds2D.Get(), 0);
+		s_backend->RSSetState(s_rs2D.Get());
+		s_backend->OMSetDepthStencilState(s_ds2D.Get(), 0);
 	}
 
 	void SpriteRenderer::Draw(Texture* texture, const XMMATRIX& worldMatrix, const XMFLOAT4& color) {
@@ -173,7 +173,7 @@ namespace Arche
 
 		// 頂点データの更新 (4頂点)
 		D3D11_MAPPED_SUBRESOURCE ms;
-		if (SUCCEEDED(s_context->Map(s_vertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &ms)))
+		if (SUCCEEDED(s_backend->Map(s_vertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &ms)))
 		{
 			Vertex2D* v = (Vertex2D*)ms.pData;
 
@@ -187,19 +187,19 @@ namespace Arche
 			v[1] = { XMFLOAT3(1, 0, 0), XMFLOAT2(1, 1) }; // 右上
 			v[2] = { XMFLOAT3(0, 1, 0), XMFLOAT2(0, 0) }; // 左下
 			v[3] = { XMFLOAT3(1, 1, 0), XMFLOAT2(1, 0) }; // 右下
-			s_context->Unmap(s_vertexBuffer.Get(), 0);
+			s_backend->Unmap(s_vertexBuffer.Get(), 0);
 		}
 
 		// テクスチャセット
-		s_context->PSSetShaderResources(0, 1, texture->srv.GetAddressOf());
+		s_backend->PSSetShaderResources(0, 1, texture->srv.GetAddressOf());
 
 		// 定数バッファ更新
 		s_cbData.world = XMMatrixTranspose(worldMatrix);
 		s_cbData.color = color;
-		s_context->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
+		s_backend->UpdateSubresource(s_constantBuffer.Get(), 0, nullptr, &s_cbData, 0, 0);
 
 		// 描画
-		s_context->Draw(4, 0);
+		s_backend->Draw(4, 0);
 	}
 
 }	// namespace Arche
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 // ===== インクルード =====
 #include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 #include "Engine/Renderer/RHI/Texture.h"
 
 namespace Arche
@@ -22,7 +23,7 @@ namespace Arche
 	class ARCHE_API SpriteRenderer
 	{
 	public:
-		static void Initialize(ID3D11Device* device, ID3D11DeviceContext* context, float screenW, float screenH);
+		static void Initialize(ID3D11Device* device, IRenderBackend* backend, float screenW, float screenH);
 
 		// 終了処理
 		static void Shutdown();
@@ -35,7 +36,7 @@ namespace Arche
 
 	private:
 		static ID3D11Device*		s_device;
-		static ID3D11DeviceContext*	s_context;
+		static IRenderBackend*	s_backend;
 		static float s_screenWidth;
 		static float s_screenHeight;
 
@@ -27,15 +27,15 @@ namespace Arche
 {
 	// 静的メンバ定義
 	ID3D11Device* TextRenderer::s_device = nullptr;
-	ID3D11DeviceContext* TextRenderer::s_context = nullptr;
+	IRenderBackend* TextRenderer::s_backend = nullptr;
 	ComPtr<ID2D1Factory> TextRenderer::s_d2dFactory;
 	ComPtr<ID2D1SolidColorBrush> TextRenderer::s_brush;
 	std::unordered_map<ID3D11RenderTargetView*, ComPtr<ID2D1RenderTarget>> TextRenderer::s_d2dTargets;
 
-	void TextRenderer::Initialize(ID3D11Device* device, ID3D11DeviceContext* context)
+	void TextRenderer::Initialize(ID3D11Device* device, IRenderBackend* backend)
 	{
 		s_device = device;
-		s_context = context;
+		s_backend = backend;
 
 		// FontManager初期化
 		FontManager::Instance().Initialize();
@@ -51,7 +51,7 @@ namespace Arche
 		s_d2dFactory.Reset();
 
 		s_device = nullptr;
-		s_context = nullptr;
+		s_backend = nullptr;
 	}
 
 	void TextRenderer::ClearCache()
@@ -68,24 +68,24 @@ namespace Arche
 		ComPtr<ID3D11DepthStencilView> currentDSV;
 		if (!rtv)
 		{
-			s_context->OMGetRenderTargets(1, currentRTV.GetAddressOf(), currentDSV.GetAddressOf());
+			s_backend->OMGetRenderTargets(1, currentRTV.GetAddressOf(), currentDSV.GetAddressOf());
 			rtv = currentRTV.Get();
 		}
 		else
 		{
 			// rtvが引数で渡された場合も、現在バインドされているDSVを取得しておく必要がある
 			ComPtr<ID3D11RenderTargetView> tempRTV;
-			s_context->OMGetRenderTargets(1, tempRTV.GetAddressOf(), currentDSV.GetAddressOf());
+			s_backend->OMGetRenderTargets(1, tempRTV.GetAddressOf(), currentDSV.GetAddressOf());
 		}
 		if (!rtv) return;
 
-		s_context->OMSetRenderTargets(1, &rtv, nullptr);
+		s_backend->OMSetRenderTargets(1, &rtv, nullptr);
 
 		// D2Dレンダーターゲット取得
 		ID2D1RenderTarget* d2dRT = GetD2DRenderTarget(rtv);
 		if (!d2dRT)
 		{
-			s_context->OMSetRenderTargets(1, &rtv, currentDSV.Get());
+			s_backend->OMSetRenderTargets(1, &rtv, currentDSV.Get());
 			return;
 		}
 
@@ -125,7 +125,7 @@ namespace Arche
 		// --------------------------------------------------------
 		// ECSループ
 		// --------------------------------------------------------
-		registry.view<TextComponent>().each([&](Entity e, TextComponent& text)
+		registry.view<const TextComponent>().each([&](Entity e, const TextComponent& text)
 			{
 				if (text.text.empty() || text.color.w <= 0.0f) return;
 
@@ -137,7 +137,7 @@ namespace Arche
 				// =================================================================
 				if (registry.has<Transform2D>(e))
 				{
-					auto& t2d = registry.get<Transform2D>(e);
+					auto& t2d = registry.read<Transform2D>(e);
 					// UISystemで計算済みの行列を取得 (Y-Up, Center Origin)
 					D2D1::Matrix3x2F worldMat = D2D1::Matrix3x2F(
 						t2d.worldMatrix._11, t2d.worldMatrix._12,
@@ -169,7 +169,7 @@ namespace Arche
 				// =================================================================
 				else if (registry.has<Transform>(e))
 				{
-					auto& t3d = registry.get<Transform>(e);
+					auto& t3d = registry.read<Transform>(e);
 					XMVECTOR worldPos = XMLoadFloat3(&t3d.position);
 
 					XMVECTOR viewPos = XMVector3TransformCoord(worldPos, view);
@@ -271,7 +271,7 @@ namespace Arche
 		d2dRT->SetTransform(D2D1::Matrix3x2F::Identity());
 		d2dRT->EndDraw();
 
-		s_context->OMSetRenderTargets(1, &rtv, currentDSV.Get());
+		s_backend->OMSetRenderTargets(1, &rtv, currentDSV.Get());
 	}
 
 	ID2D1RenderTarget* TextRenderer::GetD2DRenderTarget(ID3D11RenderTargetView* rtv)
@@ -22,6 +22,7 @@
 
 // ===== インクルード =====
 #include "Engine/pch.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
 #include "Engine/Scene/Core/ECS/ECS.h"
 #include "Engine/Renderer/Text/FontManager.h"
 
@@ -37,9 +38,9 @@ namespace Arche
 		/**
 		 * @brief	静的初期化
 		 * @param	device	デバイス
-		 * @param	context	コンテキスト
+		 * @param	backend	描画コマンドの発行先
 		 */
-		static void Initialize(ID3D11Device* device, ID3D11DeviceContext* context);
+		static void Initialize(ID3D11Device* device, IRenderBackend* backend);
 
 		/**
 		 * @brief	終了処理（キャッシュ解放）
@@ -63,7 +64,7 @@ namespace Arche
 	private:
 		// 静的メンバ変数
 		static ID3D11Device* s_device;
-		static ID3D11DeviceContext* s_context;
+		static IRenderBackend* s_backend;
 
 		// D2Dリソース
 		static ComPtr<ID2D1Factory> s_d2dFactory;
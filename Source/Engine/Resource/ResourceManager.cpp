@@ -21,6 +21,7 @@
 #include "Engine/pch.h"
 #include "Engine/Resource/ResourceManager.h"
 #include "Engine/Core/Base/Logger.h"
+#include "Engine/Core/Profiler/Profiler.h"
 #include "Engine/Renderer/RHI/Texture.h"
 #include "Engine/Renderer/Data/Model.h"
 #include "Engine/Audio/Sound.h"
@@ -116,6 +117,7 @@ namespace Arche
 	// --------------------------------------------------------
 	void ResourceManager::Update()
 	{
+		ARCHE_PROFILE_FUNCTION();
 		if (m_tasks.empty()) return;
 
 		// 先頭のタスクを取得 (ポインタへの参照)
@@ -266,6 +268,14 @@ namespace Arche
 	// 内部処理
 	// --------------------------------------------------------
 	void ResourceManager::CreateSystemTextures() {
+		// デバイスが無い（描画しない実行）なら、参照だけできるよう中身の無いテクスチャを置く
+		if (!m_device) {
+			auto tex = std::make_shared<Texture>();
+			tex->filepath = "System::White"; tex->width = 1; tex->height = 1;
+			m_textures["White"] = tex;
+			return;
+		}
+
 		uint32_t pixel = 0xFFFFFFFF;
 		D3D11_SUBRESOURCE_DATA initData = { &pixel, sizeof(uint32_t), 0 };
 		D3D11_TEXTURE2D_DESC desc = {};
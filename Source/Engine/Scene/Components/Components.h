@@ -73,6 +73,7 @@ namespace Arche
 		bool operator==(const Tag& other) const { return tag == other.tag; }
 		bool operator==(const StringId& strId) const { return tag == strId; }
 	};
+	ARCHE_PAGED_STORAGE(Tag, 128, StorageResource::Pool)	// 全員が持つため、増加時の一斉ムーブを避ける
 	ARCHE_COMPONENT(Tag, REFLECT_VAR(name) REFLECT_VAR(tag) REFLECT_VAR(componentOrder))
 
 	/**
@@ -110,17 +111,21 @@ namespace Arche
 
 	/**
 	 * @struct	Relationship
-	 * @brief	親子関係
+	 * @brief	親子関係（先頭の子 / 兄弟を直接繋ぐ侵入型リスト）
+	 * @details	繋ぎ替えは Hierarchy を通して行う（メンバーを直接書き換えない）
+	 *			保存するのは parent のみ（子の並びはシーン保存時に別途書き出す）
 	 */
 	struct Relationship
 	{
 		Entity parent = NullEntity;
-		std::vector<Entity> children;
-
-		Relationship() : parent(NullEntity) {}
-		Relationship(Entity p) : parent(p) {}
+		Entity firstChild = NullEntity;
+		Entity lastChild = NullEntity;
+		Entity prevSibling = NullEntity;
+		Entity nextSibling = NullEntity;
+		uint32_t childCount = 0;
+		uint32_t depth = 0;		// ルートが 0
 	};
-	ARCHE_COMPONENT(Relationship, REFLECT_VAR(parent) REFLECT_VAR(children))
+	ARCHE_COMPONENT(Relationship, REFLECT_VAR(parent))
 
 	/**
 	 * @struct	Lifetime
@@ -471,6 +476,27 @@ namespace Arche
 		}
 	};
 
+	/**
+	 * @struct	TransformInterpolation
+	 * @brief	固定ステップ間の補間用（直前とその前のステップ終了時の Transform）
+	 * @details	Static 以外の Rigidbody を持つエンティティに、固定ステップの開始時に自動で追加される（保存はしない）
+	 */
+	struct TransformInterpolation
+	{
+		// 1つ前のステップ終了時
+		XMFLOAT3 prevPosition = { 0.0f, 0.0f, 0.0f };
+		XMFLOAT3 prevRotation = { 0.0f, 0.0f, 0.0f };
+		XMFLOAT3 prevScale = { 1.0f, 1.0f, 1.0f };
+
+		// 直前のステップ終了時
+		XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
+		XMFLOAT3 rotation = { 0.0f, 0.0f, 0.0f };
+		XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
+
+		// 1度でもステップを終えたか
+		bool valid = false;
+	};
+
 	// ============================================================
 	// ゲームロジック・入力
 	// ============================================================
@@ -510,6 +536,7 @@ namespace Arche
 			: modelKey(key), scaleOffset(scale), color(c) {
 		}
 	};
+	ARCHE_PAGED_STORAGE(MeshComponent, 128, StorageResource::Pool)
 	ARCHE_COMPONENT(MeshComponent, REFLECT_VAR(modelKey) REFLECT_VAR(scaleOffset) REFLECT_VAR(color))
 
 	/**
@@ -769,6 +796,7 @@ namespace Arche
 		int GetInt(const std::string& name) { return ints[name]; }
 		bool GetBool(const std::string& name) { return bools[name]; }
 	};
+	ARCHE_PAGED_STORAGE(Animator, 64, StorageResource::Pool)	// パラメータの map を多く持つため大きい
 	ARCHE_COMPONENT(Animator, REFLECT_VAR(controllerPath) REFLECT_VAR(currentState) REFLECT_VAR(isPlaying))
 
 	/**
@@ -13,6 +13,7 @@
 #include "Engine/pch.h"
 #include "ECS.h"
 #include "Engine/Scene/Components/Components.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 
 namespace Arche
 {
@@ -20,6 +21,9 @@ namespace Arche
 	{
 		static std::unordered_map<std::string, std::size_t> types;
 		static std::size_t count = 0;
+		// 並列実行中のシステム（CommandBuffer 等）から初めて呼ばれる場合がある
+		static std::mutex mutex;
+		std::lock_guard<std::mutex> lock(mutex);
 
 		std::string key = typeName;
 		if (types.find(key) == types.end())
@@ -29,25 +33,29 @@ namespace Arche
 		return types[key];
 	}
 
-	EntityHandle& EntityHandle::setParent(Entity parentId)
+	SystemTicks& ChangeTicks::Current()
 	{
-		// 1. 自分にRelationshipを追加
-		if (!registry->has<Relationship>(entity))
-		{
-			registry->emplace<Relationship>(entity);
-		}
-		auto& myRel = registry->get<Relationship>(entity);
-		myRel.parent = parentId;
+		// DLL 境界を越えて同じスレッドローカルを共有するため、実体はここに置く
+		thread_local SystemTicks ticks;
+		return ticks;
+	}
 
-		// 2. 親のRelationshipを取得
-		if (!registry->has<Relationship>(parentId))
-		{
-			registry->emplace<Relationship>(parentId);
-		}
-		auto& parentRel = registry->get<Relationship>(parentId);
+	std::vector<IEventQueue*>& EventQueueList::List()
+	{
+		static std::vector<IEventQueue*> list;
+		return list;
+	}
+
+	std::mutex& EventQueueList::Mutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
 
-		// 3. 親の子リストに自分を追加
-		parentRel.children.push_back(entity);
+	EntityHandle& EntityHandle::setParent(Entity parentId)
+	{
+		// 親子リストの繋ぎ替えと Active 状態の更新は Hierarchy が行う
+		Hierarchy::SetParent(*registry, entity, parentId);
 
 		return *this;	// チェーン出来るように自分を返す
 	}
@@ -4,11 +4,17 @@
  *
  * @details
  * 機能：
+ * - Entity: 世代付きハンドル（インデックス + 世代）
  * - SparseSet: データの密な管理
- * - Signal: イベント通知（追加/削除/更新）
+ * - Signal: イベント通知（追加/削除/更新 / Delegate による確保なしの呼び出し）
  * - Observer: 変更検知（リアクティブシステム用）
- * - Dispatcher: グローバルイベントバス
+ * - Dispatcher: グローバルイベントバス（即時 / 型ごとのキュー）
  * - View Exclude: 除外フィルタリング
+ * - Group: 所有型グループ（コンポーネント配列の先頭に整列）
+ * - Query: 差分更新される永続クエリ
+ * - CommandBuffer: 構造変更の遅延実行（スレッドごとに記録）
+ * - par_each: JobSystem による View / Query / Group の並列走査
+ * - 変更ティック: 書き込みアクセスの記録と changed / added フィルタ
  * - Patch: 更新通知の手動発火
  *
  * ------------------------------------------------------------
@@ -28,10 +34,50 @@
 #define ___ECS_H___
 
 // ===== インクルード =====
+#ifdef ARCHE_ECS_STANDALONE
+// エンジン本体（Windows / DirectX）を使わずにECSのみを利用する場合（ベンチマーク等）
+// ※ System / World はエンジンに依存するため除外される
+#include <vector>
+#include <array>
+#include <deque>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <unordered_map>
+#include <functional>
+#include <typeinfo>
+#include <typeindex>
+#include <type_traits>
+#include <utility>
+#include <tuple>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <mutex>
+#include <memory_resource>
+#include <chrono>
+#include <cmath>
+#ifndef ARCHE_API
+#define ARCHE_API
+#endif // !ARCHE_API
+#include "Engine/Core/Time/Time.h"
+#include "Engine/Core/EditorState.h"
+// 計測はエンジン側の Profiler で行うため、単体では何もしない
+#define ARCHE_PROFILE_SCOPE(name)
+#define ARCHE_PROFILE_SCOPE_DYNAMIC(name)
+namespace Arche { struct Context; }	// 描画用（単体では Render を使わない）
+#else
 #include "Engine/pch.h"
 #include "Engine/Core/Time/Time.h"
 #include "Engine/Core/Context.h"
 #include "Engine/Core/Base/Logger.h"
+#include "Engine/Core/Profiler/Profiler.h"
+#endif // ARCHE_ECS_STANDALONE
+#include "Engine/Core/Job/JobSystem.h"
 
 namespace Arche
 {
@@ -41,12 +87,53 @@ namespace Arche
 	using Entity = uint32_t;
 	constexpr Entity NullEntity = 0xFFFFFFFF;
 
+	/**
+	 * @struct	EntityTraits
+	 * @brief	Entity ID のビット構成（下位: インデックス / 上位: 世代）
+	 *
+	 * @details
+	 * 削除されたIDが再利用される度に世代を進めることで、
+	 * 古いハンドルが新しいエンティティを指してしまう事故を防ぐ。
+	 */
+	struct EntityTraits
+	{
+		static constexpr uint32_t IndexBits = 20;
+		static constexpr Entity IndexMask = (1u << IndexBits) - 1;	// 0x000FFFFF
+		static constexpr Entity VersionMask = 0xFFF;				// 上位12bit
+
+		// 配列アクセス用のインデックス部
+		static constexpr Entity toIndex(Entity entity) { return entity & IndexMask; }
+		// 世代部
+		static constexpr Entity toVersion(Entity entity) { return entity >> IndexBits; }
+		// インデックスと世代を合成
+		static constexpr Entity combine(Entity index, Entity version)
+		{
+			return (index & IndexMask) | ((version & VersionMask) << IndexBits);
+		}
+	};
+
 	class ARCHE_API ComponentTypeManager
 	{
 	public:
 		static std::size_t GetID(const char* typeName);
 	};
 
+#ifdef ARCHE_ECS_STANDALONE
+	// 単一モジュールで完結するため、ヘッダー内で実装する
+	inline std::size_t ComponentTypeManager::GetID(const char* typeName)
+	{
+		static std::unordered_map<std::string, std::size_t> types;
+		static std::mutex mutex;
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = types.find(typeName);
+		if (it != types.end()) return it->second;
+
+		std::size_t id = types.size();
+		types.emplace(typeName, id);
+		return id;
+	}
+#endif // ARCHE_ECS_STANDALONE
+
 	class ComponentFamily
 	{
 		static std::size_t identifier()
@@ -65,655 +152,3393 @@ namespace Arche
 	};
 
 	// ------------------------------------------------------------
-	// Signal（イベント通知）
+	// ComponentMask（エンティティが持つコンポーネントの集合）
 	// ------------------------------------------------------------
-	template<typename... Args>
-	class Signal
+	// 登録できるコンポーネント型の上限
+	constexpr std::size_t MaxComponents = 128;
+
+	/**
+	 * @struct	ComponentMask
+	 * @brief	コンポーネント型IDのビット集合
+	 *
+	 * @details
+	 * 64bitワード単位で判定できるため、View の絞り込みや destroy 時の
+	 * 所持プール列挙をプール数に依存せず行える。
+	 */
+	struct ComponentMask
 	{
-	public:
-		using Callback = std::function<void(Args...)>;
+		static constexpr std::size_t WordCount = MaxComponents / 64;
+		std::array<uint64_t, WordCount> words{};
 
-		void connect(Callback cb)
+		// ※ 型IDの上限は getPool 以外（クエリ / SystemAccess のシグネチャ作成）からも通るので、ここでも確認する
+		void set(std::size_t id)
+		{
+			assert(id < MaxComponents && "Component type id out of range (raise MaxComponents)");
+			words[id >> 6] |= (uint64_t(1) << (id & 63));
+		}
+		void reset(std::size_t id)
+		{
+			assert(id < MaxComponents && "Component type id out of range (raise MaxComponents)");
+			words[id >> 6] &= ~(uint64_t(1) << (id & 63));
+		}
+		bool test(std::size_t id) const
 		{
-			callbacks.push_back(cb);
+			assert(id < MaxComponents && "Component type id out of range (raise MaxComponents)");
+			return (words[id >> 6] >> (id & 63)) & 1;
 		}
+		void clear() { words.fill(0); }
 
-		void publish(Args... args)
+		// other の全ビットを含むか
+		bool containsAll(const ComponentMask& other) const
 		{
-			for (auto& cb : callbacks)
+			for (std::size_t i = 0; i < WordCount; ++i)
 			{
-				cb(args...);
+				if ((words[i] & other.words[i]) != other.words[i]) return false;
 			}
+			return true;
 		}
 
-		void clear()
+		// other と1ビットでも重なるか
+		bool intersects(const ComponentMask& other) const
 		{
-			callbacks.clear();
+			for (std::size_t i = 0; i < WordCount; ++i)
+			{
+				if (words[i] & other.words[i]) return true;
+			}
+			return false;
 		}
 
-	private:
-		std::vector<Callback> callbacks;
+		bool any() const
+		{
+			for (auto w : words) if (w) return true;
+			return false;
+		}
+
+		// 立っているビット（型ID）を順に列挙
+		template<typename Func>
+		void forEach(Func func) const
+		{
+			for (std::size_t i = 0; i < WordCount; ++i)
+			{
+				uint64_t w = words[i];
+				while (w)
+				{
+					func(i * 64 + (std::size_t)std::countr_zero(w));
+					w &= w - 1;
+				}
+			}
+		}
 	};
 
 	// ------------------------------------------------------------
-	// Pool（インターフェース / 基底クラス）
+	// 変更ティック
 	// ------------------------------------------------------------
-	class IPool
+	/**
+	 * @details
+	 * コンポーネントごとに「追加された / 最後に書き込まれた」ティックを記録する。
+	 * World はシステムを実行する度にティックを1進め、そのシステム中の書き込みは今回のティックで記録される。
+	 * changed / added フィルタは「そのシステムの前回実行ティックより新しいか」で判定するため、
+	 * 自分自身の書き込みは次回の実行で変更扱いにならない。
+	 * システム外（エディタ・ロード処理など）の書き込みは「次に実行されるシステムのティック」で記録される。
+	 */
+	using Tick = uint32_t;
+
+	// a が b より新しいか（周回しても差が 2^31 未満なら正しく比較できる）
+	inline bool isNewerTick(Tick a, Tick b)
+	{
+		return (int32_t)(a - b) > 0;
+	}
+
+	class Registry;
+	class SystemAccess;
+
+	// 実行中システムのティック
+	struct SystemTicks
+	{
+		Tick thisRun = 0;	// 今回の実行ティック（0 = システム外）
+		Tick lastRun = 0;	// 前回の実行ティック（changed / added の基準）
+		const SystemAccess* access = nullptr;	// 宣言されたアクセス（書き込みの確認用 / nullptr = 確認しない）
+	};
+
+	// entity の typeId への書き込みが宣言の範囲か（SystemAccess の後で実装）
+	bool allowsWrite(const SystemAccess& access, Registry& registry, Entity entity, std::size_t typeId);
+
+	// 現在スレッドのティック（World が設定し、par_each はジョブへ引き継ぐ）
+	class ARCHE_API ChangeTicks
 	{
 	public:
-		virtual ~IPool() = default;
-		virtual void remove(Entity entity) = 0;
-		virtual bool has(Entity entity) const = 0;
-		virtual std::size_t size() const = 0;	// 最適化用
+		static SystemTicks& Current();
+	};
 
-		// コンポーネントの有効状態操作
-		virtual bool IsEnabled(Entity entity) const = 0;
-		virtual void SetEnabled(Entity entity, bool enabled) = 0;
+#ifdef ARCHE_ECS_STANDALONE
+	// 単一モジュールで完結するため、ヘッダー内で実装する
+	inline SystemTicks& ChangeTicks::Current()
+	{
+		thread_local SystemTicks ticks;
+		return ticks;
+	}
+#endif // ARCHE_ECS_STANDALONE
 
-		// Observer接続用インターフェース
-		Signal<Entity> onConstruct;	// 追加時
-		Signal<Entity> onDestroy;	// 削除時
-		Signal<Entity> onUpdate;	// 更新時
+	// スコープ中だけ現在スレッドのティックを差し替える
+	class TickScope
+	{
+	public:
+		explicit TickScope(const SystemTicks& ticks)
+			: saved(ChangeTicks::Current())
+		{
+			ChangeTicks::Current() = ticks;
+		}
+		~TickScope() { ChangeTicks::Current() = saved; }
+
+		TickScope(const TickScope&) = delete;
+		TickScope& operator=(const TickScope&) = delete;
+
+	private:
+		SystemTicks saved;
 	};
 
 	// ------------------------------------------------------------
-	// SparseSet（コンポーネントデータ管理 / Signal対応）
+	// Delegate（非所有の関数参照）
 	// ------------------------------------------------------------
-	template<typename T>
-	class SparseSet
-		: public IPool
+	/**
+	 * @class	Delegate
+	 * @brief	関数ポインタ + インスタンスポインタだけを持つ軽量な呼び出し口
+	 *
+	 * @details
+	 * std::function と違い、キャプチャを保持しないのでヒープ確保が起きない。
+	 * - connect<&Func>()					: フリー関数 / static関数
+	 * - connect<&Class::Method>(instance)	: メンバ関数
+	 * - connect<&Func>(payload)			: 先頭引数に payload を受け取るフリー関数
+	 * ※ インスタンス / payload の寿命は呼び出し側で管理する
+	 */
+	template<typename>
+	class Delegate;
+
+	template<typename Ret, typename... Args>
+	class Delegate<Ret(Args...)>
 	{
 	public:
-		// コンポーネントが存在するか
-		bool has(Entity entity) const override
+		using Function = Ret(*)(const void*, Args...);
+
+		Delegate() = default;
+
+		// フリー関数を接続
+		template<auto Candidate>
+		void connect()
 		{
-			return	entity < sparse.size() &&
-				sparse[entity] < dense.size() &&
-				dense[sparse[entity]] == entity;
+			instance = nullptr;
+			function = [](const void*, Args... args) -> Ret {
+				return Ret(std::invoke(Candidate, std::forward<Args>(args)...));
+			};
 		}
 
-		std::size_t size() const override
+		// メンバ関数 / payload 付きフリー関数を接続
+		template<auto Candidate, typename Type>
+		void connect(Type& value)
 		{
-			return dense.size();
+			instance = &value;
+			function = [](const void* payload, Args... args) -> Ret {
+				Type* target = static_cast<Type*>(const_cast<void*>(payload));
+				return Ret(std::invoke(Candidate, *target, std::forward<Args>(args)...));
+			};
 		}
 
-		bool IsEnabled(Entity entity) const override
+		// 生の関数ポインタを接続
+		void connect(Function func, const void* payload = nullptr)
 		{
-			if (!has(entity)) return false;
-			return enabled[sparse[entity]];
+			instance = payload;
+			function = func;
 		}
 
-		void SetEnabled(Entity entity, bool isEnabled) override
+		void reset()
 		{
-			if (has(entity))
-			{
-				enabled[sparse[entity]] = isEnabled;
-			}
+			instance = nullptr;
+			function = nullptr;
 		}
 
-		// コンポーネントの構築（Emplace）
-		template<typename... Args>
-		T& emplace(Entity entity, Args&&... args)
+		Ret operator()(Args... args) const
 		{
-			if (has(entity))
-			{
-				// 既に存在する場合は上書き＆更新通知
-				T& ref = data[sparse[entity]];
-				ref = T(std::forward<Args>(args)...);
-				onUpdate.publish(entity);
-				return data[sparse[entity]];
-			}
-
-			if (sparse.size() <= entity)
-			{
-				sparse.resize(entity + 1);
-			}
+			assert(function);
+			return function(instance, std::forward<Args>(args)...);
+		}
 
-			sparse[entity] = (Entity)dense.size();
-			dense.push_back(entity);
-			data.emplace_back(std::forward<Args>(args)...);
-			enabled.push_back(true);
+		explicit operator bool() const { return function != nullptr; }
 
-			// 追加通知
-			onConstruct.publish(entity);
-			return data.back();
-		}
+		// 接続先のインスタンス（切断の判定用）
+		const void* data() const { return instance; }
 
-		// コンポーネントの取得
-		T& get(Entity entity)
+		bool operator==(const Delegate& other) const
 		{
-			assert(has(entity));
-			return data[sparse[entity]];
+			return function == other.function && instance == other.instance;
 		}
 
-		// 値を書き換えた後に呼び出す（Observerへの通知用）
-		void patch(Entity entity)
+		// 生成ヘルパー
+		template<auto Candidate>
+		static Delegate create()
 		{
-			if (has(entity))
-			{
-				onUpdate.publish(entity);
-			}
+			Delegate d;
+			d.template connect<Candidate>();
+			return d;
 		}
 
-		// 削除
-		void remove(Entity entity) override
+		template<auto Candidate, typename Type>
+		static Delegate create(Type& value)
 		{
-			if (!has(entity)) return;
-
-			// 削除通知
-			onDestroy.publish(entity);
-
-			Entity lastEntity = dense.back();
-			Entity indexToRemove = sparse[entity];
-
-			// データとEntityIDを末尾のものとスワップ
-			std::swap(dense[indexToRemove], dense.back());
-			std::swap(data[indexToRemove], data.back());
-
-			// Sparse配列のリンクを更新
-			bool temp = enabled[indexToRemove];
-			enabled[indexToRemove] = enabled.back();
-			enabled.back() = temp;
-
-			sparse[lastEntity] = indexToRemove;
-
-			// 削除
-			dense.pop_back();
-			data.pop_back();
-			enabled.pop_back();
+			Delegate d;
+			d.template connect<Candidate>(value);
+			return d;
 		}
 
-		// データへの直接アクセス（Systemでのループ用）
-		std::vector<T>& getData() { return data; }
-		const std::vector<Entity>& getEntities() const { return dense; }
-
 	private:
-		std::vector<Entity> sparse;	// Entity ID -> Dense Index
-		std::vector<Entity> dense;	// Dense Index -> Entity ID
-		std::vector<T> data;		// Component Data（Dense配列と同期）
-		std::vector<bool> enabled;	// コンポーネントごとの有効フラグ
+		const void* instance = nullptr;
+		Function function = nullptr;
 	};
 
 	// ------------------------------------------------------------
-	// 3. Registry
+	// Signal（イベント通知）
 	// ------------------------------------------------------------
-	class Registry
+	/**
+	 * @class	Signal
+	 * @brief	Delegate の一覧を呼び出す通知
+	 *
+	 * @details
+	 * 接続先が少ない間（InlineCapacity 以下）は内部の固定配列に置き、ヒープを使わない。
+	 * 接続 / 切断は Sink 経由でも行える（発行権限を渡さずに購読だけさせたい場合）。
+	 * ※ 通知中の接続 / 切断は可能（切断されたものは以降呼ばれない）
+	 *   通知中の切断は枠を空けるだけにし、並びの詰め直しは最も外側の通知が終わってから行う
+	 *   （その場で詰めると、切断された位置の次の接続先が飛ばされるため）
+	 */
+	template<typename... Args>
+	class Signal
 	{
-		Entity nextEntity = 1;
-		// 再利用可能なIDのリスト
-		std::vector<Entity> freeIds;
-		std::vector<std::unique_ptr<IPool>> pools;
-		std::vector<bool> entityActiveStates;
-		std::function<Entity(Entity)> m_parentLookup;
-
 	public:
-		// -----------------------------------------------------------
-		// 自動検知用ラッパー
-		// -----------------------------------------------------------
-		template<typename T>
-		struct ScopedComponent
-		{
-			Registry* registry;
-			Entity entity;
-			T* component;
+		using DelegateType = Delegate<void(Args...)>;
+		static constexpr std::size_t InlineCapacity = 4;
 
-			ScopedComponent(Registry* r, Entity e, T* c) : registry(r), entity(e), component(c) {}
+		Signal() = default;
+		Signal(const Signal& other) { copyFrom(other); }
+		Signal& operator=(const Signal& other)
+		{
+			if (this != &other) copyFrom(other);
+			return *this;
+		}
 
-			~ScopedComponent()
-			{
-				if (registry && component)
-				{
-					registry->patch<T>(entity);
-				}
-			}
+		// 接続
+		template<auto Candidate>
+		void connect() { connect(DelegateType::template create<Candidate>()); }
 
-			T* operator->() { return component; }
-			T& operator*() { return *component; }
-		};
+		template<auto Candidate, typename Type>
+		void connect(Type& value) { connect(DelegateType::template create<Candidate>(value)); }
 
-		// -----------------------------------------------------------
-		// 基本機能
-		// -----------------------------------------------------------
-		// 型Tに対応するプールを取得（無ければ作成）
-		template<typename T>
-		SparseSet<T>& getPool()
+		void connect(const DelegateType& delegate)
 		{
-			std::size_t componentId = ComponentFamily::type<T>();
-			if (componentId >= pools.size())
+			if (count < InlineCapacity && heap.empty())
 			{
-				pools.resize(componentId + 1);
+				local[count++] = delegate;
+				return;
 			}
-			if (!pools[componentId])
+
+			// 固定配列が一杯になったらヒープへ移す
+			if (heap.empty())
 			{
-				pools[componentId] = std::make_unique<SparseSet<T>>();
+				heap.reserve(InlineCapacity * 2);
+				heap.assign(local.begin(), local.begin() + count);
 			}
-			return *static_cast<SparseSet<T>*>(pools[componentId].get());
+			heap.push_back(delegate);
+			++count;
 		}
 
-		// プールが存在するか確認（安全なアクセスの為）
-		template<typename T>
-		bool hasPool() const
+		// 切断
+		template<auto Candidate>
+		void disconnect() { disconnect(DelegateType::template create<Candidate>()); }
+
+		template<auto Candidate, typename Type>
+		void disconnect(Type& value) { disconnect(DelegateType::template create<Candidate>(value)); }
+
+		void disconnect(const DelegateType& delegate)
 		{
-			std::size_t componentId = ComponentFamily::type<T>();
-			return componentId < pools.size() && pools[componentId] != nullptr;
+			eraseIf([&](const DelegateType& d) { return d == delegate; });
 		}
 
-		// 汎用プール取得
-		IPool* getPoolBase(std::size_t typeId)
+		// 接続済みか（二重接続の防止用）
+		template<auto Candidate, typename Type>
+		bool contains(Type& value) const { return contains(DelegateType::template create<Candidate>(value)); }
+
+		bool contains(const DelegateType& delegate) const
 		{
-			if (typeId < pools.size())
+			for (std::size_t i = 0; i < count; ++i)
 			{
-				return pools[typeId].get();
+				if (at(i) == delegate) return true;
 			}
-			return nullptr;
+			return false;
 		}
 
-		// 親取得関数のセット
-		void SetParentLookup(std::function<Entity(Entity)> func)
+		// 指定インスタンスに結び付いた接続を全て切断
+		void disconnect(const void* instance)
 		{
-			m_parentLookup = func;
+			if (!instance) return;
+			eraseIf([&](const DelegateType& d) { return d.data() == instance; });
 		}
 
-		// Entity作成
-		Entity create()
+		void publish(Args... args)
 		{
-			Entity id;
-			if (!freeIds.empty())
-			{
-				id = freeIds.back();
-				freeIds.pop_back();
-			}
-			else
+			// 通知中の接続 / 切断で格納先が変わっても良いよう、毎回引き直す
+			++publishing;
+			for (std::size_t i = 0; i < count; ++i)
 			{
-				id = nextEntity++;
+				if (at(i)) at(i)(args...);
 			}
-
-			if (entityActiveStates.size() <= id)
-			{
-				entityActiveStates.resize(id + 1, true);
-			}
-			entityActiveStates[id] = true;
-
-			return id;
+			if (--publishing == 0 && erased != 0) compact();
 		}
 
-		// EntityのActive操作
-		void setActive(Entity entity, bool active)
+		void clear()
 		{
-			if (valid(entity))
+			if (publishing != 0)
 			{
-				if (entityActiveStates.size() <= entity) entityActiveStates.resize(entity + 1, true);
-				entityActiveStates[entity] = active;
+				// 通知中は枠を空けるだけにする
+				for (std::size_t i = 0; i < count; ++i) at(i).reset();
+				erased = count;
+				return;
 			}
+			count = 0;
+			erased = 0;
+			heap.clear();
 		}
 
-		bool isActive(Entity entity) const
+		// 接続先が無いか（通知ループ自体を省略する判定用）
+		bool empty() const
 		{
-			if (!valid(entity)) return false;
+			return size() == 0;
+		}
 
-			// 1. 自分自身がOFFなら false
-			if (entity < entityActiveStates.size() && !entityActiveStates[entity]) return false;
+		std::size_t size() const { return count - erased; }
 
-			// 2. 親がいる場合、親がActiveかチェック
-			if (m_parentLookup)
+	private:
+		const DelegateType& at(std::size_t i) const { return heap.empty() ? local[i] : heap[i]; }
+		DelegateType& at(std::size_t i) { return heap.empty() ? local[i] : heap[i]; }
+
+		// 登録順を保ったまま削除する
+		template<typename Pred>
+		void eraseIf(Pred pred)
+		{
+			if (publishing != 0)
 			{
-				Entity parent = m_parentLookup(entity);
-				if (parent != NullEntity)
+				// 通知中は空き枠にしておき、通知の後で詰める
+				for (std::size_t i = 0; i < count; ++i)
 				{
-					return isActive(parent);
+					if (at(i) && pred(at(i)))
+					{
+						at(i).reset();
+						++erased;
+					}
 				}
+				return;
 			}
 
-			return true;
+			std::size_t write = 0;
+			for (std::size_t read = 0; read < count; ++read)
+			{
+				if (pred(at(read))) continue;
+				if (write != read) at(write) = at(read);
+				++write;
+			}
+			if (!heap.empty()) heap.resize(write);
+			count = write;
 		}
 
-		// 自分自身のActive設定だけを知りたい場合
-		bool isActiveSelf(Entity entity) const
+		// 空き枠を詰める
+		void compact()
 		{
-			if (!valid(entity)) return false;
-			if (entity >= entityActiveStates.size()) return true;
-			return entityActiveStates[entity];
+			eraseIf([](const DelegateType& d) { return !d; });
+			erased = 0;
 		}
 
-		// コンポーネントのEnabled操作ヘルパー
-		template<typename T>
-		void setComponentEnabled(Entity entity, bool enabled)
+		void copyFrom(const Signal& other)
 		{
-			getPool<T>().SetEnabled(entity, enabled);
+			local = other.local;
+			heap = other.heap;
+			count = other.count;
+			erased = other.erased;
+			if (erased != 0 && publishing == 0) compact();
 		}
 
-		template<typename T>
-		bool isComponentEnabled(Entity entity)
-		{
-			return getPool<T>().IsEnabled(entity);
-		}
+		std::array<DelegateType, InlineCapacity> local{};
+		std::vector<DelegateType> heap;
+		std::size_t count = 0;
+		std::size_t erased = 0;		// 通知中に切断されて空いた枠の数
+		uint32_t publishing = 0;	// 通知の入れ子の深さ
+	};
 
-		// コンポーネント追加
-		template<typename T, typename... Args>
-		T& emplace(Entity entity, Args&&... args)
-		{
-			return getPool<T>().emplace(entity, std::forward<Args>(args)...);
-		}
+	/**
+	 * @class	Sink
+	 * @brief	Signal の接続 / 切断だけを公開する窓口
+	 */
+	template<typename... Args>
+	class Sink
+	{
+	public:
+		using SignalType = Signal<Args...>;
+		using DelegateType = typename SignalType::DelegateType;
 
-		// コンポーネントを持っているか確認
-		template<typename T>
-		bool has(Entity entity)
+		explicit Sink(SignalType& s) : signal(&s) {}
+
+		template<auto Candidate>
+		Sink& connect() { signal->template connect<Candidate>(); return *this; }
+
+		template<auto Candidate, typename Type>
+		Sink& connect(Type& value) { signal->template connect<Candidate>(value); return *this; }
+
+		Sink& connect(const DelegateType& delegate) { signal->connect(delegate); return *this; }
+
+		template<auto Candidate>
+		Sink& disconnect() { signal->template disconnect<Candidate>(); return *this; }
+
+		template<auto Candidate, typename Type>
+		Sink& disconnect(Type& value) { signal->template disconnect<Candidate>(value); return *this; }
+
+		Sink& disconnect(const void* instance) { signal->disconnect(instance); return *this; }
+
+		bool empty() const { return signal->empty(); }
+
+	private:
+		SignalType* signal;
+	};
+
+	// ------------------------------------------------------------
+	// EnabledBits（Dense 配列と同じ並びの有効フラグ）
+	// ------------------------------------------------------------
+	/**
+	 * @class	EnabledBits
+	 * @brief	64bit ワード単位に詰めた有効フラグ列
+	 *
+	 * @details
+	 * ワードが 0 なら 64 要素まとめて無効と分かるため、走査側は丸ごと読み飛ばせる。
+	 * 無効な要素の数も数えておき、0 なら判定自体を省略できるようにする。
+	 * ※ size() より後ろのビットは常に 0 に保つ
+	 */
+	class EnabledBits
+	{
+	public:
+		static constexpr std::size_t WordBits = 64;
+
+		bool test(std::size_t pos) const
+		{
+			return (words[pos / WordBits] >> (pos % WordBits)) & 1;
+		}
+
+		// 値の設定（変化したら true）
+		bool set(std::size_t pos, bool value)
+		{
+			if (test(pos) == value) return false;
+			words[pos / WordBits] ^= uint64_t(1) << (pos % WordBits);
+			value ? --disabled : ++disabled;
+			return true;
+		}
+
+		void push_back(bool value)
+		{
+			if (count % WordBits == 0) words.push_back(0);
+			++count;
+			if (value) words[(count - 1) / WordBits] |= uint64_t(1) << ((count - 1) % WordBits);
+			else ++disabled;
+		}
+
+		void pop_back()
+		{
+			assert(count > 0);
+			const std::size_t pos = count - 1;
+			if (!test(pos)) --disabled;
+			words[pos / WordBits] &= ~(uint64_t(1) << (pos % WordBits));
+			--count;
+			if (count % WordBits == 0) words.pop_back();
+		}
+
+		void swap(std::size_t lhs, std::size_t rhs)
+		{
+			const bool l = test(lhs);
+			const bool r = test(rhs);
+			if (l == r) return;
+			words[lhs / WordBits] ^= uint64_t(1) << (lhs % WordBits);
+			words[rhs / WordBits] ^= uint64_t(1) << (rhs % WordBits);
+		}
+
+		void reserve(std::size_t capacity) { words.reserve((capacity + WordBits - 1) / WordBits); }
+		void clear() { words.clear(); count = 0; disabled = 0; }
+
+		// w 番目のワード（範囲外は 0）
+		uint64_t word(std::size_t w) const { return w < words.size() ? words[w] : 0; }
+		std::size_t wordCount() const { return words.size(); }
+
+		std::size_t size() const { return count; }
+		std::size_t disabledCount() const { return disabled; }
+		std::size_t memoryUsage() const { return words.capacity() * sizeof(uint64_t); }
+		void shrinkToFit() { words.shrink_to_fit(); }
+
+	private:
+		std::vector<uint64_t> words;
+		std::size_t count = 0;		// 要素数
+		std::size_t disabled = 0;	// 無効な要素の数
+	};
+
+	// ------------------------------------------------------------
+	// PoolStats（プール単位のメモリ / 使用状況）
+	// ------------------------------------------------------------
+	/**
+	 * @struct	PoolStats
+	 * @brief	Registry::stats() で取得するプール 1つ分の統計
+	 *
+	 * @details
+	 * bytesUsed は要素数分、bytesReserved は確保済みの容量分（どちらも Sparse を含む）。
+	 * 両者の差が大きいプールは、作成 / 削除の繰り返しで膨らんだまま残っている。
+	 * ※ コンポーネントが内部で持つヒープ（std::string など）は含まない
+	 */
+	struct PoolStats
+	{
+		std::size_t typeId = 0;				// コンポーネント型ID
+		const char* typeName = "";			// typeid(T).name()
+		std::size_t size = 0;				// 要素数
+		std::size_t capacity = 0;			// Dense 配列の確保数
+		std::size_t sparsePages = 0;		// 確保済みの Sparse ページ数
+		std::size_t sparseSize = 0;			// Sparse が表せるインデックスの範囲
+		std::size_t bytesUsed = 0;			// 要素数分のバイト数
+		std::size_t bytesReserved = 0;		// 確保済みのバイト数
+		std::size_t disabled = 0;			// 無効な要素の数
+
+		// Signal の接続数
+		std::size_t constructListeners = 0;
+		std::size_t destroyListeners = 0;
+		std::size_t updateListeners = 0;
+		std::size_t enabledListeners = 0;
+	};
+
+	// ------------------------------------------------------------
+	// Pool（インターフェース / 基底クラス）
+	// ------------------------------------------------------------
+	class IPool
+	{
+	public:
+		virtual ~IPool() = default;
+		virtual void remove(Entity entity) = 0;
+		virtual bool has(Entity entity) const = 0;
+		virtual std::size_t size() const = 0;	// 最適化用
+		virtual const std::vector<Entity>& getEntities() const = 0;
+
+		// コンポーネントの有効状態操作
+		virtual bool IsEnabled(Entity entity) const = 0;
+		virtual void SetEnabled(Entity entity, bool enabled) = 0;
+		virtual const EnabledBits& getEnabledBits() const = 0;	// Dense 配列と同じ並び
+
+		// メモリ / 使用状況の取得と、余った容量の解放
+		virtual PoolStats stats() const = 0;
+		virtual void shrinkToFit() = 0;
+
+		// Observer接続用インターフェース
+		Signal<Entity> onConstruct;	// 追加時
+		Signal<const Entity*, std::size_t> onConstructRange;	// 一括追加時（insert / 1回だけ通知）
+		Signal<Entity> onDestroy;	// 削除時
+		Signal<Entity> onUpdate;	// 更新時
+		Signal<Entity> onEnabledChanged;	// 有効状態の変更時
+
+		// 所属Registryとの連携（Registry::getPool で設定される）
+		std::size_t typeId = 0;								// コンポーネント型ID
+		std::vector<ComponentMask>* signatures = nullptr;	// エンティティ毎の所持マスク
+		const std::atomic<Tick>* worldTick = nullptr;		// Registry の最新ティック
+
+		// 唯一コンポーネントの管理（Registry::unique / setUnique で有効化される）
+		std::atomic<bool> uniqueTracked{ false };	// 所持者を追跡しているか
+		Entity uniqueOwner = NullEntity;			// 現在の所持者
+
+		// 書き込みを記録するティック（システム実行中はそのティック、外なら次のティック）
+		Tick stampTick() const
+		{
+			const Tick current = ChangeTicks::Current().thisRun;
+			if (current != 0) return current;
+			return worldTick ? worldTick->load(std::memory_order_relaxed) + 1 : 1;
+		}
+
+	protected:
+		// Signal の接続数を書き込む（stats() 用）
+		void fillListenerStats(PoolStats& out) const
+		{
+			out.constructListeners = onConstruct.size() + onConstructRange.size();
+			out.destroyListeners = onDestroy.size();
+			out.updateListeners = onUpdate.size();
+			out.enabledListeners = onEnabledChanged.size();
+		}
+
+		// 所持マスクの更新（追加/削除時）
+		void updateSignature(Entity index, bool owned)
+		{
+			if (signatures && index < signatures->size())
+			{
+				if (owned) (*signatures)[index].set(typeId);
+				else (*signatures)[index].reset(typeId);
+			}
+		}
+	};
+
+	// ------------------------------------------------------------
+	// SparsePages（ページ分割された Sparse 配列）
+	// ------------------------------------------------------------
+	/**
+	 * @class	SparsePages
+	 * @brief	Entity インデックス -> Dense インデックス の対応表
+	 *
+	 * @details
+	 * 固定長ページを必要になった時だけ確保する。
+	 * 未確保ページは全要素 NullEntity の番兵ページを指すため、読み取りは分岐なしで行える。
+	 * ページ内の使用数が 0 になったら解放して番兵に戻す。
+	 */
+	class SparsePages
+	{
+	public:
+		static constexpr Entity PageSize = 4096;	// 2のべき乗であること
+		static constexpr Entity PageShift = 12;
+		static_assert((Entity(1) << PageShift) == PageSize, "PageSize must match PageShift");
+
+		SparsePages() = default;
+		~SparsePages() { reset(); }
+
+		SparsePages(const SparsePages&) = delete;
+		SparsePages& operator=(const SparsePages&) = delete;
+
+		// 値の取得（未登録なら NullEntity）
+		Entity get(Entity index) const
+		{
+			const Entity page = index >> PageShift;
+			if (page >= pages.size()) return NullEntity;
+			return pages[page][index & (PageSize - 1)];
+		}
+
+		// 値の設定（既に登録済みのインデックスのみ）
+		void set(Entity index, Entity value)
+		{
+			assert(counts[index >> PageShift] > 0);
+			pages[index >> PageShift][index & (PageSize - 1)] = value;
+		}
+
+		// 新規登録（必要ならページを確保）
+		void insert(Entity index, Entity value)
+		{
+			const Entity page = index >> PageShift;
+			if (page >= pages.size())
+			{
+				pages.resize(page + 1, nullPage());
+				counts.resize(page + 1, 0);
+			}
+			if (counts[page] == 0)
+			{
+				Entity* newPage = new Entity[PageSize];
+				std::fill(newPage, newPage + PageSize, NullEntity);
+				pages[page] = newPage;
+			}
+			pages[page][index & (PageSize - 1)] = value;
+			++counts[page];
+		}
+
+		// 登録解除（ページが空になったら解放）
+		void erase(Entity index)
+		{
+			const Entity page = index >> PageShift;
+			pages[page][index & (PageSize - 1)] = NullEntity;
+			if (--counts[page] == 0)
+			{
+				delete[] pages[page];
+				pages[page] = nullPage();
+			}
+		}
+
+		// 全ページ解放
+		void reset()
+		{
+			for (std::size_t i = 0; i < pages.size(); ++i)
+			{
+				if (counts[i] > 0) delete[] pages[i];
+			}
+			pages.clear();
+			counts.clear();
+		}
+
+		// 確保済みページ数
+		std::size_t pageCount() const
+		{
+			return (std::size_t)std::count_if(counts.begin(), counts.end(), [](uint32_t c) { return c > 0; });
+		}
+
+		// ページ配列の長さ（表せるインデックスは pageSlots() * PageSize 未満）
+		std::size_t pageSlots() const { return pages.size(); }
+
+		// 使用中のバイト数（ページ本体 + 管理配列）
+		std::size_t memoryUsage() const
+		{
+			return pageCount() * PageSize * sizeof(Entity) +
+				pages.capacity() * sizeof(Entity*) + counts.capacity() * sizeof(uint32_t);
+		}
+
+		// 末尾の未確保ページを詰めて、管理配列の余りを解放する
+		void shrinkToFit()
+		{
+			std::size_t last = pages.size();
+			while (last > 0 && counts[last - 1] == 0) --last;
+			pages.resize(last);
+			counts.resize(last);
+			pages.shrink_to_fit();
+			counts.shrink_to_fit();
+		}
+
+	private:
+		// 未確保ページ用の番兵（全要素 NullEntity / 書き込み禁止）
+		// ※ モジュール毎に別実体になり得るため、アドレス比較ではなく counts で判定する
+		static Entity* nullPage()
+		{
+			static std::array<Entity, PageSize> page = [] {
+				std::array<Entity, PageSize> p;
+				p.fill(NullEntity);
+				return p;
+			}();
+			return page.data();
+		}
+
+		std::vector<Entity*> pages;		// ページ先頭（未確保なら番兵）
+		std::vector<uint32_t> counts;	// ページ内の使用数
+	};
+
+	// ------------------------------------------------------------
+	// ページ分割ストレージ（アドレスが動かないコンポーネント配列）
+	// ------------------------------------------------------------
+	/**
+	 * @namespace	StorageResource
+	 * @brief	ページの確保元（StorageTraits::Resource で選ぶ）
+	 *
+	 * @details
+	 * - Heap()		: 毎回 new / delete する（既定）
+	 * - Pool()		: 解放したページを同じサイズの確保に使い回す
+	 * - Arena()	: 大きなブロックから切り出すだけで、個別には解放しない（確保が最速 / 使い捨てのワールド向け）
+	 * ※ どれもスレッドセーフ。モジュール（DLL）毎に別実体になるが、ページは確保した資源へ必ず返す
+	 */
+	namespace StorageResource
+	{
+		inline std::pmr::memory_resource* Heap()
+		{
+			return std::pmr::new_delete_resource();
+		}
+
+		inline std::pmr::memory_resource* Pool()
+		{
+			static std::pmr::synchronized_pool_resource resource;
+			return &resource;
+		}
+
+		inline std::pmr::memory_resource* Arena()
+		{
+			// monotonic_buffer_resource はスレッドセーフではないため排他する
+			class LockedArena : public std::pmr::memory_resource
+			{
+				void* do_allocate(std::size_t bytes, std::size_t align) override
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					return arena.allocate(bytes, align);
+				}
+				void do_deallocate(void*, std::size_t, std::size_t) override {}
+				bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+				std::pmr::monotonic_buffer_resource arena;
+				std::mutex mutex;
+			};
+			static LockedArena resource;
+			return &resource;
+		}
+	}
+
+	/**
+	 * @struct	StorageTraits
+	 * @brief	コンポーネント型毎の格納方法
+	 *
+	 * @details
+	 * PageSize が 0 なら std::vector（連続配列 / 既定）。
+	 * 0 以外なら PageSize 個ずつのページに分けて格納し、追加で容量が増えても既存の要素は動かない。
+	 * 大きなコンポーネント（std::map や文字列を多く持つもの）に使うと、増加時の一斉ムーブが無くなる。
+	 * 指定は ARCHE_PAGED_STORAGE(Type, PageSize, Resource) で行う（構造体の直後、ARCHE_COMPONENT より前に置く）。
+	 */
+	template<typename T>
+	struct StorageTraits
+	{
+		static constexpr std::size_t PageSize = 0;
+		static std::pmr::memory_resource* Resource() { return StorageResource::Heap(); }
+	};
+
+	// ページ分割ストレージの指定（namespace Arche の中で使う）
+	#define ARCHE_PAGED_STORAGE(Type, Size, ResourceFunc) \
+		template<> \
+		struct StorageTraits<Type> \
+		{ \
+			static constexpr std::size_t PageSize = Size; \
+			static std::pmr::memory_resource* Resource() { return ResourceFunc(); } \
+		};
+
+	/**
+	 * @class	PagedStorage
+	 * @brief	固定長ページに分けた要素配列（std::vector の置き換え / SparseSet が使う範囲のみ）
+	 *
+	 * @details
+	 * 末尾への追加 / 削除と添字アクセスだけを提供する。
+	 * 容量の追加はページの確保のみで、既存要素のムーブは発生しない（参照が無効にならない）。
+	 * ※ 削除（末尾との入れ替え）や並び替えで動く要素は std::vector と同じく移動する
+	 */
+	template<typename T, std::size_t PageSize>
+	class PagedStorage
+	{
+		static_assert(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
+	public:
+		explicit PagedStorage(std::pmr::memory_resource* resource = StorageTraits<T>::Resource())
+			: resource(resource)
+		{
+		}
+
+		~PagedStorage()
+		{
+			clear();
+			releasePages(0);
+		}
+
+		PagedStorage(const PagedStorage&) = delete;
+		PagedStorage& operator=(const PagedStorage&) = delete;
+
+		T& operator[](std::size_t i) { return pages[i / PageSize][i % PageSize]; }
+		const T& operator[](std::size_t i) const { return pages[i / PageSize][i % PageSize]; }
+
+		T& back() { return (*this)[count - 1]; }
+
+		template<typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (count == capacity()) allocatePage();
+			T* slot = &pages[count / PageSize][count % PageSize];
+			::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+			++count;
+			return *slot;
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		void pop_back()
+		{
+			assert(count > 0);
+			--count;
+			std::destroy_at(&(*this)[count]);
+		}
+
+		void reserve(std::size_t n)
+		{
+			while (capacity() < n) allocatePage();
+		}
+
+		// 使っていないページを解放する
+		void shrink_to_fit()
+		{
+			releasePages((count + PageSize - 1) / PageSize);
+			pages.shrink_to_fit();
+		}
+
+		void clear()
+		{
+			while (count > 0) pop_back();
+		}
+
+		std::size_t size() const { return count; }
+		std::size_t capacity() const { return pages.size() * PageSize; }
+		bool empty() const { return count == 0; }
+
+	private:
+		void allocatePage()
+		{
+			pages.push_back(static_cast<T*>(resource->allocate(PageSize * sizeof(T), alignof(T))));
+		}
+
+		// 先頭 keep ページを残して返却する（要素は破棄済みであること）
+		void releasePages(std::size_t keep)
+		{
+			while (pages.size() > keep)
+			{
+				resource->deallocate(pages.back(), PageSize * sizeof(T), alignof(T));
+				pages.pop_back();
+			}
+		}
+
+		std::vector<T*> pages;
+		std::size_t count = 0;
+		std::pmr::memory_resource* resource;
+	};
+
+	// StorageTraits に従った格納先の型
+	template<typename T>
+	using ComponentStorage = std::conditional_t<StorageTraits<T>::PageSize == 0,
+		std::vector<T>, PagedStorage<T, StorageTraits<T>::PageSize>>;
+
+	// ------------------------------------------------------------
+	// SparseSet（コンポーネントデータ管理 / Signal対応）
+	// ------------------------------------------------------------
+	template<typename T>
+	class SparseSet
+		: public IPool
+	{
+	public:
+		// コンポーネントが存在するか
+		bool has(Entity entity) const override
+		{
+			// 世代まで一致しない古いハンドルは「持っていない」扱い
+			const Entity pos = sparse.get(EntityTraits::toIndex(entity));
+			return pos < dense.size() && dense[pos] == entity;
+		}
+
+		std::size_t size() const override
+		{
+			return dense.size();
+		}
+
+		bool IsEnabled(Entity entity) const override
+		{
+			if (!has(entity)) return false;
+			return enabled.test(sparse.get(EntityTraits::toIndex(entity)));
+		}
+
+		// 所持している前提の有効判定（所持マスクで確認済みの場合に使う）
+		bool isEnabledOwned(Entity entity) const
+		{
+			return enabled.test(sparse.get(EntityTraits::toIndex(entity)));
+		}
+
+		const EnabledBits& getEnabledBits() const override { return enabled; }
+
+		void SetEnabled(Entity entity, bool isEnabled) override
+		{
+			if (has(entity))
+			{
+				const Entity pos = sparse.get(EntityTraits::toIndex(entity));
+				if (!enabled.set(pos, isEnabled)) return;
+				onEnabledChanged.publish(entity);
+			}
+		}
+
+		// コンポーネントの構築（Emplace）
+		template<typename... Args>
+		T& emplace(Entity entity, Args&&... args)
+		{
+			const Entity index = EntityTraits::toIndex(entity);
+			if (has(entity))
+			{
+				// 既に存在する場合は上書き＆更新通知
+				const Entity pos = sparse.get(index);
+				data[pos] = T(std::forward<Args>(args)...);
+				changedTicks[pos] = stampTick();
+				onUpdate.publish(entity);
+				return data[sparse.get(index)];
+			}
+
+			const Tick tick = stampTick();
+			sparse.insert(index, (Entity)dense.size());
+			dense.push_back(entity);
+			data.emplace_back(std::forward<Args>(args)...);
+			enabled.push_back(true);
+			addedTicks.push_back(tick);
+			changedTicks.push_back(tick);
+			updateSignature(index, true);
+
+			// 追加通知
+			// ※ Group により並び替えられる可能性があるため、通知後に位置を引き直す
+			onConstruct.publish(entity);
+			return data[sparse.get(index)];
+		}
+
+		// 容量の事前確保（一括追加前に呼ぶと再確保が1回で済む）
+		void reserve(std::size_t capacity)
+		{
+			dense.reserve(capacity);
+			data.reserve(capacity);
+			enabled.reserve(capacity);
+			addedTicks.reserve(capacity);
+			changedTicks.reserve(capacity);
+		}
+
+		// 一括追加（全員に同じ値）
+		template<typename It>
+		void insert(It first, It last, const T& value = {})
+		{
+			insertRange(first, last, [&value]() -> const T& { return value; });
+		}
+
+		// 一括追加（値の範囲を対応付けて追加）
+		template<typename It, std::input_iterator ValueIt>
+		void insert(It first, It last, ValueIt values)
+		{
+			insertRange(first, last, [&values]() -> decltype(auto) { return *values++; });
+		}
+
+		// コンポーネントの取得
+		T& get(Entity entity)
+		{
+			assert(has(entity));
+			return data[sparse.get(EntityTraits::toIndex(entity))];
+		}
+
+		// 値を書き換えた後に呼び出す（変更ティックの記録 + onUpdate 通知）
+		// ※ ジョブ実行中は onUpdate を発行しない（ティックのみ記録する）
+		void patch(Entity entity)
+		{
+			if (!has(entity)) return;
+			markChanged(entity, stampTick());
+			if (JobSystem::IsInsideJob()) return;
+			onUpdate.publish(entity);
+		}
+
+		// 変更ティックの記録（通知なし / 所持している前提）
+		void markChanged(Entity entity, Tick tick)
+		{
+			assert(has(entity));
+			changedTicks[sparse.get(EntityTraits::toIndex(entity))] = tick;
+		}
+
+		// Dense配列上の位置で変更ティックを記録
+		void markChangedAt(std::size_t pos, Tick tick) { changedTicks[pos] = tick; }
+
+		// 変更 / 追加ティックの取得（所持している前提）
+		Tick changedTick(Entity entity) const { return changedTicks[sparse.get(EntityTraits::toIndex(entity))]; }
+		Tick addedTick(Entity entity) const { return addedTicks[sparse.get(EntityTraits::toIndex(entity))]; }
+
+		// Dense配列と同じ並びの変更ティック（Observer の走査用）
+		const std::vector<Tick>& getChangedTicks() const { return changedTicks; }
+
+		// 削除
+		void remove(Entity entity) override
+		{
+			if (!has(entity)) return;
+
+			// 削除通知
+			onDestroy.publish(entity);
+
+			Entity lastEntity = dense.back();
+			Entity indexToRemove = sparse.get(EntityTraits::toIndex(entity));
+
+			// データとEntityIDを末尾のものとスワップ
+			std::swap(dense[indexToRemove], dense.back());
+			std::swap(data[indexToRemove], data.back());
+
+			// Sparse配列のリンクを更新
+			enabled.swap(indexToRemove, dense.size() - 1);
+			addedTicks[indexToRemove] = addedTicks.back();
+			changedTicks[indexToRemove] = changedTicks.back();
+
+			sparse.set(EntityTraits::toIndex(lastEntity), indexToRemove);
+			sparse.erase(EntityTraits::toIndex(entity));
+			updateSignature(EntityTraits::toIndex(entity), false);
+
+			// 削除
+			dense.pop_back();
+			data.pop_back();
+			enabled.pop_back();
+			addedTicks.pop_back();
+			changedTicks.pop_back();
+		}
+
+		// Dense配列上の位置（所持していなければ NullEntity）
+		Entity indexOf(Entity entity) const
+		{
+			return has(entity) ? sparse.get(EntityTraits::toIndex(entity)) : NullEntity;
+		}
+
+		// Dense配列上の位置で有効状態を取得
+		bool isEnabledAt(std::size_t pos) const { return enabled.test(pos); }
+
+		// Dense配列上の2要素を入れ替える（Groupの整列用）
+		void swapAt(std::size_t lhs, std::size_t rhs)
+		{
+			if (lhs == rhs) return;
+
+			std::swap(dense[lhs], dense[rhs]);
+			std::swap(data[lhs], data[rhs]);
+			enabled.swap(lhs, rhs);
+			std::swap(addedTicks[lhs], addedTicks[rhs]);
+			std::swap(changedTicks[lhs], changedTicks[rhs]);
+
+			sparse.set(EntityTraits::toIndex(dense[lhs]), (Entity)lhs);
+			sparse.set(EntityTraits::toIndex(dense[rhs]), (Entity)rhs);
+		}
+
+		// 並び替え（挿入ソート / ほぼ整列済みなら O(n) なので毎フレーム呼んでも軽い）
+		// compare: bool(const T&, const T&) または bool(Entity, Entity)
+		// length: 先頭の [0, length) だけを並び替える（Group の所有範囲用 / 既定は全体）
+		// ※ dense / data / enabled / ティックを一緒に入れ替え、sparse を付け直す
+		// ※ 走査中には呼ばない（構造変更と同じ扱い）
+		template<typename Compare>
+		void sort(Compare compare, std::size_t length = (std::size_t)-1)
+		{
+			length = (std::min)(length, dense.size());
+			if (length < 2) return;
+
+			auto less = [&](Entity lhs, Entity rhs) -> bool {
+				if constexpr (std::is_invocable_r_v<bool, Compare&, const T&, const T&>)
+					return compare(static_cast<const T&>(data[lhs]), static_cast<const T&>(data[rhs]));
+				else
+					return compare(dense[lhs], dense[rhs]);
+			};
+
+			// 位置の配列を挿入ソートし、実データは最後に1回ずつ動かす
+			std::vector<Entity> order(length);
+			bool sorted = true;
+			for (std::size_t i = 0; i < length; ++i)
+			{
+				const Entity current = (Entity)i;
+				std::size_t j = i;
+				for (; j > 0 && less(current, order[j - 1]); --j) order[j] = order[j - 1];
+				order[j] = current;
+				sorted &= (j == i);
+			}
+			if (!sorted) applyOrder(order);
+		}
+
+		// other の並びに合わせる（両方が持つエンティティを other と同じ順で先頭に詰める）
+		// length: 先頭の [0, length) だけを対象にする（既定は全体）
+		void sort_as(const IPool& other, std::size_t length = (std::size_t)-1)
+		{
+			length = (std::min)(length, dense.size());
+			std::size_t pos = 0;
+			for (Entity entity : other.getEntities())
+			{
+				if (pos >= length) break;
+				if (!has(entity)) continue;
+				const std::size_t at = sparse.get(EntityTraits::toIndex(entity));
+				if (at >= length) continue;
+				swapAt(pos++, at);
+			}
+		}
+
+		// データへの直接アクセス（Systemでのループ用）
+		ComponentStorage<T>& getData() { return data; }
+		const std::vector<Entity>& getEntities() const override { return dense; }
+
+		// Sparse配列の参照（メモリ計測用）
+		const SparsePages& getSparse() const { return sparse; }
+
+		PoolStats stats() const override
+		{
+			// 1要素あたり：Entity + T + 追加 / 変更ティック（有効フラグはワード単位で別に数える）
+			constexpr std::size_t elementBytes = sizeof(Entity) + sizeof(T) + sizeof(Tick) * 2;
+
+			PoolStats out;
+			out.typeId = typeId;
+			out.typeName = typeid(T).name();
+			out.size = dense.size();
+			out.capacity = dense.capacity();
+			out.sparsePages = sparse.pageCount();
+			out.sparseSize = sparse.pageSlots() * SparsePages::PageSize;
+			out.bytesUsed = dense.size() * elementBytes + enabled.wordCount() * sizeof(uint64_t) +
+				sparse.pageCount() * SparsePages::PageSize * sizeof(Entity) +
+				sparse.pageSlots() * (sizeof(Entity*) + sizeof(uint32_t));
+			out.bytesReserved = dense.capacity() * sizeof(Entity) + data.capacity() * sizeof(T) +
+				(addedTicks.capacity() + changedTicks.capacity()) * sizeof(Tick) +
+				enabled.memoryUsage() + sparse.memoryUsage();
+			out.disabled = enabled.disabledCount();
+			fillListenerStats(out);
+			return out;
+		}
+
+		// 余った容量を解放する（走査中には呼ばない / 要素の並びと値は変わらない）
+		void shrinkToFit() override
+		{
+			dense.shrink_to_fit();
+			data.shrink_to_fit();
+			enabled.shrinkToFit();
+			addedTicks.shrink_to_fit();
+			changedTicks.shrink_to_fit();
+			sparse.shrinkToFit();
+		}
+
+	private:
+		// order[i] 番目の要素を i 番目へ移す（入れ替えで置換を適用する）
+		// ※ 既に動かした位置 (< i) は置換を辿って現在の位置を求める
+		void applyOrder(const std::vector<Entity>& order)
+		{
+			for (std::size_t i = 0; i < order.size(); ++i)
+			{
+				std::size_t from = order[i];
+				while (from < i) from = order[from];
+				swapAt(i, from);
+			}
+		}
+
+		// 一括追加の本体：容量を1回だけ確保し、追加分は onConstructRange で1回だけ通知する
+		template<typename It, typename NextValue>
+		void insertRange(It first, It last, NextValue nextValue)
+		{
+			const std::size_t start = dense.size();
+			if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>)
+			{
+				reserve(start + (std::size_t)std::distance(first, last));
+			}
+
+			const Tick tick = stampTick();
+			for (; first != last; ++first)
+			{
+				const Entity entity = *first;
+				const Entity index = EntityTraits::toIndex(entity);
+				if (has(entity))
+				{
+					// 既に存在する場合は上書き＆更新通知（emplace と同じ）
+					const Entity pos = sparse.get(index);
+					data[pos] = nextValue();
+					changedTicks[pos] = tick;
+					onUpdate.publish(entity);
+					continue;
+				}
+
+				sparse.insert(index, (Entity)dense.size());
+				dense.push_back(entity);
+				data.push_back(nextValue());
+				enabled.push_back(true);
+				addedTicks.push_back(tick);
+				changedTicks.push_back(tick);
+				updateSignature(index, true);
+			}
+
+			const std::size_t count = dense.size() - start;
+			if (count == 0 || onConstructRange.empty()) return;
+
+			// 通知先（Group）が並び替える可能性があるため、追加分の一覧を控えてから通知する
+			std::vector<Entity> added(dense.begin() + start, dense.end());
+			onConstructRange.publish(added.data(), added.size());
+		}
+
+		SparsePages sparse;			// Entity Index -> Dense Index（ページ分割）
+		std::vector<Entity> dense;	// Dense Index -> Entity ID
+		ComponentStorage<T> data;	// Component Data（Dense配列と同期 / StorageTraits で格納方法を選べる）
+		EnabledBits enabled;		// コンポーネントごとの有効フラグ（Dense配列と同期）
+		std::vector<Tick> addedTicks;	// 追加されたティック（Dense配列と同期）
+		std::vector<Tick> changedTicks;	// 最後に書き込まれたティック（Dense配列と同期）
+	};
+
+	// Group の非所有（参照のみ）コンポーネント指定用タグ
+	// 例: registry.group<Collider, WorldCollider>(With<Transform>{})
+	template<typename... Components>
+	struct With {};
+
+	// Query の除外コンポーネント指定用タグ
+	// 例: registry.query<Transform, EnemyStats>(Without<BossAI>{})
+	template<typename... Components>
+	struct Without {};
+
+	// ------------------------------------------------------------
+	// CommandBuffer（構造変更の遅延実行）
+	// ------------------------------------------------------------
+	class Registry;
+
+	/**
+	 * @class	CommandBuffer
+	 * @brief	create / destroy / emplace / remove / setActive を記録し、後でまとめて適用する
+	 *
+	 * @details
+	 * 走査中に destroy() すると swap-remove で走査中の配列が崩れるため、
+	 * 構造変更はここに積んでおき、World::Tick の同期点で playback() する。
+	 * - スレッドごとに記録先（Stream）が分かれるため、複数スレッドから同時に記録できる
+	 * - create() は仮ハンドル（世代 = VersionMask）を返し、playback 時に本物へ置き換える
+	 * - 適用順は 作成 -> 追加 -> 削除 -> Active 変更 -> 破棄 の固定順（型 / インデックス順に整列して一括処理）
+	 * - 記録内容の参照（isQueuedForDestroy / empty / clear）は他スレッドの Stream も読むため、
+	 *   ジョブの中（並列段）では自スレッドの Stream だけを見る / 呼ばない
+	 * - Stream はシステム単位ではなくスレッド単位なので、同じ段の2つのシステムが同じワーカーで
+	 *   続けて動いた場合、後のシステムからは先のシステムの destroy が isQueuedForDestroy で見える
+	 *   （別のワーカーなら見えない）。結果がこれに左右されないよう、見えなくても正しく動くように書く
+	 */
+	class CommandBuffer
+	{
+	public:
+		static constexpr std::size_t MaxThreads = 64;
+
+		CommandBuffer() = default;
+		CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		// 仮ハンドルか判定
+		static bool isPending(Entity entity)
+		{
+			return entity != NullEntity && EntityTraits::toVersion(entity) == EntityTraits::VersionMask;
+		}
+
+		// Entity作成の予約（仮ハンドルを返す。同じバッファへの emplace 等に使える）
+		Entity create()
+		{
+			Entity index = pendingCount.fetch_add(1, std::memory_order_relaxed);
+			assert(index < EntityTraits::IndexMask && "Too many pending entities");
+			return EntityTraits::combine(index, EntityTraits::VersionMask);
+		}
+
+		// Entity破棄の予約
+		void destroy(Entity entity)
+		{
+			if (entity == NullEntity) return;
+
+			Stream& stream = local();
+			stream.destroys.push_back(entity);
+			(isPending(entity) ? stream.pendingDestroyed : stream.destroyed).set(EntityTraits::toIndex(entity));
+		}
+
+		// コンポーネント追加の予約（既に持っている場合は上書き）
+		template<typename T, typename... Args>
+		void emplace(Entity entity, Args&&... args)
+		{
+			const std::size_t typeId = ComponentFamily::type<T>();
+			Stream& stream = local();
+			if (stream.emplaces.size() <= typeId) stream.emplaces.resize(typeId + 1);
+
+			auto& queue = stream.emplaces[typeId];
+			if (!queue) queue = std::make_unique<ComponentQueue<T>>();
+			static_cast<ComponentQueue<T>*>(queue.get())->items.emplace_back(entity, T(std::forward<Args>(args)...));
+		}
+
+		// コンポーネント削除の予約
+		template<typename T>
+		void remove(Entity entity)
+		{
+			const std::size_t typeId = ComponentFamily::type<T>();
+			Stream& stream = local();
+			if (stream.removes.size() <= typeId) stream.removes.resize(typeId + 1);
+			stream.removes[typeId].push_back(entity);
+		}
+
+		// Active変更の予約
+		void setActive(Entity entity, bool active)
+		{
+			local().actives.emplace_back(entity, active);
+		}
+
+		// 破棄が予約済みか（同フレーム内での二重処理の防止用）
+		// ※ ジョブの中からは自スレッドで記録した分だけを見る（他スレッドは記録中の可能性があるため）
+		//   同じ段で並列に動く別システムの予約は、段の終わりの playback まで見えない
+		bool isQueuedForDestroy(Entity entity) const
+		{
+			const bool ownOnly = JobSystem::IsInsideJob();
+			const std::thread::id self = std::this_thread::get_id();
+
+			const std::size_t count = std::min(usedStreams.load(std::memory_order_acquire), MaxThreads);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (ownOnly && slots[i].owner.load(std::memory_order_acquire) != self) continue;
+
+				const Stream* stream = slots[i].stream.load(std::memory_order_acquire);
+				if (!stream) continue;
+				if (stream->isDestroyQueued(entity)) return true;
+			}
+			return false;
+		}
+
+		// 記録内容が無いか（同期点から呼ぶこと）
+		bool empty() const
+		{
+			assert(!JobSystem::IsInsideJob() && "CommandBuffer::empty must be called at a sync point");
+			if (pendingCount.load(std::memory_order_relaxed) != 0) return false;
+
+			const std::size_t count = std::min(usedStreams.load(std::memory_order_acquire), MaxThreads);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const Stream* stream = slots[i].stream.load(std::memory_order_acquire);
+				if (stream && !stream->empty()) return false;
+			}
+			return true;
+		}
+
+		// 記録内容を Registry に適用する（メインスレッドから呼ぶこと）
+		void playback(Registry& registry);
+
+		// 記録内容の破棄（確保済みの容量は残す / 同期点から呼ぶこと）
+		void clear()
+		{
+			assert(!JobSystem::IsInsideJob() && "CommandBuffer::clear must be called at a sync point");
+			const std::size_t count = std::min(usedStreams.load(std::memory_order_acquire), MaxThreads);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (Stream* stream = slots[i].stream.load(std::memory_order_acquire)) stream->clear();
+			}
+			pendingCount.store(0, std::memory_order_relaxed);
+		}
+
+	private:
+		// 型消去したコンポーネント追加キュー
+		struct IComponentQueue
+		{
+			virtual ~IComponentQueue() = default;
+			virtual void apply(Registry& registry, const std::vector<Entity>& created) = 0;
+			virtual void clear() = 0;
+			virtual bool empty() const = 0;
+		};
+
+		template<typename T>
+		struct ComponentQueue : IComponentQueue
+		{
+			std::vector<std::pair<Entity, T>> items;
+
+			void apply(Registry& registry, const std::vector<Entity>& created) override;
+			void clear() override { items.clear(); }
+			bool empty() const override { return items.empty(); }
+		};
+
+		// Entity インデックスのビット集合（isQueuedForDestroy を O(1) にするため / 立てた分だけ戻す）
+		struct IndexBits
+		{
+			std::vector<uint64_t> words;
+
+			void set(Entity index)
+			{
+				const std::size_t word = index / 64;
+				if (words.size() <= word) words.resize(word + 1, 0);
+				words[word] |= uint64_t(1) << (index % 64);
+			}
+
+			bool test(Entity index) const
+			{
+				const std::size_t word = index / 64;
+				return word < words.size() && ((words[word] >> (index % 64)) & 1);
+			}
+
+			void reset(Entity index)
+			{
+				const std::size_t word = index / 64;
+				if (word < words.size()) words[word] &= ~(uint64_t(1) << (index % 64));
+			}
+		};
+
+		// スレッドごとの記録先
+		struct Stream
+		{
+			std::vector<Entity> destroys;
+			IndexBits destroyed;		// destroys のうち本物のハンドル（インデックスで引く）
+			IndexBits pendingDestroyed;	// destroys のうち仮ハンドル（仮インデックスで引く）
+			std::vector<std::pair<Entity, bool>> actives;
+			std::vector<std::unique_ptr<IComponentQueue>> emplaces;	// 型ID -> キュー
+			std::vector<std::vector<Entity>> removes;					// 型ID -> 対象
+
+			bool empty() const
+			{
+				if (!destroys.empty() || !actives.empty()) return false;
+				for (auto& queue : emplaces) if (queue && !queue->empty()) return false;
+				for (auto& list : removes) if (!list.empty()) return false;
+				return true;
+			}
+
+			// ※ 生存中の Entity は同じインデックスに1つしかないので、インデックスだけで判定できる
+			bool isDestroyQueued(Entity entity) const
+			{
+				return (isPending(entity) ? pendingDestroyed : destroyed).test(EntityTraits::toIndex(entity));
+			}
+
+			void clear()
+			{
+				for (Entity entity : destroys) (isPending(entity) ? pendingDestroyed : destroyed).reset(EntityTraits::toIndex(entity));
+				destroys.clear();
+				actives.clear();
+				for (auto& queue : emplaces) if (queue) queue->clear();
+				for (auto& list : removes) list.clear();
+			}
+		};
+
+		// ※ stream は記録スレッドが遅延生成するので、他スレッドからは acquire で読む
+		struct Slot
+		{
+			std::atomic<std::thread::id> owner{};
+			std::atomic<Stream*> stream{ nullptr };
+			std::unique_ptr<Stream> storage;	// 所有（生成したスレッドだけが触る）
+		};
+
+		// 呼び出しスレッドの Stream を取得（初回のみ空きスロットを確保）
+		Stream& local()
+		{
+			const std::thread::id self = std::this_thread::get_id();
+			const std::size_t count = std::min(usedStreams.load(std::memory_order_acquire), MaxThreads);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (slots[i].owner.load(std::memory_order_acquire) == self) return *slots[i].stream.load(std::memory_order_relaxed);
+			}
+
+			const std::size_t index = usedStreams.fetch_add(1, std::memory_order_acq_rel);
+			assert(index < MaxThreads && "CommandBuffer: too many recording threads");
+			Slot& slot = slots[index];
+			slot.storage = std::make_unique<Stream>();
+			slot.stream.store(slot.storage.get(), std::memory_order_release);
+			slot.owner.store(self, std::memory_order_release);
+			return *slot.storage;
+		}
+
+		// 仮ハンドルを本物に置き換える
+		static Entity resolve(Entity entity, const std::vector<Entity>& created)
+		{
+			return isPending(entity) ? created[EntityTraits::toIndex(entity)] : entity;
+		}
+
+		std::atomic<Entity> pendingCount{ 0 };
+		std::atomic<std::size_t> usedStreams{ 0 };
+		std::array<Slot, MaxThreads> slots;
+	};
+
+	// ------------------------------------------------------------
+	// RegistryContext（Registry 単位のシングルトン置き場）
+	// ------------------------------------------------------------
+	/**
+	 * @class	RegistryContext
+	 * @brief	型をキーに1つだけ値を持つ保管庫
+	 *
+	 * @details
+	 * エンティティにする必要のない「シーンに1つだけのデータ」（進行状況・設定など）を置く。
+	 * Registry::clear() で一緒に破棄される。
+	 * ※ 表の操作はロックで保護する（並列ステージのシステムからも呼べる）
+	 * ※ erase / 置き換えると、以前に取得した参照は無効になる
+	 */
+	class RegistryContext
+	{
+	public:
+		// 追加（既にあれば置き換える）
+		template<typename T, typename... Args>
+		T& emplace(Args&&... args)
+		{
+			auto value = std::make_shared<T>(std::forward<Args>(args)...);
+			T& ref = *value;
+			std::lock_guard<std::mutex> lock(mutex);
+			values[std::type_index(typeid(T))] = std::move(value);
+			return ref;
+		}
+
+		// 取得（無ければ assert）
+		template<typename T>
+		T& get()
+		{
+			T* value = find<T>();
+			assert(value && "Context value is not registered");
+			return *value;
+		}
+
+		// 取得（無ければ nullptr）
+		template<typename T>
+		T* find()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			auto it = values.find(std::type_index(typeid(T)));
+			return it != values.end() ? static_cast<T*>(it->second.get()) : nullptr;
+		}
+
+		template<typename T>
+		bool contains() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return values.find(std::type_index(typeid(T))) != values.end();
+		}
+
+		template<typename T>
+		void erase()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			values.erase(std::type_index(typeid(T)));
+		}
+
+		void clear()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			values.clear();
+		}
+
+	private:
+		std::unordered_map<std::type_index, std::shared_ptr<void>> values;
+		mutable std::mutex mutex;
+	};
+
+	/**
+	 * @struct	RegistryStats
+	 * @brief	Registry::stats() の結果（エンティティ管理分 + プール毎）
+	 */
+	struct RegistryStats
+	{
+		std::size_t aliveEntities = 0;		// 生存数
+		std::size_t entitySlots = 0;		// 発行済みのインデックス数（削除済みを含む）
+		std::size_t entityBytesUsed = 0;	// エンティティ管理配列（ハンドル / 所持マスク / Active）
+		std::size_t entityBytesReserved = 0;
+		std::vector<PoolStats> pools;		// 型ID順（未生成のプールは含まない）
+
+		std::size_t totalBytesUsed() const
+		{
+			std::size_t total = entityBytesUsed;
+			for (const PoolStats& pool : pools) total += pool.bytesUsed;
+			return total;
+		}
+
+		std::size_t totalBytesReserved() const
+		{
+			std::size_t total = entityBytesReserved;
+			for (const PoolStats& pool : pools) total += pool.bytesReserved;
+			return total;
+		}
+	};
+
+	// ------------------------------------------------------------
+	// 3. Registry
+	// ------------------------------------------------------------
+	class Registry
+	{
+		// インデックス -> 現在のハンドル（世代込み）
+		// 空きスロットには「次の空きインデックス + 次に使う世代」を格納する（侵入型フリーリスト）
+		// 0番は無効IDとして予約
+		std::vector<Entity> entities = { NullEntity };
+		// フリーリストの先頭（空きが無ければ IndexMask）
+		Entity freeHead = EntityTraits::IndexMask;
+		// 生存しているエンティティの密な一覧（削除は末尾と入れ替えて O(1)）
+		std::vector<Entity> alive;
+		// インデックス -> alive 内の位置（0番は未使用）
+		std::vector<Entity> alivePositions = { NullEntity };
+		std::vector<std::unique_ptr<IPool>> pools;
+		// インデックス -> 所持コンポーネントのマスク
+		std::vector<ComponentMask> signatures = { ComponentMask{} };
+		std::vector<bool> entityActiveStates;			// 自身の Active 設定
+		std::vector<bool> effectiveActiveStates;		// 親を考慮した Active 状態（キャッシュ）
+		std::function<Entity(Entity)> m_parentLookup;
+		std::function<void(Entity, std::vector<Entity>&)> m_childrenLookup;
+
+		// Owning Group の管理情報
+		struct GroupData
+		{
+			Registry* owner = nullptr;	// Signal から呼ばれる際の戻り先
+			ComponentMask owned;	// 所有（並び替える）コンポーネント
+			ComponentMask required;	// 所属条件（所有 + 参照）
+			std::size_t length = 0;	// 各所有プール先頭の [0, length) がメンバー
+		};
+		std::vector<std::unique_ptr<GroupData>> groups;
+
+		// 永続 Query の管理情報（一致するエンティティの密な一覧）
+		struct QueryData
+		{
+			// 除外コンポーネントの削除通知用（どの型の削除かを Delegate に持たせる）
+			struct ExcludeHook
+			{
+				QueryData* query;
+				std::size_t typeId;
+			};
+
+			Registry* owner = nullptr;		// Signal から呼ばれる際の戻り先
+			ComponentMask include;			// 必須コンポーネント
+			ComponentMask exclude;			// 除外コンポーネント
+			std::vector<Entity> dense;		// 一致するエンティティ
+			SparsePages positions;			// Entity Index -> dense の位置
+			std::atomic<bool> dirty{ true };	// true なら次回アクセス時に作り直す
+			std::deque<ExcludeHook> excludeHooks;	// 要素のアドレスを Delegate が保持するため deque
+		};
+		std::vector<std::unique_ptr<QueryData>> queries;
+
+		// 遅延実行用のコマンドバッファ
+		CommandBuffer commandBuffer;
+
+		// Registry 単位のシングルトン
+		RegistryContext context;
+
+		// Group / Query の遅延生成・再構築を並列実行中のシステムから守る
+		std::mutex lazyInitMutex;
+
+		// 最新の変更ティック（World がシステム実行毎に進める）
+		std::atomic<Tick> worldTick{ 1 };
+
+	public:
+		// EntityのActive状態が変わった時の通知（Query の更新用）
+		Signal<Entity> onActiveChanged;
+
+		Registry() = default;
+		// プールが signatures を参照しているためコピー/ムーブ禁止
+		Registry(const Registry&) = delete;
+		Registry& operator=(const Registry&) = delete;
+
+		// -----------------------------------------------------------
+		// 自動検知用ラッパー
+		// -----------------------------------------------------------
+		template<typename T>
+		struct ScopedComponent
+		{
+			Registry* registry;
+			Entity entity;
+			T* component;
+
+			ScopedComponent(Registry* r, Entity e, T* c) : registry(r), entity(e), component(c) {}
+
+			~ScopedComponent()
+			{
+				if (registry && component)
+				{
+					registry->patch<T>(entity);
+				}
+			}
+
+			T* operator->() { return component; }
+			T& operator*() { return *component; }
+		};
+
+		// -----------------------------------------------------------
+		// 基本機能
+		// -----------------------------------------------------------
+		// 型Tに対応するプールを取得（無ければ作成）
+		template<typename T>
+		SparseSet<T>& getPool()
+		{
+			std::size_t componentId = ComponentFamily::type<T>();
+			if (componentId >= pools.size())
+			{
+				pools.resize(componentId + 1);
+			}
+			if (!pools[componentId])
+			{
+				assert(componentId < MaxComponents && "Too many component types (raise MaxComponents)");
+				pools[componentId] = std::make_unique<SparseSet<T>>();
+				pools[componentId]->typeId = componentId;
+				pools[componentId]->signatures = &signatures;
+				pools[componentId]->worldTick = &worldTick;
+			}
+			return *static_cast<SparseSet<T>*>(pools[componentId].get());
+		}
+
+		// プールが存在するか確認（安全なアクセスの為）
+		template<typename T>
+		bool hasPool() const
+		{
+			std::size_t componentId = ComponentFamily::type<T>();
+			return componentId < pools.size() && pools[componentId] != nullptr;
+		}
+
+		// 汎用プール取得
+		IPool* getPoolBase(std::size_t typeId)
+		{
+			if (typeId < pools.size())
+			{
+				return pools[typeId].get();
+			}
+			return nullptr;
+		}
+
+		// -----------------------------------------------------------
+		// メモリ / 使用状況（SystemMonitorWindow の表示や、長時間プレイ後の調査用）
+		// -----------------------------------------------------------
+		// 全プールとエンティティ管理配列の統計を取得する
+		RegistryStats stats() const
+		{
+			RegistryStats out;
+			out.aliveEntities = alive.size();
+			out.entitySlots = entities.size() - 1;	// 0番は予約
+			out.entityBytesUsed =
+				(entities.size() + alive.size() + alivePositions.size()) * sizeof(Entity) +
+				signatures.size() * sizeof(ComponentMask) +
+				(entityActiveStates.size() + effectiveActiveStates.size() + 7) / 8;
+			out.entityBytesReserved =
+				(entities.capacity() + alive.capacity() + alivePositions.capacity()) * sizeof(Entity) +
+				signatures.capacity() * sizeof(ComponentMask) +
+				(entityActiveStates.capacity() + effectiveActiveStates.capacity() + 7) / 8;
+
+			for (const auto& pool : pools)
+			{
+				if (pool) out.pools.push_back(pool->stats());
+			}
+			return out;
+		}
+
+		// 全プールとエンティティ管理配列の余った容量を解放する
+		// ※ 走査中・システム実行中には呼ばない（シーン遷移後やメニュー操作から呼ぶ）
+		void trim()
+		{
+			for (auto& pool : pools)
+			{
+				if (pool) pool->shrinkToFit();
+			}
+			alive.shrink_to_fit();
+			entities.shrink_to_fit();
+			alivePositions.shrink_to_fit();
+			signatures.shrink_to_fit();
+			entityActiveStates.shrink_to_fit();
+			effectiveActiveStates.shrink_to_fit();
+		}
+
+		// 指定した型のプールだけ余った容量を解放する
+		template<typename T>
+		void trim()
+		{
+			if (hasPool<T>()) getPool<T>().shrinkToFit();
+		}
+
+		// 親取得関数のセット
+		void SetParentLookup(std::function<Entity(Entity)> func)
+		{
+			m_parentLookup = func;
+		}
+
+		// 子の列挙関数のセット（子を第2引数の末尾に追加する / Active状態の伝播に使用）
+		void SetChildrenLookup(std::function<void(Entity, std::vector<Entity>&)> func)
+		{
+			m_childrenLookup = func;
+		}
+
+		// 構造変更の遅延実行用バッファ（World::Tick の同期点で適用される）
+		CommandBuffer& commands() { return commandBuffer; }
+
+		// -----------------------------------------------------------
+		// プールの並び替え（描画のバッチ化・親を子より先に並べる等）
+		// ※ Group が所有する型は Group::sort を使う（所有範囲の並びが崩れるため）
+		// -----------------------------------------------------------
+		// compare: bool(const T&, const T&) または bool(Entity, Entity)
+		template<typename T, typename Compare>
+		void sort(Compare compare)
+		{
+			assert(!isGroupOwned(ComponentFamily::type<T>()) && "Use Group::sort for owned components");
+			getPool<T>().sort(compare);
+		}
+
+		// To のプールを From のプールと同じ並びにする（共通のエンティティを先頭へ）
+		template<typename To, typename From>
+		void sort_as()
+		{
+			assert(!isGroupOwned(ComponentFamily::type<To>()) && "Use Group::sort for owned components");
+			getPool<To>().sort_as(getPool<From>());
+		}
+
+		// Registry 単位のシングルトン（ctx().emplace<T>() / ctx().get<T>()）
+		RegistryContext& ctx() { return context; }
+
+		// -----------------------------------------------------------
+		// 唯一コンポーネント（プレイヤー・メインカメラなど、1体しか持たない型）
+		// -----------------------------------------------------------
+		// 所持者の追跡を有効にする（既存の所持者も拾う）
+		// ※ 2体目に追加された場合は警告を出し、先に持っていた方を維持する
+		// ※ 所持者の削除 / コンポーネントの削除で自動的に外れる
+		template<typename T>
+		void setUnique()
+		{
+			SparseSet<T>& pool = getPool<T>();
+			std::lock_guard<std::mutex> lock(lazyInitMutex);
+			if (pool.uniqueTracked.load(std::memory_order_acquire)) return;
+
+			const std::vector<Entity>& owners = pool.getEntities();
+			pool.uniqueOwner = owners.empty() ? NullEntity : owners.front();
+			pool.onConstruct.template connect<&Registry::uniqueConstruct>(static_cast<IPool&>(pool));
+			pool.onConstructRange.template connect<&Registry::uniqueConstructRange>(static_cast<IPool&>(pool));
+			pool.onDestroy.template connect<&Registry::uniqueDestroy>(static_cast<IPool&>(pool));
+			pool.uniqueTracked.store(true, std::memory_order_release);
+		}
+
+		// 唯一コンポーネントの所持者を O(1) で取得（居なければ NullEntity）
+		// ※ 初回呼び出し時に setUnique<T>() される
+		template<typename T>
+		Entity unique()
+		{
+			if (!hasPool<T>()) return NullEntity;
+			SparseSet<T>& pool = getPool<T>();
+			if (!pool.uniqueTracked.load(std::memory_order_acquire)) setUnique<T>();
+			return pool.uniqueOwner;
+		}
+
+		// Entity作成
+		Entity create()
+		{
+			Entity id;
+			if (freeHead != EntityTraits::IndexMask)
+			{
+				// フリーリストから取り出し、格納されていた世代で復活させる
+				Entity index = freeHead;
+				freeHead = EntityTraits::toIndex(entities[index]);
+				id = EntityTraits::combine(index, EntityTraits::toVersion(entities[index]));
+				entities[index] = id;
+			}
+			else
+			{
+				Entity index = (Entity)entities.size();
+				assert(index < EntityTraits::IndexMask && "Entity index overflow");
+				id = EntityTraits::combine(index, 0);
+				entities.push_back(id);
+				signatures.emplace_back();
+				alivePositions.emplace_back();
+			}
+
+			alivePositions[EntityTraits::toIndex(id)] = (Entity)alive.size();
+			alive.push_back(id);
+
+			Entity index = EntityTraits::toIndex(id);
+			if (entityActiveStates.size() <= index)
+			{
+				entityActiveStates.resize(index + 1, true);
+				effectiveActiveStates.resize(index + 1, true);
+			}
+			entityActiveStates[index] = true;
+			effectiveActiveStates[index] = true;	// 作成直後は親なし
+
+			return id;
+		}
+
+		// Entityの一括作成（count 体分を out に書き出す）
+		template<typename OutputIt>
+		void create(std::size_t count, OutputIt out)
+		{
+			// フリーリストで足りない分だけ、管理配列をまとめて確保する
+			const std::size_t capacity = entities.size() + count;
+			entities.reserve(capacity);
+			signatures.reserve(capacity);
+			alivePositions.reserve(capacity);
+			alive.reserve(alive.size() + count);
+			entityActiveStates.reserve(capacity);
+			effectiveActiveStates.reserve(capacity);
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				*out++ = create();
+			}
+		}
+
+		// EntityのActive操作
+		void setActive(Entity entity, bool active)
+		{
+			if (valid(entity))
+			{
+				Entity index = EntityTraits::toIndex(entity);
+				if (entityActiveStates[index] == active) return;
+				entityActiveStates[index] = active;
+				updateActiveHierarchy(entity);
+			}
+		}
+
+		// 親を考慮したActive状態（キャッシュ済みのビットを参照するだけ）
+		bool isActive(Entity entity) const
+		{
+			return valid(entity) && effectiveActiveStates[EntityTraits::toIndex(entity)];
+		}
+
+		// 親子関係が変わった時に呼ぶ（entity 以下のサブツリーを再計算）
+		void updateActiveHierarchy(Entity entity)
+		{
+			std::vector<Entity> stack = { entity };
+			while (!stack.empty())
+			{
+				Entity current = stack.back();
+				stack.pop_back();
+				if (!valid(current)) continue;
+
+				Entity index = EntityTraits::toIndex(current);
+				const bool active = computeActive(current);
+				if (effectiveActiveStates[index] == active) continue;	// 変化が無ければ子孫も変わらない
+
+				effectiveActiveStates[index] = active;
+				onActiveChanged.publish(current);
+
+				if (m_childrenLookup) m_childrenLookup(current, stack);
+			}
+		}
+
+		// 全エンティティのActive状態を作り直す（シーン読み込み後など）
+		void rebuildActiveHierarchy()
+		{
+			std::vector<bool> previous = effectiveActiveStates;
+
+			// 親から順に確定させるため、ルートから子へ辿る
+			std::fill(effectiveActiveStates.begin(), effectiveActiveStates.end(), false);
+			std::vector<Entity> stack;
+			each([&](Entity entity) {
+				Entity parent = m_parentLookup ? m_parentLookup(entity) : NullEntity;
+				if (parent == NullEntity) stack.push_back(entity);
+			});
+
+			while (!stack.empty())
+			{
+				Entity current = stack.back();
+				stack.pop_back();
+				if (!valid(current)) continue;
+
+				Entity index = EntityTraits::toIndex(current);
+				effectiveActiveStates[index] = computeActive(current);
+
+				if (m_childrenLookup) m_childrenLookup(current, stack);
+			}
+
+			// 変化したものだけ通知
+			each([&](Entity entity) {
+				Entity index = EntityTraits::toIndex(entity);
+				if (previous[index] != effectiveActiveStates[index]) onActiveChanged.publish(entity);
+			});
+		}
+
+		// 自分自身のActive設定だけを知りたい場合
+		bool isActiveSelf(Entity entity) const
+		{
+			if (!valid(entity)) return false;
+			Entity index = EntityTraits::toIndex(entity);
+			if (index >= entityActiveStates.size()) return true;
+			return entityActiveStates[index];
+		}
+
+		// コンポーネントのEnabled操作ヘルパー
+		template<typename T>
+		void setComponentEnabled(Entity entity, bool enabled)
+		{
+			getPool<T>().SetEnabled(entity, enabled);
+		}
+
+		template<typename T>
+		bool isComponentEnabled(Entity entity)
+		{
+			return getPool<T>().IsEnabled(entity);
+		}
+
+		// コンポーネント追加
+		template<typename T, typename... Args>
+		T& emplace(Entity entity, Args&&... args)
+		{
+			return getPool<T>().emplace(entity, std::forward<Args>(args)...);
+		}
+
+		// コンポーネントの一括追加（全員に同じ値 / 通知は onConstructRange の1回）
+		template<typename T, typename It>
+		void insert(It first, It last, const T& value = {})
+		{
+			getPool<T>().insert(first, last, value);
+		}
+
+		// コンポーネントの一括追加（値の範囲を対応付ける）
+		template<typename T, typename It, std::input_iterator ValueIt>
+		void insert(It first, It last, ValueIt values)
+		{
+			getPool<T>().insert(first, last, values);
+		}
+
+		// コンポーネント配列の事前確保
+		template<typename T>
+		void reserve(std::size_t capacity)
+		{
+			getPool<T>().reserve(capacity);
+		}
+
+		// コンポーネントを持っているか確認（所持マスクで判定）
+		template<typename T>
+		bool has(Entity entity) const
+		{
+			return valid(entity) && signatures[EntityTraits::toIndex(entity)].test(ComponentFamily::type<T>());
+		}
+
+		// 所持コンポーネントのマスクを取得
+		const ComponentMask& getSignature(Entity entity) const
+		{
+			return signatures[EntityTraits::toIndex(entity)];
+		}
+
+		// エンティティが有効（存在している）か判定
+		bool valid(Entity entity) const
+		{
+			// スロットに格納されている現在のハンドル（世代込み）と一致するか
+			// ※ 空きスロットには別インデックスが入っているため、削除済みIDは一致しない
+			Entity index = EntityTraits::toIndex(entity);
+			return index < entities.size() && entities[index] == entity;
+		}
+
+		// 読み取り用
+		template<typename T>
+		const T& get(Entity entity) const
+		{
+			return const_cast<Registry*>(this)->getPool<T>().get(entity);
+		}
+
+		// 書き込み用（変更ティックを記録する）
+		// ※ 非 const の Registry からの get は、戻り値を const 参照で受けても「書き込み」として記録される
+		//   読むだけの箇所は read<T> を使うこと（毎フレーム読むだけで changed / Observer に拾われ続けるため）
+		template<typename T>
+		T& get(Entity entity)
+		{
+			assert(isWriteDeclared<T>(entity) && "Registry::get: write access to this component is not declared (use read<T> to only read)");
+			SparseSet<T>& pool = getPool<T>();
+			T& component = pool.get(entity);	// 所持の確認を先に済ませる
+			pool.markChanged(entity, pool.stampTick());
+			return component;
+		}
+
+		// 実行中のシステムが entity の T への書き込みを宣言しているか（get の確認用）
+		// ※ 宣言の無いシステムとシステム外は常に true
+		template<typename T>
+		bool isWriteDeclared(Entity entity)
+		{
+			const SystemAccess* access = ChangeTicks::Current().access;
+			return !access || allowsWrite(*access, *this, entity, ComponentFamily::type<T>());
+		}
+
+		// 読み取り用（非 const の Registry からでも変更扱いにしない）
+		template<typename T>
+		const T& read(Entity entity)
+		{
+			return getPool<T>().get(entity);
+		}
+
+		// 前回の実行（lastRun）以降に T が書き込まれたか
+		template<typename T>
+		bool isChanged(Entity entity, Tick since = ChangeTicks::Current().lastRun)
+		{
+			return isNewerTick(getPool<T>().changedTick(entity), since);
+		}
+
+		// 前回の実行（lastRun）以降に T が追加されたか
+		template<typename T>
+		bool isAdded(Entity entity, Tick since = ChangeTicks::Current().lastRun)
+		{
+			return isNewerTick(getPool<T>().addedTick(entity), since);
+		}
+
+		// 変更ティックを1つ進めて返す（World がシステム実行前に呼ぶ）
+		Tick advanceTick()
+		{
+			return worldTick.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		// 発行済みの最新ティック
+		Tick currentTick() const
+		{
+			return worldTick.load(std::memory_order_relaxed);
+		}
+
+		// 書き込みを記録するティック（SparseSet::stampTick と同じ）
+		Tick stampTick() const
+		{
+			const Tick current = ChangeTicks::Current().thisRun;
+			return current != 0 ? current : worldTick.load(std::memory_order_relaxed) + 1;
+		}
+
+		// 変更検知付き書き込み用
+		template<typename T>
+		ScopedComponent<T> modify(Entity entity)
+		{
+			return ScopedComponent<T>(this, entity, &getPool<T>().get(entity));
+		}
+
+		// 変更通知を手動で送る
+		template<typename T>
+		void patch(Entity entity)
+		{
+			getPool<T>().patch(entity);
+		}
+
+		// コンポーネント削除
+		template<typename T>
+		void remove(Entity entity)
+		{
+			getPool<T>().remove(entity);
+		}
+
+		void destroy(Entity entity)
+		{
+			// 二重削除の防止
+			if (!valid(entity)) return;
+
+			// 子は親を失うと非Activeになるため、削除前に子リストを控えておく
+			std::vector<Entity> orphans;
+			if (m_childrenLookup) m_childrenLookup(entity, orphans);
+
+			// 所持しているプールだけを巡回（remove 中にマスクが変わるのでコピーを使う）
+			Entity index = EntityTraits::toIndex(entity);
+			const ComponentMask owned = signatures[index];
+			owned.forEach([&](std::size_t typeId) {
+				pools[typeId]->remove(entity);
+			});
+			signatures[index].clear();
+
+			// 世代を進めてフリーリストの先頭に繋ぐ（VersionMask は CommandBuffer の仮ハンドル用に予約）
+			Entity nextVersion = EntityTraits::toVersion(entity) + 1;
+			if (nextVersion >= EntityTraits::VersionMask) nextVersion = 0;
+			entities[index] = EntityTraits::combine(freeHead, nextVersion);
+			freeHead = index;
+			effectiveActiveStates[index] = false;
+
+			// 生存一覧から外す（末尾を空いた位置へ移す）
+			const Entity pos = alivePositions[index];
+			const Entity last = alive.back();
+			alive[pos] = last;
+			alivePositions[EntityTraits::toIndex(last)] = pos;
+			alive.pop_back();
+
+			for (Entity child : orphans) updateActiveHierarchy(child);
+		}
+
+		void clear()
+		{
+			for (auto& pool : pools)
+			{
+				if (pool) pool.reset();
+			}
+			pools.clear();
+			groups.clear();
+			queries.clear();
+			commandBuffer.clear();
+			context.clear();
+			onActiveChanged.clear();
+			entities.assign(1, NullEntity);
+			signatures.assign(1, ComponentMask{});
+			alive.clear();
+			alivePositions.assign(1, NullEntity);
+			freeHead = EntityTraits::IndexMask;
+			entityActiveStates.clear();
+			effectiveActiveStates.clear();
+		}
+
+		// @brief	全ての有効なエンティティに対して関数を実行する。
+		// @param	func 実行する関数 void(Entity)
+		// ※ 生存一覧だけを走査する（削除済みスロットは訪れない）
+		// ※ func 内で自身を削除しても良い（詰められた要素を続けて処理する）
+		template<typename Func>
+		void each(Func func)
+		{
+			for (std::size_t i = 0; i < alive.size();)
+			{
+				const Entity entity = alive[i];
+				func(entity);
+				if (i < alive.size() && alive[i] == entity) ++i;
+			}
+		}
+
+		// 生存しているエンティティ数
+		std::size_t aliveCount() const { return alive.size(); }
+
+		// 生存しているエンティティの一覧（順序は作成 / 削除で入れ替わる）
+		const std::vector<Entity>& getAliveEntities() const { return alive; }
+
+		// ============================================================
+		// 並列走査の規約（View / Query / Group の par_each 共通）
+		// ============================================================
+		// - func は複数のワーカースレッドから同時に呼ばれる
+		// - 書き換えてよいのは「渡された現在のエンティティのコンポーネント」のみ
+		//   （const 指定した型は読み取り専用。他エンティティの参照は読み取りのみ）
+		// - create / destroy / emplace / remove / setActive / SetEnabled 等の構造変更は禁止
+		//   → registry.commands() に記録し、システム終了後の再生に任せる
+		// - 変更ティックは各ジョブ内で記録される（呼び出し元システムのティックを引き継ぐ）
+		// ============================================================
+
+		// par_each の既定の分割単位（1ジョブあたりの最小要素数）
+		static constexpr std::size_t ParallelGrain = 256;
+
+		// ============================================================
+		// 走査時の変更ティック（View / Query / Group 共通）
+		// ============================================================
+		// - each / par_each は const でない型の変更ティックを、呼び出し後に記録する
+		// - func が bool を返す場合、true を返したエンティティだけを記録する
+		//   （Static な物体など、実際には書き換えなかった場合は false を返す）
+		// - .changed<T>() / .added<T>() は実行中システムの前回実行ティックより新しいものだけを通す
+		// ============================================================
+
+		// changed / added フィルタ（型を消して保持する）
+		struct TickFilter
+		{
+			IPool* pool;
+			Tick(*read)(IPool*, Entity);
+
+			bool passes(Entity entity, Tick since) const
+			{
+				return pool->has(entity) && isNewerTick(read(pool, entity), since);
+			}
+		};
+
+		template<typename T>
+		static Tick readChangedTick(IPool* pool, Entity entity) { return static_cast<SparseSet<T>*>(pool)->changedTick(entity); }
+
+		template<typename T>
+		static Tick readAddedTick(IPool* pool, Entity entity) { return static_cast<SparseSet<T>*>(pool)->addedTick(entity); }
+
+		// ============================================================
+		// Multi-View Class (Chainable)
+		// ============================================================ 
+		template<typename... Components>
+		class View
+		{
+			Registry* registry;
+			// 必要なプールへのポインタ（const 指定は読み取り専用の意味で、プールは共通）
+			std::tuple<SparseSet<std::remove_const_t<Components>>*...> pools;
+			// 必須コンポーネントのマスク
+			ComponentMask includeMask;
+			// 除外するコンポーネントのマスク
+			ComponentMask excludeMask;
+			// ループ駆動に使うプールのインデックス（最小サイズのプール）
+			std::size_t bestIndex = 0;
+			// changed / added フィルタと、その基準ティック
+			std::vector<TickFilter> filters;
+			Tick since = 0;
+
+		public:
+			View(Registry* r)
+				: registry(r), since(ChangeTicks::Current().lastRun)
+			{
+				// 全てのプールを取得
+				pools = std::make_tuple(&registry->getPool<std::remove_const_t<Components>>()...);
+				(includeMask.set(ComponentFamily::type<std::remove_const_t<Components>>()), ...);
+
+				// 最も要素数が少ないプールを探して駆動用にする（最適化）
+				std::size_t minsize = SIZE_MAX;
+				findSmallestPool(std::index_sequence_for<Components...>{}, minsize);
+			}
+
+			// 除外設定（.exclude<Static>()）
+			template<typename TExclude>
+			View& exclude()
+			{
+				excludeMask.set(ComponentFamily::type<TExclude>());
+				return *this;
+			}
+
+			// 変更フィルタ（.changed<Transform>()）：前回の実行以降に書き込まれたものだけ
+			template<typename... Ts>
+			View& changed()
+			{
+				(filters.push_back({ &registry->getPool<std::remove_const_t<Ts>>(), &readChangedTick<std::remove_const_t<Ts>> }), ...);
+				return *this;
+			}
+
+			// 追加フィルタ（.added<Collider>()）：前回の実行以降に追加されたものだけ
+			template<typename... Ts>
+			View& added()
+			{
+				(filters.push_back({ &registry->getPool<std::remove_const_t<Ts>>(), &readAddedTick<std::remove_const_t<Ts>> }), ...);
+				return *this;
+			}
+
+			// フィルタの基準ティックを指定（既定は実行中システムの前回実行ティック）
+			View& sinceTick(Tick tick)
+			{
+				since = tick;
+				return *this;
+			}
+
+			// 有効なエンティティ数
+			std::size_t size()
+			{
+				std::size_t count = 0;
+				for (auto e : *this)
+				{
+					count++;
+				}
+				return count;
+			}
+
+			// ヘルパー：最小プールを探す
+			template<std::size_t... Is>
+			void findSmallestPool(std::index_sequence<Is...>, std::size_t& minsize)
+			{
+				// fold expressionで各プールのサイズをチェック
+				((checkSize<Is>(minsize)), ...);
+			}
+
+			template<std::size_t I>
+			void checkSize(std::size_t& minsize)
+			{
+				auto* pool = std::get<I>(pools);
+				if (pool->size() < minsize)
+				{
+					minsize = pool->size();
+					bestIndex = I;
+				}
+			}
+
+			// -----------------------------------------------------------
+			// イテレータ（範囲for文用）
+			// -----------------------------------------------------------
+			struct Iterator
+			{
+				View* view;
+				// 駆動用プールのイテレータ
+				typename std::vector<Entity>::const_iterator current;
+				typename std::vector<Entity>::const_iterator end;
+
+				Iterator(View* v, typename std::vector<Entity>::const_iterator c, typename std::vector<Entity>::const_iterator e)
+					: view(v), current(c), end(e)
+				{
+					// 最初が有効化チェック、無効なら進める
+					if (current != end && !view->isValid(*current))
+					{
+						++(*this);
+					}
+				}
+
+				Entity operator*() const
+				{
+					return *current;
+				}
+
+				Iterator& operator++()
+				{
+					do
+					{
+						++current;
+					} while (current != end && !view->isValid(*current));
+					return *this;
+				}
+
+				bool operator!=(const Iterator& other) const
+				{
+					return current != other.current;
+				}
+			};
+
+			Iterator begin()
+			{
+				return createIterator(bestIndex);
+			}
+
+			Iterator end()
+			{
+				return createEndIterator(bestIndex);
+			}
+
+			// ヘルパー：インデックスからイテレータ生成
+			Iterator createIterator(std::size_t index)
+			{
+				const std::vector<Entity>* entities = nullptr;
+				std::size_t i = 0;
+				std::apply([&](auto*... p) {
+					((i++ == index ? entities = &p->getEntities() : nullptr), ...);
+					}, pools);
+
+				return Iterator(this, entities->begin(), entities->end());
+			}
+
+			Iterator createEndIterator(std::size_t index)
+			{
+				const std::vector<Entity>* entities = nullptr;
+				std::size_t i = 0;
+				std::apply([&](auto*... p) {
+					((i++ == index ? entities = &p->getEntities() : nullptr), ...);
+					}, pools);
+				return Iterator(this, entities->end(), entities->end());
+			}
+
+			// エンティティが条件を満たすかチェック
+			bool isValid(Entity entity)
+			{
+				if (!contains(entity)) return false;
+
+				// 変更フィルタ
+				for (const TickFilter& f : filters)
+				{
+					if (!f.passes(entity, since)) return false;
+				}
+				return true;
+			}
+
+			// エンティティが条件に一致しているか（変更フィルタ判定前）
+			bool contains(Entity entity)
+			{
+				// 1. エンティティ自体がActiveでなければスキップ
+				if (!registry->isActive(entity)) return false;
+
+				// 2. 所持マスクで Include / Exclude を一括判定
+				const ComponentMask& signature = registry->signatures[EntityTraits::toIndex(entity)];
+				if (signature.intersects(excludeMask)) return false;
+				if (!signature.containsAll(includeMask)) return false;
+
+				// 3. 有効状態チェック（所持は確認済み / 無効な要素が無いプールは省略）
+				bool allValid = std::apply([&](auto*... p)
+				{
+					return ((p->getEnabledBits().disabledCount() == 0 || p->isEnabledOwned(entity)) && ...);
+				}, pools);
+				return allValid;
+			}
+
+			// -----------------------------------------------------------
+			// each関数（ラムダ実行用）
+			// -----------------------------------------------------------
+			template<typename Func>
+			void each(Func func)
+			{
+				// 最適化されたループ（駆動プールの無効ワードは 64 個まとめて読み飛ばす）
+				const std::vector<Entity>& entities = drivingEntities();
+				const Tick tick = registry->stampTick();
+				scan(0, entities.size(), [&](std::size_t, Entity entity) {
+					// 全て持っているので関数実行
+					const bool changed = std::apply([&](auto... p) {
+						return invokeResult(func, entity, p->get(entity)...);
+						}, pools);
+
+					// 変更ティックの記録
+					if (changed) (stamp<Components>(entity, tick), ...);
+				});
+			}
+
+			// -----------------------------------------------------------
+			// par_each関数（JobSystem による並列実行）
+			// 引数: [](Entity e, Components&...) または [](std::size_t index, Entity e, Components&...)
+			// ※ 規約は Registry の「並列走査の規約」を参照
+			// -----------------------------------------------------------
+			template<typename Func>
+			void par_each(Func func, std::size_t grain = ParallelGrain)
+			{
+				const std::vector<Entity>& entities = drivingEntities();
+				const SystemTicks ticks = ChangeTicks::Current();
+				const Tick tick = registry->stampTick();
+
+				JobSystem::ParallelFor(entities.size(), grain, [&](std::size_t begin, std::size_t end) {
+					TickScope scope(ticks);
+					scan(begin, end, [&](std::size_t i, Entity entity) {
+						const bool changed = std::apply([&](auto*... p) {
+							return invokeEach(func, i, entity, p->get(entity)...);
+						}, pools);
+						if (changed) (stamp<Components>(entity, tick), ...);
+					});
+				});
+			}
+
+			// 特定コンポーネント取得ヘルパー（const でない型は変更ティックを記録する）
+			template<typename T>
+			T& get(Entity entity)
+			{
+				auto* pool = std::get<SparseSet<std::remove_const_t<T>>*>(pools);
+				T& component = pool->get(entity);
+				if constexpr (!std::is_const_v<T>)
+				{
+					assert(registry->isWriteDeclared<T>(entity) && "View::get: write access to this component is not declared (use get<const T> to only read)");
+					pool->markChanged(entity, pool->stampTick());
+				}
+				return component;
+			}
+
+		private:
+			// 駆動用プール（最小プール）のエンティティ列
+			const std::vector<Entity>& drivingEntities()
+			{
+				const std::vector<Entity>* entities = nullptr;
+				std::size_t i = 0;
+				std::apply([&](auto*... p) {
+					((i++ == bestIndex ? entities = &p->getEntities() : nullptr), ...);
+					}, pools);
+				return *entities;
+			}
+
+			// 駆動用プールの有効フラグ
+			const EnabledBits& drivingBits()
+			{
+				const EnabledBits* bits = nullptr;
+				std::size_t i = 0;
+				std::apply([&](auto*... p) {
+					((i++ == bestIndex ? bits = &p->getEnabledBits() : nullptr), ...);
+					}, pools);
+				return *bits;
+			}
+
+			// 駆動プールの [begin, end) のうち条件を満たすものに f(index, entity) を実行
+			// ※ ワード境界で有効フラグが全て 0 なら 64 個まとめて読み飛ばす
+			// ※ f 内で削除されても良いように、毎回サイズを確認する
+			template<typename F>
+			void scan(std::size_t begin, std::size_t end, F&& f)
+			{
+				const std::vector<Entity>& entities = drivingEntities();
+				const EnabledBits& bits = drivingBits();
+				const bool skipWords = bits.disabledCount() != 0;
+				for (std::size_t i = begin; i < end && i < entities.size(); ++i)
+				{
+					if (skipWords && i % EnabledBits::WordBits == 0 && bits.word(i / EnabledBits::WordBits) == 0)
+					{
+						i += EnabledBits::WordBits - 1;
+						continue;
+					}
+					const Entity entity = entities[i];
+					if (isValid(entity)) f(i, entity);
+				}
+			}
+
+			// 変更ティックの記録（const修飾されていない型のみ / func 内で削除されたものは除く）
+			template<typename T>
+			void stamp(Entity e, Tick tick)
+			{
+				if constexpr (!std::is_const_v<T>)
+				{
+					auto* pool = std::get<SparseSet<T>*>(pools);
+					if (pool->has(e)) pool->markChanged(e, tick);
+				}
+			}
+		};
+
+		// ビューの作成
+		template<typename... Components>
+		View<Components...> view()
 		{
-			return getPool<T>().has(entity);
+			return View<Components...>(this);
 		}
 
-		// エンティティが有効（存在している）か判定
-		bool valid(Entity entity) const
+		// ============================================================
+		// Owning Group
+		// ============================================================
+		/**
+		 * @class	Group
+		 * @brief	所有コンポーネントを各プールの先頭に同じ順序で詰めて保持するビュー
+		 *
+		 * @details
+		 * メンバーは所有プールの [0, length) に整列しているため、
+		 * each() は has() 判定なしで連続した配列を走査できる。
+		 * 1つのコンポーネント型を所有できる Group は1つだけ。
+		 */
+		template<typename OwnedList, typename GetList>
+		class Group;
+
+		template<typename... Owned, typename... Get>
+		class Group<std::tuple<Owned...>, std::tuple<Get...>>
 		{
-			// 1. 無効IDなら false
-			if (entity == NullEntity) return false;
+			Registry* registry;
+			GroupData* data;
+			std::tuple<SparseSet<Owned>*...> owned;
+			std::tuple<SparseSet<std::remove_const_t<Get>>*...> gets;
+
+		public:
+			Group(Registry* r, GroupData* d)
+				: registry(r), data(d)
+			{
+				owned = std::make_tuple(&registry->getPool<Owned>()...);
+				gets = std::make_tuple(&registry->getPool<std::remove_const_t<Get>>()...);
+			}
 
-			// 2. まだ発行されていないIDなら false
-			if (entity >= nextEntity) return false;
+			// メンバー数（Active / Enabled 判定前）
+			std::size_t size() const { return data->length; }
 
-			// 3. 削除済みIDリスト(freeIds)に含まれているなら false
-			for (Entity id : freeIds)
+			// メンバーのエンティティ列（[0, size()) が有効）
+			const std::vector<Entity>& getEntities() const
 			{
-				if (id == entity) return false;
+				return std::get<0>(owned)->getEntities();
 			}
 
-			return true;
-		}
+			// エンティティがメンバーで、Active かつ全コンポーネント有効か
+			bool contains(Entity entity) const
+			{
+				if (!registry->valid(entity)) return false;
+				const Entity pos = std::get<0>(owned)->indexOf(entity);
+				return pos != NullEntity && pos < data->length && isMember(pos);
+			}
 
-		// 読み取り用
-		template<typename T>
-		const T& get(Entity entity) const
-		{
-			return const_cast<Registry*>(this)->getPool<T>().get(entity);
-		}
+			// -----------------------------------------------------------
+			// each関数（ラムダ実行用）
+			// 引数: [](Entity e, Owned&..., Get&...)
+			// ※ 読むだけの参照コンポーネントは With<const T> にすると変更ティックを記録しない
+			// -----------------------------------------------------------
+			template<typename Func>
+			void each(Func func)
+			{
+				const std::vector<Entity>& entities = getEntities();
+				const Tick tick = registry->stampTick();
+				forEachEnabled(0, data->length, [&](std::size_t i) {
+					Entity entity = entities[i];
+					if (!registry->isActive(entity)) return;
 
-		// 書き込み用
-		template<typename T>
-		T& get(Entity entity)
-		{
-			return getPool<T>().get(entity);
-		}
+					// 所有プールは AND 済み、参照プールは通常の検索
+					if (!(std::get<SparseSet<std::remove_const_t<Get>>*>(gets)->IsEnabled(entity) && ...)) return;
 
-		// 変更検知付き書き込み用
-		template<typename T>
-		ScopedComponent<T> modify(Entity entity)
-		{
-			return ScopedComponent<T>(this, entity, &getPool<T>().get(entity));
-		}
+					const bool changed = invokeResult(func, entity,
+						std::get<SparseSet<Owned>*>(owned)->getData()[i]...,
+						std::get<SparseSet<std::remove_const_t<Get>>*>(gets)->get(entity)...);
 
-		// 変更通知を手動で送る
-		template<typename T>
-		void patch(Entity entity)
-		{
-			getPool<T>().patch(entity);
-		}
+					// 変更ティックの記録（View::each と同じ挙動）
+					if (changed) stamp(i, entity, tick);
+				});
+			}
 
-		// コンポーネント削除
-		template<typename T>
-		void remove(Entity entity)
-		{
-			getPool<T>().remove(entity);
-		}
+			// -----------------------------------------------------------
+			// par_each関数（JobSystem による並列実行）
+			// 引数: [](Entity e, Owned&..., Get&...) または [](std::size_t index, Entity e, ...)
+			// ※ 規約は Registry の「並列走査の規約」を参照
+			// -----------------------------------------------------------
+			template<typename Func>
+			void par_each(Func func, std::size_t grain = ParallelGrain)
+			{
+				const std::vector<Entity>& entities = getEntities();
+				const SystemTicks ticks = ChangeTicks::Current();
+				const Tick tick = registry->stampTick();
+
+				JobSystem::ParallelFor(data->length, grain, [&](std::size_t begin, std::size_t end) {
+					TickScope scope(ticks);
+					forEachEnabled(begin, end, [&](std::size_t i) {
+						if (!isMember(i)) return;
+						const Entity entity = entities[i];
+						const bool changed = invokeEach(func, i, entity,
+							std::get<SparseSet<Owned>*>(owned)->getData()[i]...,
+							std::get<SparseSet<std::remove_const_t<Get>>*>(gets)->get(entity)...);
+						if (changed) stamp(i, entity, tick);
+					});
+				});
+			}
 
-		void destroy(Entity entity)
-		{
-			for (auto& pool : pools)
+			// 特定コンポーネント取得ヘルパー（const でない型は変更ティックを記録する）
+			template<typename T>
+			T& get(Entity entity)
 			{
-				if (pool)
-				{
-					pool->remove(entity);
-				}
+				if constexpr (std::is_const_v<T>) return registry->read<std::remove_const_t<T>>(entity);
+				else return registry->get<T>(entity);
 			}
 
-			freeIds.push_back(entity);
-		}
+			// メンバー [0, size()) の並び替え（挿入ソート / 全所有プールを同じ順に揃える）
+			// compare: bool(const 先頭の所有コンポーネント&, ...) または bool(Entity, Entity)
+			template<typename Compare>
+			void sort(Compare compare)
+			{
+				using First = std::tuple_element_t<0, std::tuple<Owned...>>;
+				SparseSet<First>* lead = std::get<0>(owned);
+				lead->sort(compare, data->length);
+				(follow(std::get<SparseSet<Owned>*>(owned), *lead), ...);
+			}
 
-		void clear()
-		{
-			for (auto& pool : pools)
+		private:
+			// 先頭の所有プールと同じ並びに揃える
+			template<typename P>
+			void follow(P* pool, const IPool& lead)
 			{
-				if (pool) pool.reset();
+				if (static_cast<const IPool*>(pool) != &lead) pool->sort_as(lead, data->length);
 			}
-			pools.clear();
-			freeIds.clear();
-			nextEntity = 1;
-			entityActiveStates.clear();
-		}
 
-		// @brief	全ての有効なエンティティに対して関数を実行する。
-		// @param	func 実行する関数 void(Entity)
-		template<typename Func>
-		void each(Func func)
-		{
-			// 0番から現在発行されている最大IDまで走査
-			for (Entity i = 0; i < nextEntity; ++i)
+			// i 番目（entity）の全コンポーネントに変更ティックを記録
+			// ※ func 内で削除された場合は位置がずれているので記録しない
+			void stamp(std::size_t i, Entity entity, Tick tick)
+			{
+				if (i >= data->length || getEntities()[i] != entity) return;
+				(std::get<SparseSet<Owned>*>(owned)->markChangedAt(i, tick), ...);
+				(stampGet<Get>(entity, tick), ...);
+			}
+
+			// 参照コンポーネントの変更ティックを記録（const 修飾された型は読むだけなので除く）
+			template<typename T>
+			void stampGet(Entity entity, Tick tick)
 			{
-				// 有効（削除されていない）なら実行
-				if (valid(i))
+				if constexpr (!std::is_const_v<T>) std::get<SparseSet<T>*>(gets)->markChanged(entity, tick);
+			}
+
+			// [begin, end) のうち全所有プールで有効な位置に f(i) を実行
+			// ※ 所有プールは同じ並びなので、有効フラグを 64 個単位で AND してからビットを辿る
+			// ※ f 内で削除されても良いように、毎回 length を確認する
+			template<typename F>
+			void forEachEnabled(std::size_t begin, std::size_t end, F&& f) const
+			{
+				constexpr std::size_t W = EnabledBits::WordBits;
+				for (std::size_t w = begin / W; w * W < end; ++w)
 				{
-					func(i);
+					const std::size_t base = w * W;
+					uint64_t bits = (std::get<SparseSet<Owned>*>(owned)->getEnabledBits().word(w) & ...);
+					if (base < begin) bits &= ~uint64_t(0) << (begin - base);
+					if (end - base < W) bits &= (uint64_t(1) << (end - base)) - 1;
+					while (bits)
+					{
+						const std::size_t i = base + (std::size_t)std::countr_zero(bits);
+						bits &= bits - 1;
+						if (i >= data->length) return;
+						f(i);
+					}
 				}
 			}
-		}
+
+			// i 番目がActive かつ全コンポーネント有効か
+			bool isMember(std::size_t i) const
+			{
+				return registry->isActive(getEntities()[i]) &&
+					(std::get<SparseSet<Owned>*>(owned)->isEnabledAt(i) && ...) &&
+					(std::get<SparseSet<std::remove_const_t<Get>>*>(gets)->IsEnabled(getEntities()[i]) && ...);
+			}
+		};
 
 		// ============================================================
-		// Multi-View Class (Chainable)
-		// ============================================================ 
-		template<typename... Components>
-		class View
+		// Persistent Query
+		// ============================================================
+		/**
+		 * @class	Query
+		 * @brief	条件に一致するエンティティの一覧を常に保持する永続ビュー
+		 *
+		 * @details
+		 * コンポーネントの追加/削除・有効状態の変更を Signal で受け取り、差分で一覧を更新する。
+		 * 走査は一覧の配列をなめるだけで、View のような毎回の isValid() 判定が不要。
+		 * ※ 走査は末尾から行うため、走査中に自身を削除しても安全
+		 */
+		template<typename IncludeList, typename ExcludeList>
+		class Query;
+
+		template<typename... Include, typename... Exclude>
+		class Query<std::tuple<Include...>, std::tuple<Exclude...>>
 		{
 			Registry* registry;
-			// 必要なプールへのポインタ（ダブルで保持）
-			std::tuple<SparseSet<Components>*...> pools;
-			// 除外するコンポーネントIDのリスト
-			std::vector<std::size_t> excludeTypes;
-			// ループ駆動に使うプールのインデックス（最小サイズのプール）
-			std::size_t bestIndex = 0;
+			QueryData* data;
+			// changed / added フィルタと、その基準ティック（一致リストには影響しない）
+			std::vector<TickFilter> filters;
+			Tick since = 0;
 
 		public:
-			View(Registry* r)
-				: registry(r)
+			Query(Registry* r, QueryData* d)
+				: registry(r), data(d), since(ChangeTicks::Current().lastRun)
 			{
-				// 全てのプールを取得
-				pools = std::make_tuple(&registry->getPool<Components>()...);
+			}
 
-				// 最も要素数が少ないプールを探して駆動用にする（最適化）
-				std::size_t minsize = SIZE_MAX;
-				findSmallestPool(std::index_sequence_for<Components...>{}, minsize);
+			// 変更フィルタ（.changed<Transform>()）：前回の実行以降に書き込まれたものだけ
+			template<typename... Ts>
+			Query& changed()
+			{
+				(filters.push_back({ &registry->getPool<std::remove_const_t<Ts>>(), &readChangedTick<std::remove_const_t<Ts>> }), ...);
+				return *this;
 			}
 
-			// 除外設定（.exclude<Static>()）
-			template<typename TExclude>
-			View& exclude()
+			// 追加フィルタ（.added<Collider>()）：前回の実行以降に追加されたものだけ
+			template<typename... Ts>
+			Query& added()
 			{
-				excludeTypes.push_back(ComponentFamily::type<TExclude>());
+				(filters.push_back({ &registry->getPool<std::remove_const_t<Ts>>(), &readAddedTick<std::remove_const_t<Ts>> }), ...);
 				return *this;
 			}
 
-			// 有効なエンティティ数
+			// フィルタの基準ティックを指定（既定は実行中システムの前回実行ティック）
+			Query& sinceTick(Tick tick)
+			{
+				since = tick;
+				return *this;
+			}
+
+			// 一致しているエンティティ数（フィルタ判定前）
 			std::size_t size()
 			{
-				std::size_t count = 0;
-				for (auto e : *this)
-				{
-					count++;
-				}
-				return count;
+				registry->refreshQuery(*data);
+				return data->dense.size();
 			}
 
-			// ヘルパー：最小プールを探す
-			template<std::size_t... Is>
-			void findSmallestPool(std::index_sequence<Is...>, std::size_t& minsize)
+			// エンティティが一致しているか（フィルタ判定前）
+			bool contains(Entity entity)
 			{
-				// fold expressionで各プールのサイズをチェック
-				((checkSize<Is>(minsize)), ...);
+				registry->refreshQuery(*data);
+				return registry->isQueryMember(*data, entity);
 			}
 
-			template<std::size_t I>
-			void checkSize(std::size_t& minsize)
+			// -----------------------------------------------------------
+			// イテレータ（範囲for文用 / 末尾から走査）
+			// -----------------------------------------------------------
+			struct Iterator
 			{
-				auto* pool = std::get<I>(pools);
-				if (pool->size() < minsize)
+				const Query* query;
+				std::size_t pos;	// 次に返す要素 + 1
+
+				Entity operator*() const { return query->data->dense[pos - 1]; }
+
+				Iterator& operator++()
 				{
-					minsize = pool->size();
-					bestIndex = I;
+					--pos;
+					skipFiltered();
+					return *this;
+				}
+
+				bool operator!=(const Iterator& other) const { return pos != other.pos; }
+
+				// 走査中に一覧が縮んだ場合は範囲内に収め、フィルタで外れる要素を飛ばす
+				void skipFiltered()
+				{
+					const std::vector<Entity>& dense = query->data->dense;
+					if (pos > dense.size()) pos = dense.size();
+					while (pos > 0 && !query->passes(dense[pos - 1])) --pos;
 				}
+			};
+
+			Iterator begin()
+			{
+				registry->refreshQuery(*data);
+				Iterator it{ this, data->dense.size() };
+				it.skipFiltered();
+				return it;
 			}
 
+			Iterator end() { return Iterator{ this, 0 }; }
+
 			// -----------------------------------------------------------
-			// イテレータ（範囲for文用）
+			// each関数（ラムダ実行用）
+			// 引数: [](Entity e, Include&...)
 			// -----------------------------------------------------------
-			struct Iterator
+			template<typename Func>
+			void each(Func func)
 			{
-				View* view;
-				// 駆動用プールのイテレータ
-				typename std::vector<Entity>::const_iterator current;
-				typename std::vector<Entity>::const_iterator end;
+				registry->refreshQuery(*data);
+				auto pools = std::make_tuple(&registry->getPool<std::remove_const_t<Include>>()...);
+				const Tick tick = registry->stampTick();
 
-				Iterator(View* v, typename std::vector<Entity>::const_iterator c, typename std::vector<Entity>::const_iterator e)
-					: view(v), current(c), end(e)
+				for (std::size_t i = data->dense.size(); i > 0; --i)
 				{
-					// 最初が有効化チェック、無効なら進める
-					if (current != end && !view->isValid(*current))
+					if (i > data->dense.size()) continue;
+					Entity entity = data->dense[i - 1];
+					if (!passes(entity)) continue;
+
+					const bool changed = std::apply([&](auto*... p) {
+						return invokeResult(func, entity, p->get(entity)...);
+					}, pools);
+
+					// 変更ティックの記録（View::each と同じ挙動）
+					if (changed) (stamp<Include>(pools, entity, tick), ...);
+				}
+			}
+
+			// -----------------------------------------------------------
+			// par_each関数（JobSystem による並列実行）
+			// 引数: [](Entity e, Include&...) または [](std::size_t index, Entity e, Include&...)
+			// ※ index は一致リスト内の位置（0 〜 size()-1）
+			// ※ 規約は Registry の「並列走査の規約」を参照
+			// -----------------------------------------------------------
+			template<typename Func>
+			void par_each(Func func, std::size_t grain = ParallelGrain)
+			{
+				registry->refreshQuery(*data);
+				const std::vector<Entity>& dense = data->dense;
+				const SystemTicks ticks = ChangeTicks::Current();
+				const Tick tick = registry->stampTick();
+
+				// プールの検索はワーカーで行わない（未作成時に構造が変わるため）
+				auto pools = std::make_tuple(&registry->getPool<std::remove_const_t<Include>>()...);
+
+				JobSystem::ParallelFor(dense.size(), grain, [&](std::size_t begin, std::size_t end) {
+					TickScope scope(ticks);
+					for (std::size_t i = begin; i < end; ++i)
 					{
-						++(*this);
+						const Entity entity = dense[i];
+						if (!passes(entity)) continue;
+
+						const bool changed = std::apply([&](auto*... p) {
+							return invokeEach(func, i, entity, p->get(entity)...);
+						}, pools);
+						if (changed) (stamp<Include>(pools, entity, tick), ...);
 					}
+				});
+			}
+
+			// 特定コンポーネント取得ヘルパー（const でない型は変更ティックを記録する）
+			template<typename T>
+			T& get(Entity entity)
+			{
+				if constexpr (std::is_const_v<T>) return registry->read<std::remove_const_t<T>>(entity);
+				else return registry->get<T>(entity);
+			}
+
+		private:
+			// changed / added フィルタの判定
+			bool passes(Entity entity) const
+			{
+				for (const TickFilter& f : filters)
+				{
+					if (!f.passes(entity, since)) return false;
 				}
+				return true;
+			}
 
-				Entity operator*() const
+			// 変更ティックの記録（const修飾されていない型のみ / func 内で削除されたものは除く）
+			template<typename T, typename Pools>
+			static void stamp(Pools& pools, Entity e, Tick tick)
+			{
+				if constexpr (!std::is_const_v<T>)
 				{
-					return *current;
+					auto* pool = std::get<SparseSet<T>*>(pools);
+					if (pool->has(e)) pool->markChanged(e, tick);
 				}
+			}
+		};
 
-				Iterator& operator++()
+		// Queryの取得（初回呼び出し時に登録し、以後は差分で維持される）
+		template<typename... Include, typename... Exclude>
+		Query<std::tuple<Include...>, std::tuple<Exclude...>> query(Without<Exclude...> = {})
+		{
+			static_assert(sizeof...(Include) > 0, "Query requires at least one component");
+
+			// プールを確実に作成しておく
+			(getPool<std::remove_const_t<Include>>(), ...);
+			(getPool<Exclude>(), ...);
+
+			ComponentMask includeMask;
+			(includeMask.set(ComponentFamily::type<std::remove_const_t<Include>>()), ...);
+			ComponentMask excludeMask;
+			(excludeMask.set(ComponentFamily::type<Exclude>()), ...);
+
+			std::lock_guard<std::mutex> lock(lazyInitMutex);
+			for (auto& q : queries)
+			{
+				if (q->include.words == includeMask.words && q->exclude.words == excludeMask.words)
 				{
-					do
-					{
-						++current;
-					} while (current != end && !view->isValid(*current));
-					return *this;
+					return Query<std::tuple<Include...>, std::tuple<Exclude...>>(this, q.get());
+				}
+			}
+
+			auto newQuery = std::make_unique<QueryData>();
+			QueryData* qd = newQuery.get();
+			qd->owner = this;
+			qd->include = includeMask;
+			qd->exclude = excludeMask;
+			queries.push_back(std::move(newQuery));
+
+			// 必須コンポーネント：追加/有効化で再判定、削除で除外
+			includeMask.forEach([&](std::size_t typeId) {
+				pools[typeId]->onConstruct.connect<&Registry::queryUpdateMember>(*qd);
+				pools[typeId]->onConstructRange.connect<&Registry::queryUpdateRange>(*qd);
+				pools[typeId]->onEnabledChanged.connect<&Registry::queryUpdateMember>(*qd);
+				pools[typeId]->onDestroy.connect<&Registry::queryRemoveMember>(*qd);
+			});
+
+			// 除外コンポーネント：追加で除外、削除で再判定（削除通知時点ではまだ所持しているので無視させる）
+			excludeMask.forEach([&](std::size_t typeId) {
+				pools[typeId]->onConstruct.connect<&Registry::queryRemoveMember>(*qd);
+				pools[typeId]->onConstructRange.connect<&Registry::queryRemoveRange>(*qd);
+				QueryData::ExcludeHook& hook = qd->excludeHooks.emplace_back(QueryData::ExcludeHook{ qd, typeId });
+				pools[typeId]->onDestroy.connect<&Registry::queryExcludeRemoved>(hook);
+			});
+
+			// Active状態の変化（親子の伝播分も個別に通知される）
+			onActiveChanged.connect<&Registry::queryUpdateMember>(*qd);
+
+			return Query<std::tuple<Include...>, std::tuple<Exclude...>>(this, qd);
+		}
+
+	private:
+		// each の関数呼び出し（戻り値が bool ならそれを、void なら true を返す）
+		template<typename Func, typename... Args>
+		static bool invokeResult(Func& func, Args&&... args)
+		{
+			if constexpr (std::is_same_v<std::invoke_result_t<Func&, Args...>, bool>) return func(std::forward<Args>(args)...);
+			else
+			{
+				func(std::forward<Args>(args)...);
+				return true;
+			}
+		}
+
+		// par_each の関数呼び出し（index 付き / 無しの両方に対応）
+		template<typename Func, typename... Args>
+		static bool invokeEach(Func& func, std::size_t index, Entity entity, Args&... args)
+		{
+			if constexpr (std::is_invocable_v<Func&, std::size_t, Entity, Args&...>) return invokeResult(func, index, entity, args...);
+			else return invokeResult(func, entity, args...);
+		}
+
+		// 自身の設定と親のキャッシュから Active 状態を求める
+		bool computeActive(Entity entity) const
+		{
+			Entity index = EntityTraits::toIndex(entity);
+			if (!entityActiveStates[index]) return false;
+
+			if (m_parentLookup)
+			{
+				Entity parent = m_parentLookup(entity);
+				if (parent != NullEntity)
+				{
+					return valid(parent) && effectiveActiveStates[EntityTraits::toIndex(parent)];
 				}
+			}
+			return true;
+		}
+
+		// Query の条件判定（ignoreType は「既に持っていない」とみなす型）
+		bool matchesQuery(const QueryData& q, Entity entity, std::size_t ignoreType = SIZE_MAX) const
+		{
+			if (!isActive(entity)) return false;
+
+			ComponentMask signature = signatures[EntityTraits::toIndex(entity)];
+			if (ignoreType != SIZE_MAX) signature.reset(ignoreType);
+			if (signature.intersects(q.exclude)) return false;
+			if (!signature.containsAll(q.include)) return false;
+
+			bool allEnabled = true;
+			q.include.forEach([&](std::size_t typeId) {
+				if (allEnabled && !pools[typeId]->IsEnabled(entity)) allEnabled = false;
+			});
+			return allEnabled;
+		}
+
+		bool isQueryMember(const QueryData& q, Entity entity) const
+		{
+			const Entity pos = q.positions.get(EntityTraits::toIndex(entity));
+			return pos < q.dense.size() && q.dense[pos] == entity;
+		}
 
-				bool operator!=(const Iterator& other) const
-				{
-					return current != other.current;
-				}
-			};
+		void removeQueryMember(QueryData& q, Entity entity)
+		{
+			if (!isQueryMember(q, entity)) return;
+
+			const Entity pos = q.positions.get(EntityTraits::toIndex(entity));
+			const Entity last = q.dense.back();
+			q.dense[pos] = last;
+			q.positions.set(EntityTraits::toIndex(last), pos);
+			q.positions.erase(EntityTraits::toIndex(entity));
+			q.dense.pop_back();
+		}
 
-			Iterator begin()
+		// 1体分の差分更新
+		void updateQueryMember(QueryData& q, Entity entity, std::size_t ignoreType = SIZE_MAX)
+		{
+			if (q.dirty) return;	// 作り直し予定なので不要
+
+			const bool member = isQueryMember(q, entity);
+			const bool match = matchesQuery(q, entity, ignoreType);
+			if (match && !member)
 			{
-				return createIterator(bestIndex);
+				q.positions.insert(EntityTraits::toIndex(entity), (Entity)q.dense.size());
+				q.dense.push_back(entity);
 			}
-
-			Iterator end()
+			else if (!match && member)
 			{
-				return createEndIterator(bestIndex);
+				removeQueryMember(q, entity);
 			}
+		}
 
-			// ヘルパー：インデックスからイテレータ生成
-			Iterator createIterator(std::size_t index)
+		// いずれかの Group が所有している型か
+		bool isGroupOwned(std::size_t typeId) const
+		{
+			for (const auto& g : groups)
 			{
-				const std::vector<Entity>* entities = nullptr;
-				std::size_t i = 0;
-				std::apply([&](auto*... p) {
-					((i++ == index ? entities = &p->getEntities() : nullptr), ...);
-					}, pools);
-
-				return Iterator(this, entities->begin(), entities->end());
+				if (g->owned.test(typeId)) return true;
 			}
+			return false;
+		}
 
-			Iterator createEndIterator(std::size_t index)
+		// --- 唯一コンポーネントの Signal 接続先（Delegate はプール自身を payload として受け取る） ---
+		static void uniqueConstruct(IPool& pool, Entity entity)
+		{
+			if (pool.uniqueOwner != NullEntity && pool.uniqueOwner != entity && pool.has(pool.uniqueOwner))
 			{
-				const std::vector<Entity>* entities = nullptr;
-				std::size_t i = 0;
-				std::apply([&](auto*... p) {
-					((i++ == index ? entities = &p->getEntities() : nullptr), ...);
-					}, pools);
-				return Iterator(this, entities->end(), entities->end());
+#ifndef ARCHE_ECS_STANDALONE
+				Logger::LogWarning("Unique component was added to a second entity (ignored)");
+#endif // !ARCHE_ECS_STANDALONE
+				return;
 			}
+			pool.uniqueOwner = entity;
+		}
 
-			// エンティティが条件を満たすかチェック
-			bool isValid(Entity entity)
+		static void uniqueConstructRange(IPool& pool, const Entity* first, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i) uniqueConstruct(pool, first[i]);
+		}
+
+		// 削除通知の時点ではまだ所持しているので、他に所持者が残っていれば引き継ぐ
+		static void uniqueDestroy(IPool& pool, Entity entity)
+		{
+			if (pool.uniqueOwner != entity) return;
+			pool.uniqueOwner = NullEntity;
+			for (Entity other : pool.getEntities())
 			{
-				// 1. エンティティ自体がActiveでなければスキップ
-				if (!registry->isActive(entity)) return false;
+				if (other != entity) { pool.uniqueOwner = other; break; }
+			}
+		}
+
+		// --- Signal の接続先（Delegate は QueryData を payload として受け取る） ---
+		static void queryUpdateMember(QueryData& q, Entity entity)
+		{
+			q.owner->updateQueryMember(q, entity);
+		}
+
+		static void queryUpdateRange(QueryData& q, const Entity* first, std::size_t count)
+		{
+			if (q.dirty) return;
+			q.dense.reserve(q.dense.size() + count);
+			for (std::size_t i = 0; i < count; ++i) q.owner->updateQueryMember(q, first[i]);
+		}
+
+		static void queryRemoveMember(QueryData& q, Entity entity)
+		{
+			if (!q.dirty) q.owner->removeQueryMember(q, entity);
+		}
+
+		static void queryRemoveRange(QueryData& q, const Entity* first, std::size_t count)
+		{
+			if (q.dirty) return;
+			for (std::size_t i = 0; i < count; ++i) q.owner->removeQueryMember(q, first[i]);
+		}
+
+		static void queryExcludeRemoved(QueryData::ExcludeHook& hook, Entity entity)
+		{
+			hook.query->owner->updateQueryMember(*hook.query, entity, hook.typeId);
+		}
+
+		// 必要なら一覧を作り直す（最小の必須プールから走査）
+		void refreshQuery(QueryData& q)
+		{
+			if (!q.dirty) return;
+
+			std::lock_guard<std::mutex> lock(lazyInitMutex);
+			if (!q.dirty) return;
 
-				// 2. Excludeチェック
-				for (auto id : excludeTypes)
+			q.dense.clear();
+			q.positions.reset();
+
+			IPool* smallest = nullptr;
+			q.include.forEach([&](std::size_t typeId) {
+				if (!smallest || pools[typeId]->size() < smallest->size()) smallest = pools[typeId].get();
+			});
+
+			for (Entity entity : smallest->getEntities())
+			{
+				if (matchesQuery(q, entity))
 				{
-					if (id < registry->pools.size() && registry->pools[id] && registry->pools[id]->has(entity))
-					{
-						return false;
-					}
+					q.positions.insert(EntityTraits::toIndex(entity), (Entity)q.dense.size());
+					q.dense.push_back(entity);
 				}
+			}
+			q.dirty = false;
+		}
 
-				// 3. Othersチェック
-				bool allValid = std::apply([&](auto*... p)
-				{
-					return ((p->has(entity) && p->IsEnabled(entity)) && ...);
-				}, pools);
+	public:
+		// Groupの取得（初回呼び出し時に作成し、既存のメンバーを整列する）
+		template<typename... Owned, typename... Get>
+		Group<std::tuple<Owned...>, std::tuple<Get...>> group(With<Get...> = {})
+		{
+			static_assert(sizeof...(Owned) > 0, "Group requires at least one owned component");
 
-				return allValid;
-			}
+			ComponentMask ownedMask;
+			(ownedMask.set(ComponentFamily::type<Owned>()), ...);
+			ComponentMask requiredMask = ownedMask;
+			(requiredMask.set(ComponentFamily::type<Get>()), ...);
 
-			// -----------------------------------------------------------
-			// each関数（ラムダ実行用）
-			// -----------------------------------------------------------
-			template<typename Func>
-			void each(Func func)
+			std::lock_guard<std::mutex> lock(lazyInitMutex);
+			for (auto& g : groups)
 			{
-				// 最適化されたループ
-				const std::vector<Entity>* entities = nullptr;
-				std::size_t i = 0;
-				std::apply([&](auto... p) {
-					((i++ == bestIndex ? entities = &p->getEntities() : nullptr), ...);
-					}, pools);
-
-				for (const auto& entity : *entities)
+				if (g->owned.words == ownedMask.words && g->required.words == requiredMask.words)
 				{
-					if (isValid(entity))
-					{
-						// 全て持っているので関数実行
-						std::apply([&](auto... p) {
-							func(
-								entity,
-								p->get(entity)...
-							);
-							}, pools);
-
-						// 自動通知
-						(auto_patch<Components>(entity), ...);
-					}
+					return Group<std::tuple<Owned...>, std::tuple<Get...>>(this, g.get());
 				}
+				// 同じ型を別の Group が所有すると整列が壊れる
+				assert(!g->owned.intersects(ownedMask) && "Component is already owned by another group");
 			}
 
-			// 特定コンポーネント取得ヘルパー
-			template<typename T>
-			T& get(Entity entity)
+			auto newGroup = std::make_unique<GroupData>();
+			GroupData* gd = newGroup.get();
+			gd->owner = this;
+			gd->owned = ownedMask;
+			gd->required = requiredMask;
+			groups.push_back(std::move(newGroup));
+
+			(getPool<Owned>().onConstruct.template connect<&Registry::groupConstruct<Owned...>>(*gd), ...);
+			(getPool<std::remove_const_t<Get>>().onConstruct.template connect<&Registry::groupConstruct<Owned...>>(*gd), ...);
+			(getPool<Owned>().onConstructRange.template connect<&Registry::groupConstructRange<Owned...>>(*gd), ...);
+			(getPool<std::remove_const_t<Get>>().onConstructRange.template connect<&Registry::groupConstructRange<Owned...>>(*gd), ...);
+			(getPool<Owned>().onDestroy.template connect<&Registry::groupDestroy<Owned...>>(*gd), ...);
+			(getPool<std::remove_const_t<Get>>().onDestroy.template connect<&Registry::groupDestroy<Owned...>>(*gd), ...);
+
+			// 既存エンティティの整列
+			using Lead = std::tuple_element_t<0, std::tuple<Owned...>>;
+			const std::vector<Entity>& leadEntities = getPool<Lead>().getEntities();
+			for (std::size_t i = 0; i < leadEntities.size(); ++i)
 			{
-				return std::get<SparseSet<T>*>(pools)->get(entity);
+				groupConstruct<Owned...>(*gd, leadEntities[i]);
 			}
 
-		private:
-			// 自動パッチ通知（each内で使用）
-			template<typename T>
-			void auto_patch(Entity e)
+			return Group<std::tuple<Owned...>, std::tuple<Get...>>(this, gd);
+		}
+
+	private:
+		// --- Group の Signal 接続先（Delegate は GroupData を payload として受け取る） ---
+		// 条件を満たしたらメンバー領域の末尾へ移動
+		template<typename... Owned>
+		static void groupConstruct(GroupData& gd, Entity entity)
+		{
+			using Lead = std::tuple_element_t<0, std::tuple<Owned...>>;
+			Registry& r = *gd.owner;
+			if (!r.signatures[EntityTraits::toIndex(entity)].containsAll(gd.required)) return;
+			if (r.getPool<Lead>().indexOf(entity) < gd.length) return;
+
+			const std::size_t pos = gd.length++;
+			(r.getPool<Owned>().swapAt(r.getPool<Owned>().indexOf(entity), pos), ...);
+		}
+
+		template<typename... Owned>
+		static void groupConstructRange(GroupData& gd, const Entity* first, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i) groupConstruct<Owned...>(gd, first[i]);
+		}
+
+		// 条件を外れる直前にメンバー領域の外へ移動
+		template<typename... Owned>
+		static void groupDestroy(GroupData& gd, Entity entity)
+		{
+			using Lead = std::tuple_element_t<0, std::tuple<Owned...>>;
+			Registry& r = *gd.owner;
+			Entity pos = r.getPool<Lead>().indexOf(entity);
+			if (pos == NullEntity || pos >= gd.length) return;
+
+			const std::size_t last = --gd.length;
+			(r.getPool<Owned>().swapAt(r.getPool<Owned>().indexOf(entity), last), ...);
+		}
+	};
+
+	// ------------------------------------------------------------
+	// CommandBuffer の適用（Registry の定義が必要なためここで実装）
+	// ------------------------------------------------------------
+	template<typename T>
+	void CommandBuffer::ComponentQueue<T>::apply(Registry& registry, const std::vector<Entity>& created)
+	{
+		// 有効な対象だけを集めて一括追加（通知も1回にまとまる）
+		std::vector<Entity> targets;
+		std::vector<T> values;
+		targets.reserve(items.size());
+		values.reserve(items.size());
+		for (auto& [entity, value] : items)
+		{
+			Entity target = resolve(entity, created);
+			if (!registry.valid(target)) continue;
+			targets.push_back(target);
+			values.push_back(std::move(value));
+		}
+		registry.insert<T>(targets.begin(), targets.end(), std::make_move_iterator(values.begin()));
+	}
+
+	inline void CommandBuffer::playback(Registry& registry)
+	{
+		assert(!JobSystem::IsInsideJob() && "CommandBuffer::playback must be called at a sync point");
+		const std::size_t count = std::min(usedStreams.load(std::memory_order_acquire), MaxThreads);
+		std::array<Stream*, MaxThreads> streams{};
+		for (std::size_t i = 0; i < count; ++i) streams[i] = slots[i].stream.load(std::memory_order_acquire);
+
+		// 1. 予約された Entity を作成
+		std::vector<Entity> created(pendingCount.load(std::memory_order_relaxed));
+		registry.create(created.size(), created.begin());
+
+		// 2. コンポーネント追加（型ごとにまとめて適用）
+		std::size_t typeCount = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (streams[i]) typeCount = std::max({ typeCount, streams[i]->emplaces.size(), streams[i]->removes.size() });
+		}
+		for (std::size_t typeId = 0; typeId < typeCount; ++typeId)
+		{
+			for (std::size_t i = 0; i < count; ++i)
 			{
-				// const修飾されていない型のみ通知
-				if constexpr (!std::is_const_v<T>)
-				{
-					registry->getPool<T>().patch(e);
-				}
+				Stream* stream = streams[i];
+				if (stream && typeId < stream->emplaces.size() && stream->emplaces[typeId]) stream->emplaces[typeId]->apply(registry, created);
 			}
-		};
+		}
 
-		// ビューの作成
-		template<typename... Components>
-		View<Components...> view()
+		// 3. コンポーネント削除（型ごとにインデックス順に整列し、重複を除いて一括削除）
+		std::vector<Entity> batch;
+		for (std::size_t typeId = 0; typeId < typeCount; ++typeId)
 		{
-			return View<Components...>(this);
+			batch.clear();
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				Stream* stream = streams[i];
+				if (!stream || typeId >= stream->removes.size()) continue;
+				for (Entity entity : stream->removes[typeId]) batch.push_back(resolve(entity, created));
+			}
+			if (batch.empty()) continue;
+
+			IPool* pool = registry.getPoolBase(typeId);
+			if (!pool) continue;
+
+			std::sort(batch.begin(), batch.end(), [](Entity a, Entity b) { return EntityTraits::toIndex(a) < EntityTraits::toIndex(b); });
+			batch.erase(std::unique(batch.begin(), batch.end()), batch.end());
+			for (Entity entity : batch)
+			{
+				if (pool->has(entity)) pool->remove(entity);
+			}
+		}
+
+		// 4. Active 変更（記録順）
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (!streams[i]) continue;
+			for (auto& [entity, active] : streams[i]->actives) registry.setActive(resolve(entity, created), active);
+		}
+
+		// 5. 破棄（インデックス順に整列し、重複を除いて一括破棄）
+		batch.clear();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (!streams[i]) continue;
+			for (Entity entity : streams[i]->destroys) batch.push_back(resolve(entity, created));
+		}
+		std::sort(batch.begin(), batch.end(), [](Entity a, Entity b) { return EntityTraits::toIndex(a) < EntityTraits::toIndex(b); });
+		batch.erase(std::unique(batch.begin(), batch.end()), batch.end());
+		for (Entity entity : batch)
+		{
+			registry.destroy(entity);	// 無効なハンドルは destroy 側で無視される
 		}
-	};
+
+		clear();
+	}
 
 	// ------------------------------------------------------------
 	// Observer（変更検知）
@@ -732,22 +3557,36 @@ namespace Arche
 	public:
 		Observer() = default;
 
-		// チェーン開始
+		// チェーン開始（接続時点より後の変更だけを検知する）
 		Observer& connect(Registry& r)
 		{
+			// 同じ Registry への再接続なら、前回の接続を外しておく
+			if (registry == &r) disconnect();
+			groupPools.clear();
 			registry = &r;
 			clear();
+			scanners.clear();
+			filters.clear();
+			since = currentTick();
 			return *this;
 		}
 
 		// 更新検知
+		// ※ onUpdate は購読せず、参照時に変更ティックを走査する
+		//    （const で読んだだけのものや、書き込みのなかった静的なものは拾わない）
 		template<typename T>
 		Observer& update()
 		{
 			assert(registry);
-			registry->getPool<T>().onUpdate.connect(
-				[this](Entity e) { this->on_trigger(e); }
-			);
+			SparseSet<T>* pool = &registry->getPool<T>();
+			scanners.push_back([this, pool](Tick from) {
+				const std::vector<Tick>& ticks = pool->getChangedTicks();
+				const std::vector<Entity>& entities = pool->getEntities();
+				for (std::size_t i = 0; i < entities.size(); ++i)
+				{
+					if (isNewerTick(ticks[i], from)) this->on_trigger(entities[i]);
+				}
+			});
 			return *this;
 		}
 
@@ -756,12 +3595,24 @@ namespace Arche
 		Observer& group()
 		{
 			assert(registry);
-			registry->getPool<T>().onConstruct.connect(
-				[this](Entity e) { this->on_trigger(e); }
-			);
+			SparseSet<T>& pool = registry->getPool<T>();
+			pool.onConstruct.template connect<&Observer::on_trigger>(*this);
+			pool.onConstructRange.template connect<&Observer::on_trigger_range>(*this);
+			groupPools.push_back(&pool);
 			return *this;
 		}
 
+		// group() で接続した Signal から切断する（Registry が生きている間に呼ぶこと）
+		void disconnect()
+		{
+			for (IPool* pool : groupPools)
+			{
+				pool->onConstruct.disconnect(this);
+				pool->onConstructRange.disconnect(this);
+			}
+			groupPools.clear();
+		}
+
 		// 条件フィルタ（.where）
 		template<typename... Us>
 		Observer& where()
@@ -775,7 +3626,7 @@ namespace Arche
 		}
 
 		// イテレータ
-		auto begin() { return dense.begin(); }
+		auto begin() { collect(); return dense.begin(); }
 		auto end() { return dense.end(); }
 
 		// ラムダ式でループ処理（.each）
@@ -783,70 +3634,306 @@ namespace Arche
 		template<typename Func>
 		void each(Func func)
 		{
-			for (auto e : dense) func(e);
+			collect();
+			for (auto e : dense) func(e);
+		}
+
+		// リセット
+		void clear()
+		{
+			for (auto e : dense)
+			{
+				Entity index = EntityTraits::toIndex(e);
+				if (index < sparse.size())
+				{
+					sparse[index] = NullEntity;
+				}
+			}
+			dense.clear();
+		}
+
+		std::size_t size() { collect(); return dense.size(); }
+
+	private:
+		// 今回の基準ティック（システム内なら実行ティック、システム外なら発行済みの最新ティック）
+		Tick currentTick() const
+		{
+			const Tick current = ChangeTicks::Current().thisRun;
+			return current != 0 ? current : registry->currentTick();
+		}
+
+		// 前回の収集以降に変更されたものを集める
+		void collect()
+		{
+			if (!registry || scanners.empty()) return;
+			const Tick now = currentTick();
+			if (now == since) return;
+
+			for (auto& scan : scanners) scan(since);
+			since = now;
+		}
+
+		// トリガー時共通処理
+		void on_trigger(Entity e)
+		{
+			if (!registry) return;
+
+			// フィルタチェック（.where）
+			for (auto& f : filters)
+			{
+				if (!f(*registry, e)) return;
+			}
+
+			// 重複登録防止
+			Entity index = EntityTraits::toIndex(e);
+			if (sparse.size() <= index) sparse.resize(index + 1, NullEntity);
+			if (sparse[index] != NullEntity)
+			{
+				// 同じスロットの古い世代が残っていれば現在のハンドルに差し替える
+				dense[sparse[index]] = e;
+				return;
+			}
+
+			sparse[index] = static_cast<Entity>(dense.size());
+			dense.push_back(e);
+		}
+
+		void on_trigger_range(const Entity* first, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i) on_trigger(first[i]);
+		}
+
+		Registry* registry = nullptr;
+		std::vector<Entity> dense;
+		std::vector<Entity> sparse;
+		std::vector<std::function<bool(Registry&, Entity)>> filters;
+		std::vector<std::function<void(Tick)>> scanners;
+		std::vector<IPool*> groupPools;
+		Tick since = 0;
+	};
+
+	// ------------------------------------------------------------
+	// Dispatcher（グローバルイベントバス）
+	// ------------------------------------------------------------
+	// 型ごとのイベントキュー（Dispatcher::update で一括して通知するための共通窓口）
+	class IEventQueue
+	{
+	public:
+		virtual ~IEventQueue() = default;
+		virtual void drain() = 0;
+		virtual void clear() = 0;
+	};
+
+	// 登録済みキューの一覧（DLL 間で1つにするため、実体はエンジン側に置く）
+	// ※ キュー自体と購読者はモジュールごとに持つため、積んだ側と同じモジュールで購読すること
+	class ARCHE_API EventQueueList
+	{
+	public:
+		static std::vector<IEventQueue*>& List();
+		static std::mutex& Mutex();
+	};
+
+#ifdef ARCHE_ECS_STANDALONE
+	// 単一モジュールで完結するため、ヘッダー内で実装する
+	inline std::vector<IEventQueue*>& EventQueueList::List()
+	{
+		static std::vector<IEventQueue*> list;
+		return list;
+	}
+
+	inline std::mutex& EventQueueList::Mutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+#endif // ARCHE_ECS_STANDALONE
+
+	/**
+	 * @class	Dispatcher
+	 * @brief	型ごとのイベント通知（即時 / キュー）
+	 *
+	 * @details
+	 * - trigger()	: その場で全購読者を呼ぶ（同期）
+	 * - enqueue()	: 型ごとのリングバッファに積むだけ（どのスレッドからでも可）
+	 * - update()	: 積まれたイベントを取り出して通知する（World::Tick の最後で呼ばれる）
+	 * 当たり判定のループ内などで深い呼び出しが起きないよう、ゲームプレイのイベントは enqueue を推奨。
+	 * ※ update 中に積まれたイベントは次回の update で通知される
+	 * ※ キューに積む型はデフォルト構築 / ムーブ可能であること
+	 */
+	class Dispatcher
+	{
+	public:
+		// 購読（接続 / 切断）の窓口
+		template<typename EventType>
+		static Sink<const EventType&> sink()
+		{
+			return Sink<const EventType&>(signal<EventType>());
+		}
+
+		// 即時通知
+		template<typename EventType>
+		static void trigger(const EventType& e)
+		{
+			signal<EventType>().publish(e);
+		}
+
+		// キューに積む（通知は update まで遅延）
+		template<typename EventType>
+		static void enqueue(const EventType& e)
+		{
+			queue<EventType>().push(e);
+		}
+
+		// 指定した型のキューを通知して空にする
+		template<typename EventType>
+		static void update()
+		{
+			queue<EventType>().drain();
+		}
+
+		// 全ての型のキューを登録順に通知して空にする
+		static void update()
+		{
+			std::size_t count = 0;
+			{
+				std::lock_guard<std::mutex> lock(queuesMutex());
+				count = queues().size();
+			}
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				IEventQueue* q = nullptr;
+				{
+					std::lock_guard<std::mutex> lock(queuesMutex());
+					if (i >= queues().size()) break;
+					q = queues()[i];
+				}
+				q->drain();
+			}
+		}
+
+		// 通知せずに破棄する
+		template<typename EventType>
+		static void clear()
+		{
+			queue<EventType>().clear();
+		}
+
+		static void clear()
+		{
+			std::lock_guard<std::mutex> lock(queuesMutex());
+			for (IEventQueue* q : queues()) q->clear();
+		}
+
+		// 積まれているイベント数
+		template<typename EventType>
+		static std::size_t pending()
+		{
+			return queue<EventType>().size();
 		}
 
-		// リセット
-		void clear()
+	private:
+		// 型ごとのリングバッファ（容量は2の累乗で、満杯になったら倍に広げる）
+		template<typename EventType>
+		class EventQueue : public IEventQueue
 		{
-			for (auto e : dense)
+		public:
+			// モジュール（DLL）の解放時に一覧から外す
+			~EventQueue() override
+			{
+				std::lock_guard<std::mutex> lock(queuesMutex());
+				auto& list = queues();
+				list.erase(std::remove(list.begin(), list.end(), this), list.end());
+			}
+
+			void push(const EventType& e)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (count == buffer.size()) grow();
+				buffer[(head + count) & (buffer.size() - 1)] = e;
+				++count;
+			}
+
+			void drain() override
 			{
-				if (e < sparse.size())
+				// 取り出し時点の件数だけ通知する（通知中に積まれた分は次回）
+				std::size_t remaining = size();
+				while (remaining-- > 0)
 				{
-					sparse[e] = NullEntity;
+					EventType e;
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						if (count == 0) return;
+						e = std::move(buffer[head]);
+						head = (head + 1) & (buffer.size() - 1);
+						--count;
+					}
+					signal<EventType>().publish(e);
 				}
 			}
-			dense.clear();
-		}
 
-		std::size_t size() const { return dense.size(); }
+			void clear() override
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				head = 0;
+				count = 0;
+			}
 
-	private:
-		// トリガー時共通処理
-		void on_trigger(Entity e)
-		{
-			if (!registry) return;
+			std::size_t size()
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				return count;
+			}
 
-			// フィルタチェック（.where）
-			for (auto& f : filters)
+		private:
+			// 先頭から並べ直して容量を倍にする
+			void grow()
 			{
-				if (!f(*registry, e)) return;
+				std::vector<EventType> next((std::max)(buffer.size() * 2, InitialCapacity));
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					next[i] = std::move(buffer[(head + i) & (buffer.size() - 1)]);
+				}
+				buffer = std::move(next);
+				head = 0;
 			}
 
-			// 重複登録防止
-			if (sparse.size() <= e) sparse.resize(e + 1, NullEntity);
-			if (sparse[e] != NullEntity) return;
+			static constexpr std::size_t InitialCapacity = 64;
 
-			sparse[e] = static_cast<Entity>(dense.size());
-			dense.push_back(e);
-		}
+			std::vector<EventType> buffer;
+			std::size_t head = 0;
+			std::size_t count = 0;
+			std::mutex mutex;
+		};
 
-		Registry* registry = nullptr;
-		std::vector<Entity> dense;
-		std::vector<Entity> sparse;
-		std::vector<std::function<bool(Registry&, Entity)>> filters;
-	};
+		template<typename EventType>
+		static Signal<const EventType&>& signal()
+		{
+			static Signal<const EventType&> instance;
+			return instance;
+		}
 
-	// ------------------------------------------------------------
-	// Dispatcher（グローバルイベントバス）
-	// ------------------------------------------------------------
-	class Dispatcher
-	{
-	public:
 		template<typename EventType>
-		static Signal<const EventType&>& sink()
+		static EventQueue<EventType>& queue()
 		{
-			static Signal<const EventType&> signal;
-			return signal;
+			static EventQueue<EventType>& instance = registerQueue<EventType>();
+			return instance;
 		}
 
 		template<typename EventType>
-		static void trigger(const EventType& e)
+		static EventQueue<EventType>& registerQueue()
 		{
-			sink<EventType>().publish(e);
+			// 一覧を先に生成しておく（終了時にキューより後で破棄されるように）
+			queuesMutex();
+			queues();
+			static EventQueue<EventType> instance;
+			std::lock_guard<std::mutex> lock(queuesMutex());
+			queues().push_back(&instance);
+			return instance;
 		}
-	};
 
+		static std::vector<IEventQueue*>& queues() { return EventQueueList::List(); }
+		static std::mutex& queuesMutex() { return EventQueueList::Mutex(); }
+	};
 
 	// ------------------------------------------------------------
 	// EntityHandle（チェーンメソッド用）
@@ -915,8 +4002,149 @@ namespace Arche
 		PlayOnly = 1,		// 物理、ゲームロジック、寿命管理など（Play時のみ）
 		EditOnly = 2,		// エディタ専用ギズモなど
 		Overlay = 3,		// 最前面描画用
+		FixedUpdate = 4,	// 物理など（Play時のみ / 固定間隔で1フレームに0回以上実行される）
+	};
+
+	/**
+	 * @struct	SystemRunPolicy
+	 * @brief	システムの Update を実行する頻度
+	 * @details
+	 * 毎フレーム動かす必要の無いシステム（UI の配置、演出、AI の判断など）を間引く。
+	 * FixedUpdate グループには適用しない（固定ステップごとに毎回実行する）。
+	 * 間引いたシステムは ISystem::m_elapsedTime（前回の実行からの経過時間）で時間を進める。
+	 */
+	struct SystemRunPolicy
+	{
+		enum class Mode
+		{
+			EveryFrame = 0,		// 毎フレーム
+			EveryNFrames = 1,	// interval フレームに1回
+			Rate = 2,			// 毎秒 hz 回（1フレームに1回まで）
+			TimeSliced = 3,		// 毎フレーム、budgetUs まで（SliceCursor で前のフレームの続きから処理する）
+		};
+
+		Mode mode = Mode::EveryFrame;
+		uint32_t interval = 1;		// EveryNFrames
+		float hz = 30.0f;			// Rate
+		float phase = 0.0f;			// EveryNFrames / Rate の開始を周期のどこにずらすか（0.0 ～ 1.0 / 同じ頻度のシステムを別のフレームに散らす）
+		float budgetUs = 500.0f;	// TimeSliced（µs）
+
+		bool isEveryFrame() const { return mode == Mode::EveryFrame; }
+	};
+
+	/**
+	 * @class	SystemAccess
+	 * @brief	システムが Update で読み書きするコンポーネントの宣言
+	 * @details
+	 * World はこの宣言から依存関係（DAG）を作り、競合しないシステムを並列に実行する。
+	 * 何も宣言していないシステムは全てと競合する（従来通り登録順に単独で実行される）。
+	 *
+	 * 宣言したシステムの Update は以下を守ること
+	 * - 宣言外のコンポーネントに触らない（Group を生成する場合、所有型は write で宣言する）
+	 * - 構造変更（create / destroy / emplace / remove / setActive）は registry.commands() に記録する
+	 *
+	 * readWith / writeWith<Scope, T...> は「Scope を持つエンティティの T だけ」を触る宣言。
+	 * Scope が異なる宣言同士は競合しない（Scope 同士を併せ持つエンティティが無いことが前提）。
+	 */
+	class SystemAccess
+	{
+	public:
+		// 全エンティティの Ts を読む
+		template<typename... Ts>
+		SystemAccess& read() { (add<Ts, void>(false), ...); return *this; }
+
+		// 全エンティティの Ts を書く
+		template<typename... Ts>
+		SystemAccess& write() { (add<Ts, void>(true), ...); return *this; }
+
+		// Scope を持つエンティティの Ts を読む
+		template<typename Scope, typename... Ts>
+		SystemAccess& readWith() { add<Scope, void>(false); (add<Ts, Scope>(false), ...); return *this; }
+
+		// Scope を持つエンティティの Ts を書く
+		template<typename Scope, typename... Ts>
+		SystemAccess& writeWith() { add<Scope, void>(false); (add<Ts, Scope>(true), ...); return *this; }
+
+		// 宣言済みか（未宣言なら排他実行）
+		bool isDeclared() const { return m_declared; }
+
+		// 同時に実行できない組み合わせか
+		bool conflictsWith(const SystemAccess& other) const
+		{
+			if (!m_declared || !other.m_declared) return true;
+
+			for (const Entry& a : m_entries)
+			{
+				for (const Entry& b : other.m_entries)
+				{
+					if (a.typeId != b.typeId || (!a.write && !b.write)) continue;
+					if (a.scope == NoScope || b.scope == NoScope || a.scope == b.scope) return true;
+				}
+			}
+			return false;
+		}
+
+		// entity の typeId への書き込みが宣言の範囲か（Scope 付きなら entity が Scope を持っていること）
+		bool allowsWrite(Registry& registry, Entity entity, std::size_t typeId) const
+		{
+			for (const Entry& e : m_entries)
+			{
+				if (!e.write || e.typeId != typeId) continue;
+				if (e.scope == NoScope) return true;
+				IPool* scope = registry.getPoolBase(e.scope);
+				if (scope && scope->has(entity)) return true;
+			}
+			return false;
+		}
+
+		// 書き込む型のどれかに onUpdate の受信者が居るか（居れば通知のため呼び出しスレッドで実行する）
+		bool hasPatchListener(Registry& registry) const
+		{
+			for (const Entry& e : m_entries)
+			{
+				if (!e.write) continue;
+				IPool* pool = registry.getPoolBase(e.typeId);
+				if (pool && !pool->onUpdate.empty()) return true;
+			}
+			return false;
+		}
+
+		// 宣言した型のプールを作成しておく（並列実行中にプール一覧が変わらないように）
+		void preparePools(Registry& registry) const
+		{
+			for (auto make : m_poolMakers) make(registry);
+		}
+
+	private:
+		static constexpr std::size_t NoScope = SIZE_MAX;
+
+		struct Entry
+		{
+			std::size_t typeId;
+			std::size_t scope;
+			bool write;
+		};
+
+		template<typename T, typename Scope>
+		void add(bool write)
+		{
+			m_declared = true;
+			std::size_t scope = NoScope;
+			if constexpr (!std::is_void_v<Scope>) scope = ComponentFamily::type<Scope>();
+			m_entries.push_back({ ComponentFamily::type<T>(), scope, write });
+			m_poolMakers.push_back([](Registry& r) { r.getPool<T>(); });
+		}
+
+		std::vector<Entry> m_entries;
+		std::vector<void(*)(Registry&)> m_poolMakers;
+		bool m_declared = false;
 	};
 
+	inline bool allowsWrite(const SystemAccess& access, Registry& registry, Entity entity, std::size_t typeId)
+	{
+		return access.allowsWrite(registry, entity, typeId);
+	}
+
 	class ISystem
 	{
 	public:
@@ -932,6 +4160,103 @@ namespace Arche
 		SystemGroup m_group = SystemGroup::PlayOnly;
 		// 有効化フラグ
 		bool m_isEnabled = true;
+		// 読み書きするコンポーネントの宣言（並列実行用。未宣言なら排他）
+		SystemAccess m_access;
+		// 前回実行したティック（changed / added フィルタの基準）
+		Tick m_lastRunTick = 0;
+
+		// 実行頻度（変更したら resetRunPolicy を呼ぶ）
+		SystemRunPolicy m_runPolicy;
+		// 前回の Update からの経過時間（秒 / 間引いたフレームの分を含む。固定ステップでは固定間隔）
+		float m_elapsedTime = 0.0f;
+		// 前回の Update から間引いたフレーム数 / 直近の Tick で Update を実行したか（表示用）
+		uint32_t m_skippedFrames = 0;
+		bool m_didRun = false;
+		// TimeSliced の進み具合（SliceCursor が更新 / 表示用）
+		float m_sliceProgress = 0.0f;	// 1周のうち処理した割合
+		uint32_t m_slicePasses = 0;		// 1周を終えた回数
+
+		// TimeSliced の予算が残っているか（それ以外のモードでは常に true）
+		bool hasBudget() const
+		{
+			return m_runPolicy.mode != SystemRunPolicy::Mode::TimeSliced || std::chrono::high_resolution_clock::now() < m_sliceDeadline;
+		}
+
+		// 実行頻度の状態を初めからにする（Rate / phase の起点を次のフレームに取り直す）
+		void resetRunPolicy()
+		{
+			m_policyStarted = false;
+			m_policyAccumulator = 0.0;
+			m_pendingElapsed = 0.0f;
+			m_skippedFrames = 0;
+		}
+
+	private:
+		friend class World;
+
+		std::chrono::high_resolution_clock::time_point m_sliceDeadline;
+		double m_policyAccumulator = 0.0;	// Rate
+		uint64_t m_policyFrameOffset = 0;	// EveryNFrames（開始したフレーム）
+		float m_pendingElapsed = 0.0f;		// 間引いたフレームの経過時間
+		bool m_policyStarted = false;
+	};
+
+	/**
+	 * @class	SliceCursor
+	 * @brief	TimeSliced のシステムで、前のフレームの続きから走査するためのカーソル
+	 * @details
+	 * 1周の開始時に対象のエンティティを控え、予算の残る間だけ順に処理する。
+	 * 周の途中で range から外れた（破棄・コンポーネントの削除・非Active など）エンティティは飛ばし、
+	 * 途中で増えた分は次の周で処理する。range は contains(Entity) を持つこと（View / Group / Query）。
+	 * 例: if (m_cursor.each(*this, reg, reg.view<EnemyStats, Transform>(), [&](Entity e) { ... })) { 1周終わった }
+	 */
+	class SliceCursor
+	{
+	public:
+		// range（View / Query など）の各エンティティに func(Entity) を呼ぶ（この呼び出しで1周を終えたら true）
+		// ※ 予算が足りなくても、1回の呼び出しで最低1体は進める
+		template<typename Range, typename Func>
+		bool each(ISystem& sys, Registry& registry, Range&& range, Func func)
+		{
+			if (m_position >= m_entities.size())
+			{
+				m_entities.clear();
+				for (Entity e : range) m_entities.push_back(e);
+				m_position = 0;
+			}
+
+			bool first = true;
+			while (m_position < m_entities.size())
+			{
+				if (!first && !sys.hasBudget()) break;
+
+				// 飛ばした分は最低1体の数に入れない
+				Entity e = m_entities[m_position++];
+				if (!registry.valid(e) || !range.contains(e)) continue;
+				func(e);
+				first = false;
+			}
+
+			sys.m_sliceProgress = m_entities.empty() ? 1.0f : (float)m_position / (float)m_entities.size();
+			if (m_position < m_entities.size()) return false;
+
+			++sys.m_slicePasses;
+			return true;
+		}
+
+		// 周の途中でも、次の呼び出しを新しい周から始める
+		void reset()
+		{
+			m_entities.clear();
+			m_position = 0;
+		}
+
+		std::size_t position() const { return m_position; }
+		std::size_t size() const { return m_entities.size(); }
+
+	private:
+		std::vector<Entity> m_entities;
+		std::size_t m_position = 0;
 	};
 
 	class World
@@ -939,6 +4264,18 @@ namespace Arche
 		Registry registry;
 		std::vector<std::unique_ptr<ISystem>> systems;
 
+		// 実行段（同じ段のシステムは互いに競合しない。システム一覧の変更時に作り直す）
+		std::vector<std::vector<ISystem*>> stages;
+		bool scheduleDirty = true;
+
+		// このフレームで実行した固定ステップ数（Tick で締める）
+		int fixedStepCount = 0;
+		int lastFixedStepCount = 0;
+
+		// 実行頻度の判定用
+		uint64_t frameIndex = 0;
+		float frameDeltaTime = 0.0f;
+
 	public:
 		// Entity作成を開始する（ビルダーを返す）
 		EntityHandle create_entity()
@@ -966,6 +4303,7 @@ namespace Arche
 			auto sys = std::make_unique<T>(std::forward<Args>(args)...);
 			auto ptr = sys.get();
 			systems.push_back(std::move(sys));
+			scheduleDirty = true;
 			return ptr;
 		}
 
@@ -980,7 +4318,10 @@ namespace Arche
 			if (it != systems.end())
 			{
 				systems.erase(it, systems.end());
+				scheduleDirty = true;
+#ifndef ARCHE_ECS_STANDALONE
 				Logger::Log("Removed System: " + name);
+#endif // !ARCHE_ECS_STANDALONE
 			}
 		}
 
@@ -988,6 +4329,7 @@ namespace Arche
 		void clearSystems()
 		{
 			systems.clear();
+			scheduleDirty = true;
 		}
 
 		// 全エンティティ削除
@@ -997,40 +4339,75 @@ namespace Arche
 		}
 
 		// 全システムのUpdateを実行
+		// ※ 競合しないシステム（SystemAccess で宣言）は同じ段にまとめて並列実行する
 		void Tick(EditorState state)
 		{
+			ARCHE_PROFILE_SCOPE("World::Tick");
+
+			++frameIndex;
+			frameDeltaTime = Time::DeltaTime();
+
+			// 処理時間のリセット（固定ステップ分は FixedTick で済ませている）
 			for (auto& sys : systems)
 			{
-				sys->m_lastExecutionTime = 0.0f;
-				if (!sys->m_isEnabled) continue;
-
-				bool shouldRun = false;
-				switch (sys->m_group)
+				if (sys->m_group != SystemGroup::FixedUpdate || fixedStepCount == 0)
 				{
-				case SystemGroup::Always:   shouldRun = true; break;
-				case SystemGroup::PlayOnly: shouldRun = (state == EditorState::Play); break;
-				case SystemGroup::EditOnly: shouldRun = (state == EditorState::Edit); break;
-				case SystemGroup::Unspecified: shouldRun = (state == EditorState::Play); break;
-				case SystemGroup::Overlay:  shouldRun = true; break;
+					sys->m_lastExecutionTime = 0.0;
+					sys->m_didRun = false;
 				}
+			}
 
-				if (!shouldRun) continue;
+			runStages(state, false);
 
-				// 計測開始
-				auto start = std::chrono::high_resolution_clock::now();
+			// フレーム中に積まれたイベントをまとめて通知（購読者の構造変更もここで適用）
+			{
+				ARCHE_PROFILE_SCOPE("Dispatcher::update");
+				Dispatcher::update();
+				registry.commands().playback(registry);
+			}
 
-				sys->Update(registry);
+			lastFixedStepCount = fixedStepCount;
+			fixedStepCount = 0;
+		}
 
-				// 計測終了
-				auto end = std::chrono::high_resolution_clock::now();
-				std::chrono::duration<double, std::milli> ms = end - start;
-				sys->m_lastExecutionTime = ms.count();
+		// FixedUpdate グループのシステムを1ステップ分実行（Play時のみ）
+		// ※ 1フレームに0回以上、Tick より先に呼ぶ。処理時間はフレーム内のステップ分を合計する
+		// ※ イベントの通知はフレームの Tick でまとめて行う
+		void FixedTick(EditorState state)
+		{
+			ARCHE_PROFILE_SCOPE("World::FixedTick");
+
+			if (fixedStepCount++ == 0)
+			{
+				for (auto& sys : systems)
+				{
+					if (sys->m_group != SystemGroup::FixedUpdate) continue;
+					sys->m_lastExecutionTime = 0.0;
+					sys->m_didRun = false;
+				}
+			}
+
+			runStages(state, true);
+		}
+
+		// 実行対象の FixedUpdate システムがあるか
+		bool hasFixedSystems() const
+		{
+			for (const auto& sys : systems)
+			{
+				if (sys->m_isEnabled && sys->m_group == SystemGroup::FixedUpdate) return true;
 			}
+			return false;
 		}
 
+		// 前のフレームで実行した固定ステップ数
+		int getLastFixedStepCount() const { return lastFixedStepCount; }
+
 		// 全システムのRenderを実行
 		void Render(const Context& context)
 		{
+			ARCHE_PROFILE_SCOPE("World::Render");
+
 			// 1. 通常の描画
 			for (auto& sys : systems)
 			{
@@ -1039,6 +4416,7 @@ namespace Arche
 				if (sys->m_group == SystemGroup::Overlay) continue;
 
 				// 計測開始
+				ARCHE_PROFILE_SCOPE_DYNAMIC(sys->m_systemName);
 				auto start = std::chrono::high_resolution_clock::now();
 
 				sys->Render(registry, context);
@@ -1057,6 +4435,7 @@ namespace Arche
 				if (sys->m_group != SystemGroup::Overlay) continue;
 
 				// 計測開始
+				ARCHE_PROFILE_SCOPE_DYNAMIC(sys->m_systemName);
 				auto start = std::chrono::high_resolution_clock::now();
 
 				sys->Render(registry, context);
@@ -1071,10 +4450,221 @@ namespace Arche
 		// デバッグ用にシステムリストを取得
 		const std::vector<std::unique_ptr<ISystem>>& getSystems() const { return systems; }
 
+		// デバッグ用に実行段を取得
+		const std::vector<std::vector<ISystem*>>& getStages()
+		{
+			if (scheduleDirty) buildSchedule();
+			return stages;
+		}
+
 
 		// Registryへの直接アクセスが必要な場合
 		Registry& getRegistry() { return registry; }
 		const Registry& getRegistry() const { return registry; }
+
+	private:
+		// 実行段ごとに、対象のシステムを実行する（fixedStep: FixedUpdate グループのみ / それ以外のみ）
+		void runStages(EditorState state, bool fixedStep)
+		{
+			if (scheduleDirty) buildSchedule();
+
+			std::vector<ISystem*> parallel;
+			std::vector<ISystem*> serial;
+
+			for (auto& stage : stages)
+			{
+				parallel.clear();
+				serial.clear();
+
+				for (ISystem* sys : stage)
+				{
+					if (!shouldRun(*sys, state, fixedStep)) continue;
+					if (!fixedStep && !consumeRunPolicy(*sys)) continue;
+					if (fixedStep)
+					{
+						sys->m_elapsedTime = Time::DeltaTime();
+						sys->m_didRun = true;
+					}
+
+					// onUpdate の通知が必要なシステムは呼び出しスレッドで実行する
+					if (stage.size() > 1 && !sys->m_access.hasPatchListener(registry)) parallel.push_back(sys);
+					else serial.push_back(sys);
+				}
+
+				// 並列分（呼び出しスレッドも待ちながら手伝う）
+				if (!parallel.empty())
+				{
+					for (ISystem* sys : parallel) sys->m_access.preparePools(registry);
+
+					JobCounter counter;
+					for (ISystem* sys : parallel)
+					{
+						JobSystem::Run([this, sys]() { runSystem(*sys); }, counter);
+					}
+					JobSystem::Wait(counter);
+				}
+
+				// 逐次分（登録順）
+				for (ISystem* sys : serial)
+				{
+					runSystem(*sys);
+				}
+
+				// 同期点：段の中で記録された構造変更をまとめて適用
+				const std::size_t ranCount = parallel.size() + serial.size();
+				if (ranCount == 0) continue;
+
+				auto start = std::chrono::high_resolution_clock::now();
+				{
+					ARCHE_PROFILE_SCOPE("CommandBuffer::playback");
+					registry.commands().playback(registry);
+				}
+				auto end = std::chrono::high_resolution_clock::now();
+
+				// 適用時間は段で実行したシステムに等分する（単独なら従来通りそのシステムの時間）
+				const double playbackMs = std::chrono::duration<double, std::milli>(end - start).count() / (double)ranCount;
+				for (ISystem* sys : parallel) sys->m_lastExecutionTime += playbackMs;
+				for (ISystem* sys : serial) sys->m_lastExecutionTime += playbackMs;
+			}
+		}
+
+		// グループ設定と再生状態から実行するか判定
+		static bool shouldRun(const ISystem& sys, EditorState state, bool fixedStep)
+		{
+			if (!sys.m_isEnabled) return false;
+
+			// FixedUpdate は固定ステップでのみ、それ以外は固定ステップでは実行しない
+			if (sys.m_group == SystemGroup::FixedUpdate) return fixedStep && state == EditorState::Play;
+			if (fixedStep) return false;
+
+			switch (sys.m_group)
+			{
+			case SystemGroup::Always:   return true;
+			case SystemGroup::PlayOnly: return (state == EditorState::Play);
+			case SystemGroup::EditOnly: return (state == EditorState::Edit);
+			case SystemGroup::Unspecified: return (state == EditorState::Play);
+			case SystemGroup::Overlay:  return true;
+			case SystemGroup::FixedUpdate: return false;
+			}
+			return false;
+		}
+
+		// 実行頻度から、このフレームで Update するか判定する（実行対象のシステムに1フレーム1回呼ぶ）
+		bool consumeRunPolicy(ISystem& sys)
+		{
+			const SystemRunPolicy& policy = sys.m_runPolicy;
+			const float elapsed = sys.m_pendingElapsed + frameDeltaTime;
+
+			bool run = true;
+			switch (policy.mode)
+			{
+			case SystemRunPolicy::Mode::EveryFrame:
+			case SystemRunPolicy::Mode::TimeSliced:
+				break;
+
+			case SystemRunPolicy::Mode::EveryNFrames:
+			{
+				const uint64_t interval = std::max<uint32_t>(policy.interval, 1);
+				if (!sys.m_policyStarted)
+				{
+					// phase 分だけ後のフレームを1回目にする
+					const uint64_t delay = (uint64_t)(std::clamp(policy.phase, 0.0f, 1.0f) * (float)interval) % interval;
+					sys.m_policyFrameOffset = frameIndex + delay;
+					sys.m_policyStarted = true;
+				}
+				run = frameIndex >= sys.m_policyFrameOffset && (frameIndex - sys.m_policyFrameOffset) % interval == 0;
+				break;
+			}
+
+			case SystemRunPolicy::Mode::Rate:
+			{
+				if (policy.hz <= 0.0f) break;
+				const double period = 1.0 / (double)policy.hz;
+				if (!sys.m_policyStarted)
+				{
+					// phase 0 は最初のフレームで実行、0.5 なら半周期後
+					sys.m_policyAccumulator = period * (1.0 - std::clamp((double)policy.phase, 0.0, 1.0));
+					sys.m_policyStarted = true;
+				}
+				else
+				{
+					sys.m_policyAccumulator += frameDeltaTime;
+				}
+
+				run = sys.m_policyAccumulator >= period;
+				if (run)
+				{
+					// 1フレームに1回まで（溜まった分は追いかけない）
+					sys.m_policyAccumulator = std::fmod(sys.m_policyAccumulator - period, period);
+				}
+				break;
+			}
+			}
+
+			if (!run)
+			{
+				sys.m_pendingElapsed = elapsed;
+				++sys.m_skippedFrames;
+				return false;
+			}
+
+			sys.m_elapsedTime = elapsed;
+			sys.m_pendingElapsed = 0.0f;
+			sys.m_skippedFrames = 0;
+			sys.m_didRun = true;
+			return true;
+		}
+
+		// 1システム分の Update（処理時間を計測）
+		void runSystem(ISystem& sys)
+		{
+			ARCHE_PROFILE_SCOPE_DYNAMIC(sys.m_systemName);
+			auto start = std::chrono::high_resolution_clock::now();
+
+			if (sys.m_runPolicy.mode == SystemRunPolicy::Mode::TimeSliced)
+			{
+				sys.m_sliceDeadline = start + std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+					std::chrono::duration<double, std::micro>(std::max(sys.m_runPolicy.budgetUs, 0.0f)));
+			}
+
+			// 実行ごとに新しいティックを発行し、書き込みと変更判定の基準にする
+			// 宣言したシステムは、宣言外への get をデバッグ時に検出する
+			SystemTicks ticks{ registry.advanceTick(), sys.m_lastRunTick, sys.m_access.isDeclared() ? &sys.m_access : nullptr };
+			{
+				TickScope scope(ticks);
+				sys.Update(registry);
+			}
+			sys.m_lastRunTick = ticks.thisRun;
+
+			auto end = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double, std::milli> ms = end - start;
+			sys.m_lastExecutionTime += ms.count();
+		}
+
+		// 依存関係（DAG）から実行段を作る
+		// 登録順で先にある競合システムの全てより後の段に置く（競合する同士の順序は登録順のまま）
+		void buildSchedule()
+		{
+			stages.clear();
+			std::vector<std::size_t> stageOf(systems.size(), 0);
+
+			for (std::size_t i = 0; i < systems.size(); ++i)
+			{
+				std::size_t stage = 0;
+				for (std::size_t j = 0; j < i; ++j)
+				{
+					if (stageOf[j] + 1 > stage && systems[i]->m_access.conflictsWith(systems[j]->m_access))
+					{
+						stage = stageOf[j] + 1;
+					}
+				}
+				stageOf[i] = stage;
+
+				if (stages.size() <= stage) stages.resize(stage + 1);
+				stages[stage].push_back(systems[i].get());
+			}
+			scheduleDirty = false;
+		}
 	};
 
 }	// namespace Arche
@@ -0,0 +1,243 @@
+﻿/*****************************************************************//**
+ * @file	Hierarchy.cpp
+ * @brief	Relationship（侵入型の親子リスト）の操作
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Engine/Scene/Core/Hierarchy.h"
+
+namespace Arche
+{
+	void Hierarchy::Install(Registry& reg)
+	{
+		Registry* r = &reg;
+		reg.SetParentLookup([r](Entity e) -> Entity
+		{
+			return GetParent(*r, e);
+		});
+		reg.SetChildrenLookup([r](Entity e, std::vector<Entity>& out)
+		{
+			for (Entity child : Children(*r, e)) out.push_back(child);
+		});
+	}
+
+	bool Hierarchy::SetParent(Registry& reg, Entity child, Entity parent)
+	{
+		if (parent == NullEntity)
+		{
+			Detach(reg, child);
+			return true;
+		}
+		if (child == parent || IsAncestor(reg, child, parent)) return false;
+
+		// 既に同じ親の子なら並びを変えない
+		if (reg.has<Relationship>(child) && reg.read<Relationship>(child).parent == parent && IsLinked(reg, child)) return true;
+
+		return InsertChild(reg, parent, child, -1);
+	}
+
+	bool Hierarchy::InsertChild(Registry& reg, Entity parent, Entity child, int index)
+	{
+		if (!reg.valid(child) || !reg.valid(parent)) return false;
+		if (child == parent || IsAncestor(reg, child, parent)) return false;
+
+		ConnectRemoveHook(reg);
+		if (!reg.has<Relationship>(child)) reg.emplace<Relationship>(child);
+		if (!reg.has<Relationship>(parent)) reg.emplace<Relationship>(parent);
+
+		if (IsLinked(reg, child)) Unlink(reg, child);
+
+		// index 番目の子の手前に入れる（範囲外なら末尾）
+		Entity before = NullEntity;
+		if (index >= 0)
+		{
+			int i = 0;
+			for (Entity c : Children(reg, parent))
+			{
+				if (i++ == index) { before = c; break; }
+			}
+		}
+
+		Link(reg, child, parent, before);
+		UpdateDepth(reg, child, reg.read<Relationship>(parent).depth + 1);
+		reg.updateActiveHierarchy(child);
+		return true;
+	}
+
+	void Hierarchy::Detach(Registry& reg, Entity child)
+	{
+		if (!reg.has<Relationship>(child)) return;
+
+		if (IsLinked(reg, child)) Unlink(reg, child);
+		Relationship& rel = reg.get<Relationship>(child);
+		rel.parent = NullEntity;
+		rel.prevSibling = rel.nextSibling = NullEntity;
+		UpdateDepth(reg, child, 0);
+		reg.updateActiveHierarchy(child);
+	}
+
+	void Hierarchy::DestroyRecursive(Registry& reg, Entity entity)
+	{
+		if (!reg.valid(entity)) return;
+
+		// 子孫を先に集めてから、深い方から破棄する（破棄中にリストが書き換わるため）
+		std::vector<Entity> targets;
+		for (Entity e : DepthOrder(reg, entity)) targets.push_back(e);
+		for (auto it = targets.rbegin(); it != targets.rend(); ++it) reg.destroy(*it);
+	}
+
+	std::vector<Entity> Hierarchy::GetChildren(Registry& reg, Entity entity)
+	{
+		std::vector<Entity> children;
+		children.reserve(GetChildCount(reg, entity));
+		for (Entity c : Children(reg, entity)) children.push_back(c);
+		return children;
+	}
+
+	int Hierarchy::GetChildIndex(Registry& reg, Entity child)
+	{
+		if (!IsLinked(reg, child)) return -1;
+
+		int index = 0;
+		for (Entity c : Children(reg, reg.read<Relationship>(child).parent))
+		{
+			if (c == child) return index;
+			++index;
+		}
+		return -1;
+	}
+
+	bool Hierarchy::IsAncestor(Registry& reg, Entity ancestor, Entity entity)
+	{
+		// 親を辿る（壊れたデータでの無限ループ防止に回数を制限する）
+		Entity current = GetParent(reg, entity);
+		for (int guard = 0; current != NullEntity && reg.valid(current) && guard < 4096; ++guard)
+		{
+			if (current == ancestor) return true;
+			current = GetParent(reg, current);
+		}
+		return false;
+	}
+
+	bool Hierarchy::IsLinked(Registry& reg, Entity entity)
+	{
+		if (!reg.has<Relationship>(entity)) return false;
+		const Relationship& rel = reg.read<Relationship>(entity);
+		if (rel.parent == NullEntity || !reg.valid(rel.parent) || !reg.has<Relationship>(rel.parent)) return false;
+		return rel.prevSibling != NullEntity || reg.read<Relationship>(rel.parent).firstChild == entity;
+	}
+
+	void Hierarchy::Unlink(Registry& reg, Entity entity)
+	{
+		Relationship& rel = reg.get<Relationship>(entity);
+		Relationship& parentRel = reg.get<Relationship>(rel.parent);
+
+		if (rel.prevSibling != NullEntity) reg.get<Relationship>(rel.prevSibling).nextSibling = rel.nextSibling;
+		else parentRel.firstChild = rel.nextSibling;
+
+		if (rel.nextSibling != NullEntity) reg.get<Relationship>(rel.nextSibling).prevSibling = rel.prevSibling;
+		else parentRel.lastChild = rel.prevSibling;
+
+		--parentRel.childCount;
+		rel.prevSibling = rel.nextSibling = NullEntity;
+	}
+
+	void Hierarchy::Link(Registry& reg, Entity child, Entity parent, Entity before)
+	{
+		Relationship& rel = reg.get<Relationship>(child);
+		Relationship& parentRel = reg.get<Relationship>(parent);
+
+		rel.parent = parent;
+		if (before == NullEntity)
+		{
+			rel.prevSibling = parentRel.lastChild;
+			rel.nextSibling = NullEntity;
+			if (parentRel.lastChild != NullEntity) reg.get<Relationship>(parentRel.lastChild).nextSibling = child;
+			else parentRel.firstChild = child;
+			parentRel.lastChild = child;
+		}
+		else
+		{
+			Relationship& beforeRel = reg.get<Relationship>(before);
+			rel.prevSibling = beforeRel.prevSibling;
+			rel.nextSibling = before;
+			if (beforeRel.prevSibling != NullEntity) reg.get<Relationship>(beforeRel.prevSibling).nextSibling = child;
+			else parentRel.firstChild = child;
+			beforeRel.prevSibling = child;
+		}
+		++parentRel.childCount;
+	}
+
+	void Hierarchy::UpdateWorldMatrices(Registry& reg, Entity root)
+	{
+		if (!reg.has<Transform>(root)) return;
+
+		// 親が先に来るので、子は計算し直した親の行列をそのまま使える
+		for (Entity e : DepthOrder(reg, root))
+		{
+			if (!reg.has<Transform>(e)) continue;
+
+			const Entity parent = GetParent(reg, e);
+			const XMMATRIX parentMatrix = (reg.valid(parent) && reg.has<Transform>(parent))
+				? reg.read<Transform>(parent).GetWorldMatrix()
+				: XMMatrixIdentity();
+
+			Transform& t = reg.get<Transform>(e);
+			XMStoreFloat4x4(&t.worldMatrix, t.GetLocalMatrix() * parentMatrix);
+		}
+	}
+
+	void Hierarchy::UpdateDepth(Registry& reg, Entity root, uint32_t depth)
+	{
+		std::vector<std::pair<Entity, uint32_t>> stack = { { root, depth } };
+		while (!stack.empty())
+		{
+			auto [entity, d] = stack.back();
+			stack.pop_back();
+			Relationship& rel = reg.get<Relationship>(entity);
+			if (rel.depth == d && entity != root) continue;	// 子孫も揃っている
+			rel.depth = d;
+			for (Entity c = rel.firstChild; c != NullEntity; c = reg.read<Relationship>(c).nextSibling)
+			{
+				stack.push_back({ c, d + 1 });
+			}
+		}
+	}
+
+	void Hierarchy::OnRelationshipRemoved(Registry& reg, Entity entity)
+	{
+		// 削除通知の時点ではまだ所持している
+		if (IsLinked(reg, entity)) Unlink(reg, entity);
+
+		// 子は親を指したまま切り離す（親が破棄された子は非Activeのルートになる）
+		Relationship& rel = reg.get<Relationship>(entity);
+		for (Entity c = rel.firstChild; c != NullEntity;)
+		{
+			Relationship& childRel = reg.get<Relationship>(c);
+			const Entity next = childRel.nextSibling;
+			childRel.prevSibling = childRel.nextSibling = NullEntity;
+			UpdateDepth(reg, c, 0);
+			c = next;
+		}
+		rel.firstChild = rel.lastChild = NullEntity;
+		rel.childCount = 0;
+	}
+
+	void Hierarchy::ConnectRemoveHook(Registry& reg)
+	{
+		// Registry::clear() でプールが作り直されるため、繋ぐ直前に毎回確認する
+		auto& pool = reg.getPool<Relationship>();
+		if (!pool.onDestroy.contains<&Hierarchy::OnRelationshipRemoved>(reg))
+		{
+			pool.onDestroy.connect<&Hierarchy::OnRelationshipRemoved>(reg);
+		}
+	}
+
+}	// namespace Arche
@@ -0,0 +1,173 @@
+﻿/*****************************************************************//**
+ * @file	Hierarchy.h
+ * @brief	Relationship（侵入型の親子リスト）の操作
+ *
+ * @details
+ * 子の一覧を vector で持たず、先頭の子と兄弟同士を直接繋ぐ。
+ * 繋ぎ替え（SetParent / Detach）は O(1)、子の追加でヒープ確保は発生しない。
+ * Relationship の削除（エンティティ破棄を含む）時には自動でリストから外れる。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___HIERARCHY_H___
+#define ___HIERARCHY_H___
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Scene/Components/Components.h"
+
+namespace Arche
+{
+	class ARCHE_API Hierarchy
+	{
+	public:
+		// Registry の親子参照（Active 状態の伝播）を Relationship に向ける
+		static void Install(Registry& reg);
+
+		// 親を設定して末尾の子にする（parent が NullEntity なら Detach と同じ）
+		// ※ 既に同じ親の子なら何もしない / 自分の子孫を親にしようとした場合は false
+		static bool SetParent(Registry& reg, Entity child, Entity parent);
+
+		// 親の index 番目に挿入する（範囲外なら末尾 / 同じ親の中での並べ替えにも使う）
+		static bool InsertChild(Registry& reg, Entity parent, Entity child, int index);
+
+		// 親から外してルートにする
+		static void Detach(Registry& reg, Entity child);
+
+		// entity とその子孫を全て破棄する
+		static void DestroyRecursive(Registry& reg, Entity entity);
+
+		// 親を取得（持っていなければ NullEntity）
+		static Entity GetParent(Registry& reg, Entity entity)
+		{
+			return reg.has<Relationship>(entity) ? reg.read<Relationship>(entity).parent : NullEntity;
+		}
+
+		static uint32_t GetChildCount(Registry& reg, Entity entity)
+		{
+			return reg.has<Relationship>(entity) ? reg.read<Relationship>(entity).childCount : 0;
+		}
+
+		// 子の一覧のコピー（走査中に破棄・繋ぎ替えをする場合に使う）
+		static std::vector<Entity> GetChildren(Registry& reg, Entity entity);
+
+		// 兄弟の中での位置（親が無ければ -1）
+		static int GetChildIndex(Registry& reg, Entity child);
+
+		// ancestor が entity の祖先か（entity 自身は含まない）
+		static bool IsAncestor(Registry& reg, Entity ancestor, Entity entity);
+
+		// -----------------------------------------------------------
+		// 子の走査（for (Entity c : Hierarchy::Children(reg, e))）
+		// ※ 走査中に現在の子を繋ぎ替える / 破棄する場合は GetChildren を使う
+		// -----------------------------------------------------------
+		class ChildRange
+		{
+		public:
+			class Iterator
+			{
+			public:
+				Iterator(Registry* r, Entity e) : reg(r), current(e) {}
+				Entity operator*() const { return current; }
+				Iterator& operator++()
+				{
+					current = reg->read<Relationship>(current).nextSibling;
+					return *this;
+				}
+				bool operator!=(const Iterator& other) const { return current != other.current; }
+
+			private:
+				Registry* reg;
+				Entity current;
+			};
+
+			ChildRange(Registry& r, Entity parent)
+				: reg(&r), first(r.has<Relationship>(parent) ? r.read<Relationship>(parent).firstChild : NullEntity)
+			{
+			}
+
+			Iterator begin() const { return Iterator(reg, first); }
+			Iterator end() const { return Iterator(reg, NullEntity); }
+
+		private:
+			Registry* reg;
+			Entity first;
+		};
+
+		static ChildRange Children(Registry& reg, Entity parent) { return ChildRange(reg, parent); }
+
+		// -----------------------------------------------------------
+		// 深さ順の走査（root、深さ1の子、深さ2の子 ... の順 / 同じ深さは兄弟順）
+		// 親が必ず子より先に来るので、ワールド行列の計算などに使える
+		// -----------------------------------------------------------
+		class DepthRange
+		{
+		public:
+			class Iterator
+			{
+			public:
+				Iterator(Registry* r, std::vector<Entity>* q, std::size_t i) : reg(r), queue(q), index(i) {}
+				Entity operator*() const { return (*queue)[index]; }
+				Iterator& operator++()
+				{
+					// 現在の子を末尾に積んでから進む（幅優先）
+					for (Entity c : ChildRange(*reg, (*queue)[index])) queue->push_back(c);
+					++index;
+					return *this;
+				}
+				bool operator!=(const Iterator& other) const
+				{
+					return (index < queue->size()) != (other.index < other.queue->size());
+				}
+
+			private:
+				Registry* reg;
+				std::vector<Entity>* queue;
+				std::size_t index;
+			};
+
+			DepthRange(Registry& r, Entity root) : reg(&r)
+			{
+				if (r.valid(root)) queue.push_back(root);
+			}
+
+			Iterator begin() { return Iterator(reg, &queue, 0); }
+			Iterator end() { return Iterator(reg, &queue, SIZE_MAX); }
+
+		private:
+			Registry* reg;
+			std::vector<Entity> queue;
+		};
+
+		static DepthRange DepthOrder(Registry& reg, Entity root) { return DepthRange(reg, root); }
+
+		// root とその子孫のワールド行列を計算し直す（root の親は保存済みの行列を使う）
+		// ※ HierarchySystem を待たずに最新の位置が要る場合（固定ステップ内の衝突判定など）に使う
+		static void UpdateWorldMatrices(Registry& reg, Entity root);
+
+	private:
+		// entity が親のリストに繋がっているか
+		// ※ 読み込み直後の parent は古い ID のままの場合があるため、親側の繋がりまで確認する
+		static bool IsLinked(Registry& reg, Entity entity);
+
+		// 親のリストから外す（parent は書き換えない）
+		static void Unlink(Registry& reg, Entity entity);
+
+		// 親のリストの before の直前（NullEntity なら末尾）に繋ぐ
+		static void Link(Registry& reg, Entity child, Entity parent, Entity before);
+
+		// 部分木の depth を付け直す
+		static void UpdateDepth(Registry& reg, Entity root, uint32_t depth);
+
+		// Relationship の削除通知（リストから外し、子を切り離す）
+		static void OnRelationshipRemoved(Registry& reg, Entity entity);
+		static void ConnectRemoveHook(Registry& reg);
+	};
+
+}	// namespace Arche
+
+#endif // !___HIERARCHY_H___
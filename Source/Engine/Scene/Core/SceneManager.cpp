@@ -16,6 +16,8 @@
 #include "Engine/Scene/Serializer/SystemRegistry.h"
 #include "Engine/Resource/ResourceManager.h"
 #include "Engine/Core/Time/Time.h"
+#include "Engine/Scene/Core/TransformInterpolator.h"
+#include "Engine/Physics/PhysicsEvents.h"
 
 namespace Arche
 {
@@ -51,6 +53,9 @@ namespace Arche
 		// ※ロード中もアニメーションさせたい場合はここを調整
 		if (m_transition == nullptr || m_transition->GetPhase() != ISceneTransition::Phase::WaitAsync)
 		{
+			// 固定ステップ（FixedUpdate グループ）を先に済ませる
+			if (m_context.editorState == EditorState::Play) RunFixedSteps();
+
 			m_world.Tick(m_context.editorState);
 		}
 
@@ -140,7 +145,12 @@ namespace Arche
 	void SceneManager::Render()
 	{
 		// 1. 通常のシーン描画
-		m_world.Render(m_context);
+		// ※ 固定ステップで動いた物は、直前の2ステップの間を補間した位置で描く
+		{
+			float alpha = (m_context.editorState != EditorState::Edit) ? Time::FixedAlpha() : 1.0f;
+			TransformInterpolator::RenderScope interpolation(m_world.getRegistry(), alpha);
+			m_world.Render(m_context);
+		}
 
 		// 2. ローディングバーの描画 (非同期ロード中のみ)
 		if (m_isAsyncLoading && m_currentAsyncOp)
@@ -192,6 +202,24 @@ namespace Arche
 		targetWorld->Render(m_context);
 	}
 
+	void SceneManager::RunFixedSteps()
+	{
+		Registry& reg = m_world.getRegistry();
+		const int steps = Time::ConsumeFixedSteps();
+
+		for (int i = 0; i < steps; ++i)
+		{
+			Time::BeginFixedStep(i);
+			TransformInterpolator::BeginStep(reg);
+			m_world.FixedTick(m_context.editorState);
+			TransformInterpolator::EndStep(reg);
+			Time::EndFixedStep();
+		}
+
+		// ステップが無いフレームでは、前のフレームの衝突イベントを2度処理させない
+		if (steps == 0 && m_world.hasFixedSystems()) Physics::EventManager::Instance().Clear();
+	}
+
 	// 同期ロード
 	void SceneManager::LoadScene(const std::string& filepath, ISceneTransition* transition)
 	{
@@ -70,6 +70,9 @@ namespace Arche
 		// 内部処理
 		void PerformLoad(const std::string& path);
 
+		// このフレームの分の固定ステップを実行する
+		void RunFixedSteps();
+
 	private:
 		static SceneManager* s_instance;
 		World m_world;
@@ -0,0 +1,171 @@
+﻿/*****************************************************************//**
+ * @file	TransformInterpolator.cpp
+ * @brief	固定ステップで動かしたエンティティの描画用補間
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Engine/Scene/Core/TransformInterpolator.h"
+#include "Engine/Scene/Core/Hierarchy.h"
+#include "Engine/Core/Profiler/Profiler.h"
+
+namespace Arche
+{
+	namespace
+	{
+		bool Equal(const XMFLOAT3& a, const XMFLOAT3& b)
+		{
+			return a.x == b.x && a.y == b.y && a.z == b.z;
+		}
+
+		XMVECTOR ToQuaternion(const XMFLOAT3& degrees)
+		{
+			return XMQuaternionRotationRollPitchYaw(XMConvertToRadians(degrees.x), XMConvertToRadians(degrees.y), XMConvertToRadians(degrees.z));
+		}
+
+		// 行列式がほぼ 0（スケール 0 など）なら逆行列を作らない
+		bool Invert(const XMMATRIX& m, XMMATRIX& out)
+		{
+			XMVECTOR det;
+			out = XMMatrixInverse(&det, m);
+			return std::abs(XMVectorGetX(det)) > 1e-12f;
+		}
+	}
+
+	void TransformInterpolator::BeginStep(Registry& reg)
+	{
+		ARCHE_PROFILE_FUNCTION();
+
+		// 補間用のコンポーネントが無い物に追加しておく
+		std::vector<Entity> missing;
+		auto missingView = reg.view<Transform, Rigidbody>();
+		missingView.exclude<TransformInterpolation>();
+		for (auto e : missingView)
+		{
+			if (reg.read<Rigidbody>(e).type != BodyType::Static) missing.push_back(e);
+		}
+		for (auto e : missing) reg.emplace<TransformInterpolation>(e);
+
+		// ステップ前の値を1つ前として控える（変更扱いにはしない）
+		auto& transforms = reg.getPool<Transform>();
+		auto& interpolations = reg.getPool<TransformInterpolation>();
+		for (Entity e : interpolations.getEntities())
+		{
+			if (!transforms.has(e)) continue;
+			const Transform& t = transforms.get(e);
+			TransformInterpolation& ip = interpolations.get(e);
+			ip.prevPosition = t.position;
+			ip.prevRotation = t.rotation;
+			ip.prevScale = t.scale;
+		}
+	}
+
+	void TransformInterpolator::EndStep(Registry& reg)
+	{
+		ARCHE_PROFILE_FUNCTION();
+
+		auto& transforms = reg.getPool<Transform>();
+		auto& interpolations = reg.getPool<TransformInterpolation>();
+		for (Entity e : interpolations.getEntities())
+		{
+			if (!transforms.has(e)) continue;
+			const Transform& t = transforms.get(e);
+			TransformInterpolation& ip = interpolations.get(e);
+			ip.position = t.position;
+			ip.rotation = t.rotation;
+			ip.scale = t.scale;
+			ip.valid = true;
+		}
+	}
+
+	void TransformInterpolator::Apply(Registry& reg, float alpha, std::vector<Saved>& saved)
+	{
+		saved.clear();
+		if (alpha >= 1.0f || !reg.hasPool<TransformInterpolation>()) return;
+
+		ARCHE_PROFILE_FUNCTION();
+		alpha = std::max(alpha, 0.0f);
+
+		auto& transforms = reg.getPool<Transform>();
+		auto& interpolations = reg.getPool<TransformInterpolation>();
+		auto& relationships = reg.getPool<Relationship>();
+
+		// 対象（動いていて、ステップの後に書き換えられていない物）を親から順に並べる
+		std::vector<std::pair<uint32_t, Entity>> targets;
+		for (Entity e : interpolations.getEntities())
+		{
+			if (!transforms.has(e) || !reg.isActive(e)) continue;
+			const Transform& t = transforms.get(e);
+			const TransformInterpolation& ip = interpolations.get(e);
+			if (!ip.valid) continue;
+			if (!Equal(t.position, ip.position) || !Equal(t.rotation, ip.rotation) || !Equal(t.scale, ip.scale)) continue;
+			if (Equal(ip.prevPosition, ip.position) && Equal(ip.prevRotation, ip.rotation) && Equal(ip.prevScale, ip.scale)) continue;
+
+			const uint32_t depth = relationships.has(e) ? relationships.get(e).depth : 0;
+			targets.emplace_back(depth, e);
+		}
+		if (targets.empty()) return;
+		std::sort(targets.begin(), targets.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		// 差し替える前の行列を控えてから書き込む（親と子の両方が対象なら2回控えるが、逆順に戻すので問題ない）
+		auto write = [&](Entity e, const XMMATRIX& m)
+		{
+			Transform& t = transforms.get(e);
+			saved.push_back({ e, t.worldMatrix });
+			XMStoreFloat4x4(&t.worldMatrix, m);
+		};
+
+		for (const auto& [depth, e] : targets)
+		{
+			const Transform& t = transforms.get(e);
+			const TransformInterpolation& ip = interpolations.get(e);
+
+			XMMATRIX currentLocalInv;
+			if (!Invert(t.GetLocalMatrix(), currentLocalInv)) continue;
+
+			const XMVECTOR s = XMVectorLerp(XMLoadFloat3(&ip.prevScale), XMLoadFloat3(&ip.scale), alpha);
+			const XMVECTOR r = XMQuaternionSlerp(ToQuaternion(ip.prevRotation), ToQuaternion(ip.rotation), alpha);
+			const XMVECTOR p = XMVectorLerp(XMLoadFloat3(&ip.prevPosition), XMLoadFloat3(&ip.position), alpha);
+			const XMMATRIX local = XMMatrixScalingFromVector(s) * XMMatrixRotationQuaternion(r) * XMMatrixTranslationFromVector(p);
+
+			// ワールド = ローカル * 親 なので、ローカルだけを入れ替える
+			const XMMATRIX oldWorld = t.GetWorldMatrix();
+			const XMMATRIX newWorld = local * currentLocalInv * oldWorld;
+
+			XMMATRIX oldWorldInv;
+			if (!Invert(oldWorld, oldWorldInv)) continue;
+			const XMMATRIX delta = oldWorldInv * newWorld;
+
+			// 子孫にも同じだけ動かす
+			for (Entity d : Hierarchy::DepthOrder(reg, e))
+			{
+				if (d == e)
+				{
+					write(d, newWorld);
+					continue;
+				}
+				if (!transforms.has(d)) continue;
+				write(d, transforms.get(d).GetWorldMatrix() * delta);
+			}
+		}
+	}
+
+	void TransformInterpolator::Restore(Registry& reg, const std::vector<Saved>& saved)
+	{
+		if (saved.empty()) return;
+
+		// 同じエンティティを複数回書いた場合も、逆順に戻せば最初の値になる
+		auto& transforms = reg.getPool<Transform>();
+		for (auto it = saved.rbegin(); it != saved.rend(); ++it)
+		{
+			if (transforms.has(it->entity)) transforms.get(it->entity).worldMatrix = it->worldMatrix;
+		}
+	}
+
+}	// namespace Arche
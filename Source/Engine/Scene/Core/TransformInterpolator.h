@@ -0,0 +1,75 @@
+﻿/*****************************************************************//**
+ * @file	TransformInterpolator.h
+ * @brief	固定ステップで動かしたエンティティの描画用補間
+ *
+ * @details
+ * 固定ステップの前後で Transform を TransformInterpolation に控えておき、
+ * 描画の間だけワールド行列を「1つ前のステップ」と「直前のステップ」の間へ差し替える。
+ * 差し替えた行列は RenderScope を抜ける時に戻すので、更新側から補間は見えない。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___TRANSFORM_INTERPOLATOR_H___
+#define ___TRANSFORM_INTERPOLATOR_H___
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Scene/Components/Components.h"
+
+namespace Arche
+{
+	class ARCHE_API TransformInterpolator
+	{
+	public:
+		// 差し替え前のワールド行列
+		struct Saved
+		{
+			Entity entity;
+			XMFLOAT4X4 worldMatrix;
+		};
+
+		// 固定ステップの開始時（対象に TransformInterpolation を付け、今の Transform を1つ前として控える）
+		static void BeginStep(Registry& reg);
+
+		// 固定ステップの終了時（ステップ後の Transform を控える）
+		static void EndStep(Registry& reg);
+
+		// ワールド行列を alpha（0.0 = 1つ前のステップ / 1.0 = 直前のステップ）の位置に差し替える
+		// ※ ステップの外で Transform を書き換えた（ワープ・エディタでの編集など）エンティティは補間しない
+		static void Apply(Registry& reg, float alpha, std::vector<Saved>& saved);
+
+		// Apply で差し替えた行列を戻す
+		static void Restore(Registry& reg, const std::vector<Saved>& saved);
+
+		// -----------------------------------------------------------
+		// 描画の間だけ補間する（スコープを抜けると元に戻る）
+		// -----------------------------------------------------------
+		class RenderScope
+		{
+		public:
+			RenderScope(Registry& reg, float alpha) : m_reg(reg)
+			{
+				Apply(m_reg, alpha, m_saved);
+			}
+
+			~RenderScope()
+			{
+				Restore(m_reg, m_saved);
+			}
+
+			RenderScope(const RenderScope&) = delete;
+			RenderScope& operator=(const RenderScope&) = delete;
+
+		private:
+			Registry& m_reg;
+			std::vector<Saved> m_saved;
+		};
+	};
+
+}	// namespace Arche
+
+#endif // !___TRANSFORM_INTERPOLATOR_H___
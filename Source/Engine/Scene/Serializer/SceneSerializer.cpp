@@ -6,6 +6,7 @@
 #include "Engine/Scene/Serializer/SystemRegistry.h"
 #include "Engine/Scene/Serializer/ComponentRegistry.h"
 #include "Engine/Scene/Components/Components.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 
 namespace Arche
 {
@@ -50,6 +51,13 @@ namespace Arche
 			json sysJson;
 			sysJson["Name"] = sys->m_systemName;
 			sysJson["Group"] = (int)sys->m_group;
+
+			// 実行頻度（システム側の既定値と区別できるよう毎フレームでも書く）
+			const SystemRunPolicy& policy = sys->m_runPolicy;
+			sysJson["RunPolicy"] = {
+				{ "Mode", (int)policy.mode }, { "Interval", policy.interval }, { "Hz", policy.hz },
+				{ "Phase", policy.phase }, { "BudgetUs", policy.budgetUs }
+			};
 			sceneJson["Systems"].push_back(sysJson);
 		}
 
@@ -69,6 +77,15 @@ namespace Arche
 				entityJson["IsActive"] = registry.isActiveSelf(entity);
 
 				ComponentSerializer::SerializeEntity(registry, entity, entityJson);
+
+				// 子の並び（Relationship は parent しか持たないため、順序はここで書き出す）
+				if (entityJson.contains("Relationship"))
+				{
+					json children = json::array();
+					for (Entity child : Hierarchy::Children(registry, entity)) children.push_back((uint32_t)child);
+					entityJson["Relationship"]["children"] = children;
+				}
+
 				sceneJson["Entities"].push_back(entityJson);
 			});
 
@@ -158,7 +175,20 @@ namespace Arche
 				std::string name = sysJson["Name"].get<std::string>();
 				SystemGroup group = SystemGroup::PlayOnly;
 				if (sysJson.contains("Group")) group = (SystemGroup)sysJson["Group"].get<int>();
-				SystemRegistry::Instance().CreateSystem(world, name, group);
+				ISystem* sys = SystemRegistry::Instance().CreateSystem(world, name, group);
+
+				// 実行頻度（無ければシステム側の設定のまま）
+				if (sys && sysJson.contains("RunPolicy"))
+				{
+					const json& p = sysJson["RunPolicy"];
+					SystemRunPolicy& policy = sys->m_runPolicy;
+					policy.mode = (SystemRunPolicy::Mode)p.value("Mode", (int)policy.mode);
+					policy.interval = p.value("Interval", policy.interval);
+					policy.hz = p.value("Hz", policy.hz);
+					policy.phase = p.value("Phase", policy.phase);
+					policy.budgetUs = p.value("BudgetUs", policy.budgetUs);
+					sys->resetRunPolicy();
+				}
 			}
 		}
 
@@ -183,29 +213,41 @@ namespace Arche
 		}
 
 		// Relationship Fix
-		for (auto const& [oldID, entity] : idMap)
-		{
-			if (registry.has<Relationship>(entity))
-			{
-				auto& rel = registry.get<Relationship>(entity);
+		// 読み込んだ parent は旧IDのままなので控えて外し、保存されていた子の並びで繋ぎ直す
+		if (sceneJson.contains("Entities")) {
+			std::unordered_map<Entity, uint32_t> oldParents;
+			for (auto& entityJson : sceneJson["Entities"]) {
+				Entity entity = idMap[entityJson["ID"].get<uint32_t>()];
+				if (!registry.has<Relationship>(entity)) continue;
+				oldParents[entity] = (uint32_t)registry.read<Relationship>(entity).parent;
+				Hierarchy::Detach(registry, entity);
+			}
 
-				// 親IDの解決
-				if (rel.parent != NullEntity) {
-					uint32_t oldParentID = (uint32_t)rel.parent;
-					if (idMap.count(oldParentID)) rel.parent = idMap[oldParentID];
-					else rel.parent = NullEntity;
+			for (auto& entityJson : sceneJson["Entities"]) {
+				uint32_t oldID = entityJson["ID"].get<uint32_t>();
+				if (!entityJson.contains("Relationship") || !entityJson["Relationship"].contains("children")) continue;
+				for (auto& childJson : entityJson["Relationship"]["children"]) {
+					auto child = idMap.find(childJson.get<uint32_t>());
+					if (child == idMap.end() || !oldParents.count(child->second)) continue;
+					if (oldParents[child->second] == oldID) Hierarchy::SetParent(registry, child->second, idMap[oldID]);
 				}
+			}
 
-				// 子IDリストの解決
-				std::vector<Entity> newChildren;
-				for (auto oldChildID : rel.children) {
-					uint32_t oldID = (uint32_t)oldChildID;
-					if (idMap.count(oldID)) newChildren.push_back(idMap[oldID]);
+			// 子の並びに載っていなかったもの（parent だけ持つもの）
+			for (auto& entityJson : sceneJson["Entities"]) {
+				Entity entity = idMap[entityJson["ID"].get<uint32_t>()];
+				auto oldParent = oldParents.find(entity);
+				if (oldParent == oldParents.end() || oldParent->second == (uint32_t)NullEntity) continue;
+				auto parent = idMap.find(oldParent->second);
+				if (parent != idMap.end() && Hierarchy::GetParent(registry, entity) != parent->second) {
+					Hierarchy::SetParent(registry, entity, parent->second);
 				}
-				rel.children = newChildren;
 			}
 		}
 
+		// 親子関係が確定したので Active 状態を作り直す
+		registry.rebuildActiveHierarchy();
+
 		Logger::Log("Scene Loaded: " + filepath);
 	}
 
@@ -233,8 +275,11 @@ namespace Arche
 		// --- 復元処理 ---
 
 		// 1. 親子関係とPrefab情報のバックアップ
-		Entity parent = NullEntity;
-		if (reg.has<Relationship>(entity)) parent = reg.get<Relationship>(entity).parent;
+		Entity parent = Hierarchy::GetParent(reg, entity);
+		int siblingIndex = Hierarchy::GetChildIndex(reg, entity);
+
+		// 今の子を全削除（プレファブ構造に強制一致させるため、後で JSON から再生成する）
+		for (Entity child : Hierarchy::GetChildren(reg, entity)) Hierarchy::DestroyRecursive(reg, child);
 
 		// 2. コンポーネントを一度すべて削除（クリーンな状態にする）
 		// ComponentRegistryを使って全削除
@@ -247,16 +292,10 @@ namespace Arche
 		ComponentSerializer::DeserializeEntity(reg, entity, prefabJson[0]);
 
 		// 4. バックアップ情報の復元
-		// 親子関係
-		if (reg.has<Relationship>(entity))
-		{
-			reg.get<Relationship>(entity).parent = parent;
-		}
-		else if (parent != NullEntity)
-		{
-			auto& rel = reg.emplace<Relationship>(entity);
-			rel.parent = parent;
-		}
+		// 親子関係（読み込んだ parent はプレファブ保存時のものなので捨てる）
+		Hierarchy::Detach(reg, entity);
+		if (parent != NullEntity) Hierarchy::InsertChild(reg, parent, entity, siblingIndex);
+		reg.updateActiveHierarchy(entity);
 
 		// PrefabInstance (Deserializeで入っているはずだが念のためパスを保証)
 		if (!reg.has<PrefabInstance>(entity))
@@ -269,19 +308,6 @@ namespace Arche
 		}
 
 		// 5. 子階層の再構築 (プレファブ構造に強制一致させる)
-		// まず今の子を全削除
-		std::function<void(Entity)> deleteChildren = [&](Entity e) {
-			if (reg.has<Relationship>(e)) {
-				auto children = reg.get<Relationship>(e).children;
-				for (auto c : children) {
-					deleteChildren(c);
-					reg.destroy(c);
-				}
-				reg.get<Relationship>(e).children.clear();
-			}
-			};
-		deleteChildren(entity);
-
 		// JSONから子を再生成
 		ReconstructPrefabChildren(world, entity, prefabJson);
 
@@ -297,8 +323,8 @@ namespace Arche
 		// 標準システム
 		struct SysDef { std::string name; SystemGroup group; };
 		std::vector<SysDef> standardSystems = {
-			{ "Physics System", SystemGroup::PlayOnly },
-			{ "Collision System", SystemGroup::PlayOnly }, { "UI System", SystemGroup::Always },
+			{ "Physics System", SystemGroup::FixedUpdate },
+			{ "Collision System", SystemGroup::FixedUpdate }, { "UI System", SystemGroup::Always },
 			{ "Lifetime System", SystemGroup::PlayOnly }, { "Hierarchy System", SystemGroup::Always },
 			{"Animation System", SystemGroup::PlayOnly },
 			{ "Render System", SystemGroup::Always }, { "Model Render System", SystemGroup::Always },
@@ -322,18 +348,7 @@ namespace Arche
 	// ====================================================================================
 	void SceneSerializer::DestroyEntityRecursive(World& world, Entity entity)
 	{
-		auto& reg = world.getRegistry();
-
-		if (reg.has<Relationship>(entity))
-		{
-			// コピーをとってから回す（削除中にイテレータが無効になるのを防ぐ）
-			auto children = reg.get<Relationship>(entity).children;
-			for (auto child : children)
-			{
-				DestroyEntityRecursive(world, child);
-			}
-		}
-		world.getRegistry().destroy(entity);
+		Hierarchy::DestroyRecursive(world.getRegistry(), entity);
 	}
 
 	// ====================================================================================
@@ -346,18 +361,11 @@ namespace Arche
 
 		// 2. 子要素を保存
 		outJson["Children"] = json::array();
-		if (reg.has<Relationship>(entity))
+		for (Entity child : Hierarchy::Children(reg, entity))
 		{
-			auto& rel = reg.get<Relationship>(entity);
-			for (auto child : rel.children)
-			{
-				if (reg.valid(child))
-				{
-					json childJson;
-					SerializeEntityRecursive(reg, child, childJson);
-					outJson["Children"].push_back(childJson);
-				}
-			}
+			json childJson;
+			SerializeEntityRecursive(reg, child, childJson);
+			outJson["Children"].push_back(childJson);
 		}
 	}
 
@@ -374,20 +382,14 @@ namespace Arche
 		// デフォルトでTagをつける
 		if (!reg.has<Tag>(child)) reg.emplace<Tag>(child, "Child");
 
-		// コンポーネント復元
+		// コンポーネント復元（保存時の parent は捨てる）
 		DeserializeEntityFromJson(reg, child, jsonNode);
+		Hierarchy::Detach(reg, child);
 
 		// 親子付け
 		if (parent != NullEntity)
 		{
-			if (!reg.has<Relationship>(child)) reg.emplace<Relationship>(child);
-			if (!reg.has<Relationship>(parent)) reg.emplace<Relationship>(parent);
-
-			auto& childRel = reg.get<Relationship>(child);
-			childRel.parent = parent;
-
-			auto& parentRel = reg.get<Relationship>(parent);
-			parentRel.children.push_back(child);
+			Hierarchy::SetParent(reg, child, parent);
 		}
 
 		// さらにその子要素を再帰的に生成
@@ -440,8 +442,9 @@ namespace Arche
 		// ルートエンティティ作成
 		Entity root = world.create_entity().id();
 
-		// コンポーネント復元
+		// コンポーネント復元（保存時の parent は捨てる）
 		DeserializeEntityFromJson(world.getRegistry(), root, *rootNode);
+		Hierarchy::Detach(world.getRegistry(), root);
 
 		// PrefabInstance コンポーネントを付与してリンク情報を残す
 		if (!world.getRegistry().has<PrefabInstance>(root))
@@ -536,26 +539,13 @@ namespace Arche
 			std::string backupName = "Entity";
 			if (reg.has<Tag>(entity)) backupName = reg.get<Tag>(entity).name.c_str();
 
-			Entity parent = NullEntity;
-			if (reg.has<Relationship>(entity)) parent = reg.get<Relationship>(entity).parent;
+			Entity parent = Hierarchy::GetParent(reg, entity);
+			int siblingIndex = Hierarchy::GetChildIndex(reg, entity);
 
 			// --- 2. 古い子要素をすべて削除 ---
-			if (reg.has<Relationship>(entity))
+			for (Entity child : Hierarchy::GetChildren(reg, entity))
 			{
-				std::function<void(Entity)> destroyRecursive = [&](Entity e) {
-					if (reg.has<Relationship>(e)) {
-						auto children = reg.get<Relationship>(e).children;
-						for (auto child : children) destroyRecursive(child);
-					}
-					world.getRegistry().destroy(e);
-					};
-
-				auto children = reg.get<Relationship>(entity).children; // コピー
-				for (auto child : children)
-				{
-					destroyRecursive(child);
-				}
-				reg.get<Relationship>(entity).children.clear();
+				Hierarchy::DestroyRecursive(reg, child);
 			}
 
 			// --- 3. 自身のコンポーネントをクリア ---
@@ -592,11 +582,11 @@ namespace Arche
 				reg.emplace<PrefabInstance>(entity, filepath);
 			}
 
-			// 親子関係
+			// 親子関係（読み込んだ parent はプレファブ保存時のものなので捨てる）
+			Hierarchy::Detach(reg, entity);
 			if (parent != NullEntity)
 			{
-				if (!reg.has<Relationship>(entity)) reg.emplace<Relationship>(entity);
-				reg.get<Relationship>(entity).parent = parent;
+				Hierarchy::InsertChild(reg, parent, entity, siblingIndex);
 			}
 
 			// --- 6. 子要素の再構築 ---
@@ -651,41 +641,22 @@ namespace Arche
 		}
 
 		// 親子関係の再構築
-		// rootとその子要素の関係のみを復元する
-		for (auto const& [oldID, newEntity] : idMap)
+		// rootとその子要素の関係のみを復元する（JSON の並び順で繋ぐ）
+		std::vector<std::pair<Entity, uint32_t>> oldParents;
+		for (size_t i = 1; i < prefabJson.size(); ++i)
 		{
-			if (reg.has<Relationship>(newEntity))
-			{
-				auto& rel = reg.get<Relationship>(newEntity);
-
-				// 親IDの解決
-				if (rel.parent != NullEntity)
-				{
-					uint32_t oldParentID = (uint32_t)rel.parent;
-					if (idMap.count(oldParentID))
-					{
-						rel.parent = idMap[oldParentID];
-					}
-					else
-					{
-						// マップにない親（プレファブ外）の場合はリンクを切るか、rootにする
-						// 基本的にプレファブ内の子はプレファブ内の親を持つはず
-						rel.parent = NullEntity;
-					}
-				}
+			Entity newEntity = idMap[prefabJson[i]["ID"].get<uint32_t>()];
+			if (!reg.has<Relationship>(newEntity)) continue;
+			oldParents.push_back({ newEntity, (uint32_t)reg.read<Relationship>(newEntity).parent });
+			Hierarchy::Detach(reg, newEntity);
+		}
 
-				// 子IDリストの解決
-				std::vector<Entity> newChildren;
-				for (auto oldChildID : rel.children)
-				{
-					uint32_t oldCID = (uint32_t)oldChildID;
-					if (idMap.count(oldCID))
-					{
-						newChildren.push_back(idMap[oldCID]);
-					}
-				}
-				rel.children = newChildren;
-			}
+		for (auto const& [newEntity, oldParentID] : oldParents)
+		{
+			// マップにない親（プレファブ外）の場合はルートのままにする
+			// 基本的にプレファブ内の子はプレファブ内の親を持つはず
+			auto parent = idMap.find(oldParentID);
+			if (parent != idMap.end()) Hierarchy::SetParent(reg, newEntity, parent->second);
 		}
 	}
 
@@ -784,16 +755,13 @@ namespace Arche
 		SerializeEntityRecursive(reg, entity, entityJson);
 
 		// 2. 親を取得
-		Entity parent = NullEntity;
-		if (reg.has<Relationship>(entity))
-		{
-			parent = reg.get<Relationship>(entity).parent;
-		}
+		Entity parent = Hierarchy::GetParent(reg, entity);
 
 		// 3. 復元 (複製)
-		// ルートエンティティを作成
+		// ルートエンティティを作成（保存時の parent は捨てる）
 		Entity newEntity = world.create_entity().id();
 		DeserializeEntityFromJson(reg, newEntity, entityJson);
+		Hierarchy::Detach(reg, newEntity);
 
 		// 名前を変更 (Unity風に "Name (Copy)" とする)
 		if (reg.has<Tag>(newEntity))
@@ -806,15 +774,7 @@ namespace Arche
 		// 親子付け
 		if (parent != NullEntity)
 		{
-			// 自分のRelationship
-			if (!reg.has<Relationship>(newEntity)) reg.emplace<Relationship>(newEntity);
-			reg.get<Relationship>(newEntity).parent = parent;
-
-			// 親のRelationship
-			if (reg.has<Relationship>(parent))
-			{
-				reg.get<Relationship>(parent).children.push_back(newEntity);
-			}
+			Hierarchy::SetParent(reg, newEntity, parent);
 		}
 
 		// 子要素の再構築 (再帰処理)
@@ -44,7 +44,7 @@ namespace Arche
 			XMFLOAT3 listenerPos = { 0, 0, 0 };
 			bool listenerFound = false;
 
-			registry.view<AudioListener, Transform>().each([&](Entity e, AudioListener& l, Transform& t)
+			registry.view<const AudioListener, const Transform>().each([&](Entity e, const AudioListener& l, const Transform& t)
 				{
 					if (!listenerFound)
 					{
@@ -58,7 +58,7 @@ namespace Arche
 			if (!listenerFound) return;
 
 			// 2. 音源の更新
-			registry.view<AudioSource, Transform>().each([&](Entity e, AudioSource& source, Transform& t)
+			registry.view<AudioSource, const Transform>().each([&](Entity e, AudioSource& source, const Transform& t)
 				{
 					// --- 再生制御ロジック ---
 					if (source.playOnAwake && !source.isPlaying)
@@ -43,7 +43,7 @@ namespace Arche
 			XMMATRIX viewMatrix = XMMatrixIdentity();
 			XMMATRIX projMatrix = XMMatrixIdentity();
 			bool cameraFound = false;
-			registry.view<Camera, Transform>().each([&](Entity e, Camera& cam, Transform& trans)
+			registry.view<const Camera, const Transform>().each([&](Entity e, const Camera& cam, const Transform& trans)
 				{
 					if (cameraFound) return;
 					XMVECTOR eye = XMLoadFloat3(&trans.position);
@@ -59,7 +59,7 @@ namespace Arche
 			// 描画開始
 			BillboardRenderer::Begin(viewMatrix, projMatrix);
 
-				registry.view<Transform, BillboardComponent>().each([&](Entity e, Transform& t, BillboardComponent& b)
+				registry.view<const Transform, const BillboardComponent>().each([&](Entity e, const Transform& t, const BillboardComponent& b)
 					{
 						auto tex = ResourceManager::Instance().GetTexture(b.textureKey);
 						if (tex)
@@ -39,7 +39,7 @@ namespace Arche
 			if (!m_isShadowInit)
 			{
 				// 解像度は高めに設定 (2048 or 4096)
-				m_shadowMap.Initialize(Application::Instance().GetDevice(), 2048, 2048);
+				m_shadowMap.Initialize(RenderBackend::GetDevice(), 2048, 2048);
 				m_isShadowInit = true;
 			}
 
@@ -62,19 +62,22 @@ namespace Arche
 			}
 			else
 			{
-				registry.view<Camera, Transform>().each([&](Entity e, Camera& cam, Transform& trans)
-					{
-						if (cameraFound) return;
-
-						eye = XMLoadFloat3(&trans.position);
-						XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(trans.rotation.x, trans.rotation.y, 0.0f);
-						XMVECTOR lookDir = XMVector3TransformCoord(XMVectorSet(0, 0, 1, 0), rotationMatrix);
-						XMVECTOR upDir = XMVector3TransformCoord(XMVectorSet(0, 1, 0, 0), rotationMatrix);
-
-						viewMatrix = XMMatrixLookToLH(eye, lookDir, upDir);
-						projMatrix = XMMatrixPerspectiveFovLH(cam.fov, cam.aspect, cam.nearZ, cam.farZ);
-						cameraFound = true;
-					});
+				// メインカメラ（唯一コンポーネント）
+				Entity camera = registry.unique<Camera>();
+				if (camera != NullEntity && registry.isActive(camera) && registry.has<Transform>(camera))
+				{
+					const Camera& cam = registry.read<Camera>(camera);
+					const Transform& trans = registry.read<Transform>(camera);
+
+					eye = XMLoadFloat3(&trans.position);
+					XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(trans.rotation.x, trans.rotation.y, 0.0f);
+					XMVECTOR lookDir = XMVector3TransformCoord(XMVectorSet(0, 0, 1, 0), rotationMatrix);
+					XMVECTOR upDir = XMVector3TransformCoord(XMVectorSet(0, 1, 0, 0), rotationMatrix);
+
+					viewMatrix = XMMatrixLookToLH(eye, lookDir, upDir);
+					projMatrix = XMMatrixPerspectiveFovLH(cam.fov, cam.aspect, cam.nearZ, cam.farZ);
+					cameraFound = true;
+				}
 			}
 
 			if (!cameraFound) return;
@@ -84,7 +87,7 @@ namespace Arche
 			// ---------------------------------------------------------
 			std::vector<ModelRenderer::PointLightData> pointLights;
 
-			registry.view<Transform, PointLight>().each([&](Entity e, Transform& t, PointLight& l) {
+			registry.view<const Transform, const PointLight>().each([&](Entity e, const Transform& t, const PointLight& l) {
 				ModelRenderer::PointLightData data;
 				data.position = t.position;
 				data.range = l.range;
@@ -103,16 +106,16 @@ namespace Arche
 			// ---------------------------------------------------------
 			// 3. 影生成パス (Shadow Pass)
 			// ---------------------------------------------------------
-			ID3D11DeviceContext* devContext = Application::Instance().GetContext();
+			IRenderBackend* backend = &RenderBackend::Get();
 
 			// 現在のレンダリングターゲットとビューポートを保存
 			ID3D11RenderTargetView* prevRTV = nullptr;
 			ID3D11DepthStencilView* prevDSV = nullptr;
-			devContext->OMGetRenderTargets(1, &prevRTV, &prevDSV);
+			backend->OMGetRenderTargets(1, &prevRTV, &prevDSV);
 
 			D3D11_VIEWPORT prevVP;
 			UINT numVP = 1;
-			devContext->RSGetViewports(&numVP, &prevVP);
+			backend->RSGetViewports(&numVP, &prevVP);
 
 			// A. ライト行列計算
 			XMVECTOR vLightDir = XMLoadFloat3(&lightDir);
@@ -125,13 +128,18 @@ namespace Arche
 
 			// 影描画を始める前に、読み込みスロット(t1)から影マップを外す
 			ID3D11ShaderResourceView* nullSRV = nullptr;
-			devContext->PSSetShaderResources(1, 1, &nullSRV);
+			backend->PSSetShaderResources(1, 1, &nullSRV);
+
+			// 同じモデルが連続するように並べる（前フレームからほぼ整列済みなので挿入ソートで軽い）
+			// ※ Transform は読むだけなので const で参照する（変更扱いにすると次のフレームで階層・衝突の再計算を招く）
+			auto meshes = registry.group<MeshComponent>(With<const Transform>{});
+			meshes.sort([](const MeshComponent& a, const MeshComponent& b) { return a.modelKey < b.modelKey; });
 
 			// B. 影マップへ描画
-			m_shadowMap.Begin(devContext);
+			m_shadowMap.Begin(backend);
 			ShadowRenderer::Begin(lightView, lightProj);
 
-			registry.view<MeshComponent, Transform>().each([&](Entity e, MeshComponent& m, Transform& t)
+			meshes.each([&](Entity e, MeshComponent& m, const Transform& t)
 				{
 					if (!m.pModel && !m.modelKey.empty()) m.pModel = ResourceManager::Instance().GetModel(m.modelKey);
 					if (m.pModel)
@@ -143,11 +151,11 @@ namespace Arche
 					}
 				});
 
-			m_shadowMap.End(devContext);
+			m_shadowMap.End(backend);
 
 			// ビューポート復元
-			devContext->OMSetRenderTargets(1, &prevRTV, prevDSV);
-			devContext->RSSetViewports(1, &prevVP);
+			backend->OMSetRenderTargets(1, &prevRTV, prevDSV);
+			backend->RSSetViewports(1, &prevVP);
 
 			if (prevRTV) prevRTV->Release();
 			if (prevDSV) prevDSV->Release();
@@ -164,7 +172,7 @@ namespace Arche
 			ModelRenderer::Begin(viewMatrix, projMatrix, lightDir, { 1, 1, 1 });
 
 			// MeshComponentとTransformを持つEntityを描画
-			registry.view<MeshComponent, Transform>().each([&](Entity e, MeshComponent& m, Transform& t)
+			meshes.each([&](Entity e, MeshComponent& m, const Transform& t)
 				{
 					// ロード処理（ShadowPassでロード済みならキャッシュされているはず）
 					if (m.modelKey != m.loadedKey)
@@ -50,25 +50,28 @@ namespace Arche
 		}
 		else
 		{
-			registry.view<Camera, Transform>().each([&](Entity e, Camera& cam, Transform& trans)
-				{
-					if (cameraFound) return;
-
-					savedRotation = trans.rotation;
-
-					eye = XMLoadFloat3(&trans.position);
-					// 回転行列を作成 (Pitch: X軸回転, Yaw: Y軸回転)
-					XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(trans.rotation.x, trans.rotation.y, 0.0f);
-					// 前方ベクトル (0, 0, 1) を回転させる
-					XMVECTOR lookDir = XMVector3TransformCoord(XMVectorSet(0, 0, 1, 0), rotationMatrix);
-					// 上方向ベクトル (0, 1, 0) を回転させる
-					XMVECTOR upDir = XMVector3TransformCoord(XMVectorSet(0, 1, 0, 0), rotationMatrix);
-
-					// LookToLH: 位置、向き、上でビュー行列を作る
-					viewMatrix = XMMatrixLookToLH(eye, lookDir, upDir);
-					projMatrix = XMMatrixPerspectiveFovLH(cam.fov, cam.aspect, cam.nearZ, cam.farZ);
-					cameraFound = true;
-				});
+			// メインカメラ（唯一コンポーネント）
+			Entity camera = registry.unique<Camera>();
+			if (camera != NullEntity && registry.isActive(camera) && registry.has<Transform>(camera))
+			{
+				const Camera& cam = registry.read<Camera>(camera);
+				const Transform& trans = registry.read<Transform>(camera);
+
+				savedRotation = trans.rotation;
+
+				eye = XMLoadFloat3(&trans.position);
+				// 回転行列を作成 (Pitch: X軸回転, Yaw: Y軸回転)
+				XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(trans.rotation.x, trans.rotation.y, 0.0f);
+				// 前方ベクトル (0, 0, 1) を回転させる
+				XMVECTOR lookDir = XMVector3TransformCoord(XMVectorSet(0, 0, 1, 0), rotationMatrix);
+				// 上方向ベクトル (0, 1, 0) を回転させる
+				XMVECTOR upDir = XMVector3TransformCoord(XMVectorSet(0, 1, 0, 0), rotationMatrix);
+
+				// LookToLH: 位置、向き、上でビュー行列を作る
+				viewMatrix = XMMatrixLookToLH(eye, lookDir, upDir);
+				projMatrix = XMMatrixPerspectiveFovLH(cam.fov, cam.aspect, cam.nearZ, cam.farZ);
+				cameraFound = true;
+			}
 		}
 
 		// スカイボックスのテクスチャロード管理
@@ -114,12 +117,12 @@ namespace Arche
 			// ※PrimitiveRenderer::Draw** の第5引数(wireframe)に設定を渡すことで制御します
 			bool isWire = context.debugSettings.wireframeMode;
 
-			registry.view<Transform, Collider>().each([&](Entity e, Transform& t, Collider& c)
+			registry.view<const Transform, const Collider>().each([&](Entity e, const Transform& t, const Collider& c)
 				{
 					XMFLOAT4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
 					if (registry.has<Tag>(e))
 					{
-						std::string name = registry.get<Tag>(e).tag.c_str();
+						std::string name = registry.read<Tag>(e).tag.c_str();
 						if (name == "Player") color = { 0.0f, 1.0f, 0.0f, 1.0f };
 						if (name == "Enemy") color = { 1.0f, 0.0f, 0.0f, 1.0f };
 					}
@@ -163,7 +166,7 @@ namespace Arche
 					}
 				});
 
-			registry.view<Transform, PointLight>().each([&](Entity e, Transform& t, PointLight& l) {
+			registry.view<const Transform, const PointLight>().each([&](Entity e, const Transform& t, const PointLight& l) {
 				// 光源の中心
 				XMFLOAT4 iconColor = { 1.0f, 1.0f, 0.3f, 1.0f };
 				PrimitiveRenderer::DrawSphere(t.position, 0.2f, iconColor, false); // 中心は常にソリッド
@@ -194,7 +197,7 @@ namespace Arche
 					);
 				}
 			}
-			PrimitiveRenderer::GetDeviceContext()->OMSetBlendState(nullptr, nullptr, 0xffffffff);
+			PrimitiveRenderer::GetBackend()->OMSetBlendState(nullptr, nullptr, 0xffffffff);
 		}
 
 		// ------------------------------------------------------------
@@ -204,7 +207,7 @@ namespace Arche
 		{
 			UINT numViewports = 1;
 			D3D11_VIEWPORT oldViewport;
-			PrimitiveRenderer::GetDeviceContext()->RSGetViewports(&numViewports, &oldViewport);
+			PrimitiveRenderer::GetBackend()->RSGetViewports(&numViewports, &oldViewport);
 
 			float gizmoSize = 100.0f;
 			float padding = 20.0f;
@@ -217,7 +220,7 @@ namespace Arche
 			gizmoViewport.TopLeftX = oldViewport.Width - gizmoSize - padding;
 			gizmoViewport.TopLeftY = padding;
 
-			PrimitiveRenderer::GetDeviceContext()->RSSetViewports(1, &gizmoViewport);
+			PrimitiveRenderer::GetBackend()->RSSetViewports(1, &gizmoViewport);
 
 			XMMATRIX gizmoRotMatrix = XMMatrixRotationRollPitchYaw(savedRotation.x, savedRotation.y, 0.0f);
 			XMVECTOR offset = XMVector3TransformCoord(XMVectorSet(0, 0, -5.0f, 0), gizmoRotMatrix);
@@ -240,7 +243,7 @@ namespace Arche
 			PrimitiveRenderer::DrawBox(XMFLOAT3(0, 0, 0), XMFLOAT3(0.7f, 0.7f, 0.7f), XMFLOAT4(0, 0, 0, 0), XMFLOAT4(0.8f, 0.8f, 0.8f, 1), false);
 
 			// ビューポートを元に戻す
-			PrimitiveRenderer::GetDeviceContext()->RSSetViewports(1, &oldViewport);
+			PrimitiveRenderer::GetBackend()->RSSetViewports(1, &oldViewport);
 		}
 	}
 
@@ -43,7 +43,7 @@ namespace Arche
 			// 2D描画開始
 			SpriteRenderer::Begin();
 
-			registry.view<SpriteComponent, Transform2D>().each([&](Entity e, SpriteComponent& s, Transform2D& t2d)
+			registry.view<const SpriteComponent, const Transform2D>().each([&](Entity e, const SpriteComponent& s, const Transform2D& t2d)
 			{
 				// テクスチャ取得
 				auto tex = ResourceManager::Instance().GetTexture(s.textureKey);
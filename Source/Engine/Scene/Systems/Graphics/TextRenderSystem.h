@@ -58,11 +58,11 @@ namespace Arche
 			else
 			{
 				// ゲームビュー（通常時）
-				auto cameraView = registry.view<Camera, Transform>();
+				auto cameraView = registry.view<const Camera, const Transform>();
 				for (auto e : cameraView)
 				{
-					auto& cam = cameraView.get<Camera>(e);
-					auto& t = cameraView.get<Transform>(e);
+					auto& cam = cameraView.get<const Camera>(e);
+					auto& t = cameraView.get<const Transform>(e);
 
 					// RenderSystem.cppの実装に合わせる
 					XMVECTOR eye = XMLoadFloat3(&t.position);
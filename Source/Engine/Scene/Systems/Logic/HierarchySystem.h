@@ -9,6 +9,7 @@
  // ===== インクルード =====
 #include "Engine/Scene/Core/ECS/ECS.h"
 #include "Engine/Scene/Components/Components.h"
+#include "Engine/Core/Job/JobSystem.h"
 #include <functional>
 #include <algorithm> // max等のために必要
 #include <DirectXMath.h>
@@ -25,18 +26,51 @@ namespace Arche
 
 		void Update(Registry& registry) override
 		{
+			// --- 事前準備（構造変更はジョブの外で済ませる） ---
+			// ジョブ内でプールが作られないよう先に確保する
+			registry.getPool<Transform>();
+			registry.getPool<Relationship>();
+			registry.getPool<Collider>();
+			registry.getPool<WorldCollider>();
+
+			// WorldCollider が無いコライダーに追加しておく
+			m_missingColliders.clear();
+			auto colliderView = registry.view<Transform, Collider>();
+			colliderView.exclude<WorldCollider>();
+			for (auto e : colliderView) m_missingColliders.push_back(e);
+			for (auto e : m_missingColliders) registry.emplace<WorldCollider>(e);
+
+			// 前回の計算以降に変わったかの判定用
+			// ※ 非Activeで走査されなかった間の変更も拾えるよう、エンティティごとに計算したティックを持つ
+			auto& transforms = registry.getPool<Transform>();
+			auto& relationships = registry.getPool<Relationship>();
+			auto& worldColliders = registry.getPool<WorldCollider>();
+			std::size_t capacity = 0;
+			for (Entity e : transforms.getEntities()) capacity = (std::max)(capacity, (std::size_t)EntityTraits::toIndex(e) + 1);
+			if (m_computedTick.size() < capacity) m_computedTick.resize(capacity, 0);
+
 			// ワールド行列とワールドコライダーを更新する再帰関数
-			std::function<void(Entity, const XMMATRIX&)> updateEntity =
-				[&](Entity entity, const XMMATRIX& parentMatrix)
+			// ※ 自分・親・親子関係のどれも変わっていなければ、保存済みの行列をそのまま子へ渡す
+			std::function<void(Entity, const XMMATRIX&, bool)> updateEntity =
+				[&](Entity entity, const XMMATRIX& parentMatrix, bool parentDirty)
 				{
-					if (registry.has<Transform>(entity)) {
+					if (!transforms.has(entity)) return;
+
+					Tick& computed = m_computedTick[EntityTraits::toIndex(entity)];
+					const bool dirty = parentDirty
+						|| isNewerTick(transforms.changedTick(entity), computed)
+						|| (relationships.has(entity) && isNewerTick(relationships.changedTick(entity), computed))
+						|| (worldColliders.has(entity) && isNewerTick(worldColliders.addedTick(entity), computed));
+
+					XMMATRIX worldMat;
+					if (dirty) {
 						auto& t = registry.get<Transform>(entity);
 
 						// 1. ローカル行列作成 (Scale * Rotation * Translation)
 						XMMATRIX localMat = t.GetLocalMatrix();
 
 						// 2. 親行列を掛けてワールド行列作成
-						XMMATRIX worldMat = localMat * parentMatrix;
+						worldMat = localMat * parentMatrix;
 
 						// 3. 結果を保存
 						XMStoreFloat4x4(&t.worldMatrix, worldMat);
@@ -46,33 +80,51 @@ namespace Arche
 							UpdateWorldCollider(registry, entity, worldMat);
 						}
 
-						// 4. 子へ伝播
-						if (registry.has<Relationship>(entity)) {
-							for (Entity child : registry.get<Relationship>(entity).children) {
-								// 子エンティティが無効でないか確認
-								if (registry.valid(child)) {
-									updateEntity(child, worldMat);
-								}
+						// 自分の書き込みで次回 dirty にならないよう、書き込み後のティックを控える
+						computed = transforms.changedTick(entity);
+					}
+					else {
+						worldMat = XMLoadFloat4x4(&registry.read<Transform>(entity).worldMatrix);
+					}
+
+					// 4. 子へ伝播
+					if (relationships.has(entity)) {
+						for (Entity child = relationships.get(entity).firstChild; child != NullEntity; child = relationships.get(child).nextSibling) {
+							// 子エンティティが無効でないか確認
+							if (registry.valid(child)) {
+								updateEntity(child, worldMat, dirty);
 							}
 						}
 					}
 				};
 
-			// --- ルート（親なし）から更新開始 ---
-			auto view = registry.view<Transform>();
+			// --- ルート（親なし）を集める ---
+			m_roots.clear();
+			auto view = registry.view<const Transform>();
 			for (auto e : view) {
 				bool isRoot = true;
 				// Relationshipを持っていて、かつ親が存在する場合はルートではない
-				if (registry.has<Relationship>(e)) {
-					if (registry.valid(registry.get<Relationship>(e).parent)) {
+				if (relationships.has(e)) {
+					if (registry.valid(relationships.get(e).parent)) {
 						isRoot = false;
 					}
 				}
 
 				if (isRoot) {
-					updateEntity(e, XMMatrixIdentity());
+					m_roots.push_back(e);
 				}
 			}
+
+			// --- ルートごとに部分木を並列更新 ---
+			// ※ 部分木同士は重ならないので、各ジョブは自分の部分木のコンポーネントだけを書き換える
+			// ※ 変更ティックはこのシステムの実行ティックで記録する
+			const SystemTicks ticks = ChangeTicks::Current();
+			JobSystem::ParallelFor(m_roots.size(), RootsPerJob, [&](std::size_t begin, std::size_t end) {
+				TickScope scope(ticks);
+				for (std::size_t i = begin; i < end; ++i) {
+					updateEntity(m_roots[i], XMMatrixIdentity(), false);
+				}
+			});
 		}
 
 	private:
@@ -84,9 +136,8 @@ namespace Arche
 			XMVECTOR worldPosVec = worldMat.r[3];
 
 			// 2. 物理システムが参照している WorldCollider キャッシュを直接更新
-			if (!reg.has<WorldCollider>(e)) {
-				reg.emplace<WorldCollider>(e);
-			}
+			// ※ 追加は Update の事前準備で行う（非Activeで漏れたものは次フレームで追加される）
+			if (!reg.has<WorldCollider>(e)) return;
 			auto& worldCol = reg.get<WorldCollider>(e);
 
 			// 計算結果を直接キャッシュに叩き込む
@@ -108,6 +159,15 @@ namespace Arche
 			auto& col = reg.get<Collider>(e);
 			XMStoreFloat3(&col.offset, worldPosVec);
 		}
+
+	private:
+		// 1ジョブあたりのルート数
+		static constexpr std::size_t RootsPerJob = 16;
+
+		std::vector<Entity> m_roots;
+		std::vector<Entity> m_missingColliders;
+		// エンティティごとに最後にワールド行列を計算したティック（インデックス部で引く）
+		std::vector<Tick> m_computedTick;
 	};
 
 }	// namespace Arche
@@ -41,23 +41,17 @@ namespace Arche
 		{
 			float dt = Time::DeltaTime();
 
-			// 削除リスト
-			std::vector<Entity> toDestroy;
+			// 削除は CommandBuffer に積み、Tick の同期点でまとめて行う
+			CommandBuffer& commands = registry.commands();
 
 			registry.view<Lifetime>().each([&](Entity e, Lifetime& life)
 				{
 					life.time -= dt;
 					if (life.time <= 0.0f)
 					{
-						toDestroy.push_back(e);
+						commands.destroy(e);
 					}
 				});
-
-			// まとめて削除
-			for (Entity e : toDestroy)
-			{
-				registry.destroy(e);
-			}
 		}
 	};
 
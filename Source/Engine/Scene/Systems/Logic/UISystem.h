@@ -24,6 +24,7 @@
 #include "Engine/pch.h"
 #include "Engine/Scene/Core/ECS/ECS.h"
 #include "Engine/Scene/Components/Components.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 
 namespace Arche
 {
@@ -126,7 +127,7 @@ namespace Arche
 
 						D2D1_RECT_F myLocalRect = { myL, myT, myR, myB };
 
-						for (Entity child : registry.get<Relationship>(entity).children)
+						for (Entity child : Hierarchy::Children(registry, entity))
 						{
 							updateNode(child, myLocalRect, t.worldMatrix);
 						}
@@ -23,6 +23,7 @@
 #include "Engine/Physics/PhysicsEvents.h"
 #include "Engine/Physics/SpatialHash.h"
 #include "Engine/Core/Time/Time.h"
+#include "Engine/Core/Profiler/Profiler.h"
 
 namespace Arche
 {
@@ -440,7 +441,7 @@ namespace Arche
 		XMVECTOR originV = XMLoadFloat3(&rayOrigin);
 		XMVECTOR dirV = XMLoadFloat3(&rayDir);
 
-		registry.view<Transform, Collider>().each([&](Entity e, Transform& t, Collider& c)
+		registry.view<const Transform, const Collider>().each([&](Entity e, const Transform& t, const Collider& c)
 			{
 				// ワールド行列の分解
 				XMVECTOR scale, rotQuat, pos;
@@ -1155,7 +1156,7 @@ namespace Arche
 			.where<Transform, Collider>();
 
 		// 2. 初期化
-		registry.view<Transform, Collider>().each([&](Entity e, Transform& t, Collider& c) {
+		registry.view<const Transform, const Collider>().each([&](Entity e, const Transform& t, const Collider& c) {
 			if (!registry.has<WorldCollider>(e)) {
 				registry.emplace<WorldCollider>(e);
 			}
@@ -1277,7 +1278,7 @@ namespace Arche
 		// ----------------------------------------------------------------------
 		if (registry.has<Rigidbody>(e))
 		{
-			const auto& rb = registry.get<Rigidbody>(e);
+			const auto& rb = registry.read<Rigidbody>(e);
 			if (rb.type == BodyType::Dynamic)
 			{
 				XMVECTOR vel = XMLoadFloat3(&rb.velocity);
@@ -1301,11 +1302,13 @@ namespace Arche
 
 	void CollisionSystem::Update(Registry& registry)
 	{
+		ARCHE_PROFILE_FUNCTION();
 		if (!m_isInitialized) Initialize(registry);
 
 		// 1. イベントマネージャーの初期化
+		// ※ FixedUpdate で動く場合、同じフレームの2ステップ目以降は積み足す（通常の更新で1度に処理させる）
 		auto& eventMgr = EventManager::Instance();
-		eventMgr.Clear();
+		if (Time::FixedStepIndex() <= 0) eventMgr.Clear();
 
 		// 2. 空間ハッシュのリセット
 		g_spatialHash.Clear();
@@ -1318,8 +1321,9 @@ namespace Arche
 					registry.emplace<WorldCollider>(e);
 				}
 
-				auto& t = registry.get<Transform>(e);
-				auto& c = registry.get<Collider>(e);
+				// Transform / Collider は読むだけ（書き込み扱いにすると毎フレーム変更として検知される）
+				const auto& t = registry.read<Transform>(e);
+				const auto& c = registry.read<Collider>(e);
 				auto& wc = registry.get<WorldCollider>(e);
 
 				UpdateWorldCollider(registry, e, t, c, wc);
@@ -1330,7 +1334,7 @@ namespace Arche
 		m_observer.clear();
 
 		// 4. 全エンティティを空間ハッシュに登録
-		registry.view<WorldCollider>().each([&](Entity e, WorldCollider& wc)
+		registry.view<const WorldCollider>().each([&](Entity e, const WorldCollider& wc)
 		{
 			g_spatialHash.Register(e, wc.aabb.min, wc.aabb.max);
 		});
@@ -1339,7 +1343,9 @@ namespace Arche
 		std::vector<Contact> contactsForSolver;
 		std::map<EntityPair, Contact> currentContactsMap;
 
-		registry.view<Transform, Collider, WorldCollider>().each([&](Entity eA, Transform& tA, Collider& cA, WorldCollider& wcA)
+		// Collider / WorldCollider は Owning Group で連続走査（Transform は PhysicsSystem の Group が所有）
+		// ※ ここは読むだけなので false を返して変更ティックを記録しない（Observer が毎フレーム全件を拾わないように）
+		registry.group<Collider, WorldCollider>(With<const Transform>{}).each([&](Entity eA, const Collider& cA, const WorldCollider& wcA, const Transform& tA)
 		{
 			// 周辺エンティティのみ取得（高速化）
 			auto candidates = g_spatialHash.Query(wcA.aabb.min, wcA.aabb.max);
@@ -1349,17 +1355,17 @@ namespace Arche
 				if (eA >= eB) continue;	// 重複チェック（A-B と B-A は同じ）
 				if (!registry.valid(eB)) continue;
 
-				auto& cB = registry.get<Collider>(eB);
+				const auto& cB = registry.read<Collider>(eB);
 
 				// レイヤーマスク判定
 				if (!(cA.mask & cB.layer) || !(cB.mask & cA.layer)) continue;
 
 				// Static同士は判定しない
-				bool isStaticA = (!registry.has<Rigidbody>(eA) || registry.get<Rigidbody>(eA).type == BodyType::Static);
-				bool isStaticB = (!registry.has<Rigidbody>(eB) || registry.get<Rigidbody>(eB).type == BodyType::Static);
+				bool isStaticA = (!registry.has<Rigidbody>(eA) || registry.read<Rigidbody>(eA).type == BodyType::Static);
+				bool isStaticB = (!registry.has<Rigidbody>(eB) || registry.read<Rigidbody>(eB).type == BodyType::Static);
 				if (isStaticA && isStaticB) continue;
 
-				auto& wcB = registry.get<WorldCollider>(eB);
+				const auto& wcB = registry.read<WorldCollider>(eB);
 
 				// Broad Phase (AABB)
 				if (wcA.aabb.max.x < wcB.aabb.min.x || wcA.aabb.min.x > wcB.aabb.max.x ||
@@ -1374,7 +1380,7 @@ namespace Arche
 				contact.a = eA;
 				contact.b = eB;
 				bool hit = false;
-				auto& tB = registry.get<Transform>(eB);
+				const auto& tB = registry.read<Transform>(eB);
 
 				// Sphere vs ...
 				if (cA.type == ColliderType::Sphere)
@@ -1508,6 +1514,7 @@ namespace Arche
 					}
 				}
 			}
+			return false;
 		});
 
 		// 6. イベント発行（Enter / Stay / Exit）
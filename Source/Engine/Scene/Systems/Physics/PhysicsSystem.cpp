@@ -21,6 +21,7 @@
 // ===== インクルード =====
 #include "Engine/pch.h"
 #include "Engine/Scene/Systems/Physics/PhysicsSystem.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 
 namespace Arche
 {
@@ -45,10 +46,13 @@ namespace Arche
 			viewRB.get<Rigidbody>(entity).isGrounded = false;
 		}
 
-		registry.view<Transform, Rigidbody>().each([&](Entity e, Transform& t, Rigidbody& rb)
+		// Transform と Rigidbody を先頭に詰めて持つ Owning Group で連続走査する
+		// ※ 各エンティティは自分の Transform / Rigidbody しか触らないので並列に積分できる
+		// ※ false を返したもの（Static）は書き換えていないので、変更として記録しない
+		registry.group<Transform, Rigidbody>().par_each([&](Entity e, Transform& t, Rigidbody& rb)
 			{
 				// Staticは何もしない
-				if (rb.type == BodyType::Static) return;
+				if (rb.type == BodyType::Static) return false;
 
 				// KinematicとDynamicの共通処理
 				if (rb.type == BodyType::Dynamic)
@@ -78,7 +82,24 @@ namespace Arche
 					t.position = { 0, 10, 0 };
 					rb.velocity = { 0, 0, 0 };
 				}
+				return true;
+			});
+
+		// 衝突判定が読むワールド行列を、積分後の位置に合わせる
+		// ※ HierarchySystem は通常の更新でしか動かないため、同じフレームの2ステップ目以降は前の行列のままになる
+		// ※ 動く物の子孫も更新するので、親を持つ物が後になるよう深さ順に並べる
+		m_moved.clear();
+		registry.view<const Rigidbody>().each([&](Entity e, const Rigidbody& rb)
+			{
+				if (rb.type == BodyType::Static) return;
+				const uint32_t depth = registry.has<Relationship>(e) ? registry.read<Relationship>(e).depth : 0;
+				m_moved.emplace_back(depth, e);
 			});
+		std::sort(m_moved.begin(), m_moved.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+		for (const auto& [depth, e] : m_moved)
+		{
+			Hierarchy::UpdateWorldMatrices(registry, e);
+		}
 	}
 
 	// ============================================================
@@ -93,8 +114,6 @@ namespace Arche
 
 			auto& rbA = registry.get<Rigidbody>(contact.a);
 			auto& rbB = registry.get<Rigidbody>(contact.b);
-			auto& tA = registry.get<Transform>(contact.a);
-			auto& tB = registry.get<Transform>(contact.b);
 
 			bool fixedA = (rbA.type == BodyType::Static || rbA.type == BodyType::Kinematic);
 			bool fixedB = (rbB.type == BodyType::Static || rbB.type == BodyType::Kinematic);
@@ -102,6 +121,10 @@ namespace Arche
 			// 両方固定なら何もしない
 			if (fixedA && fixedB) continue;
 
+			// 固定側の Transform は書き換えないので、変更として記録しない
+			Transform* tA = fixedA ? nullptr : &registry.get<Transform>(contact.a);
+			Transform* tB = fixedB ? nullptr : &registry.get<Transform>(contact.b);
+
 			using namespace DirectX;
 			XMVECTOR n = XMLoadFloat3(&contact.normal); // A -> B の法線
 			float depth = contact.depth;
@@ -115,12 +138,12 @@ namespace Arche
 				float ratioA = rbB.mass / totalMass;
 				float ratioB = rbA.mass / totalMass;
 
-				XMVECTOR posA = XMLoadFloat3(&tA.position);
-				XMVECTOR posB = XMLoadFloat3(&tB.position);
+				XMVECTOR posA = XMLoadFloat3(&tA->position);
+				XMVECTOR posB = XMLoadFloat3(&tB->position);
 				posA -= n * (depth * ratioA);
 				posB += n * (depth * ratioB);
-				XMStoreFloat3(&tA.position, posA);
-				XMStoreFloat3(&tB.position, posB);
+				XMStoreFloat3(&tA->position, posA);
+				XMStoreFloat3(&tB->position, posB);
 
 				if (n.m128_f32[1] < -0.7f)
 				{
@@ -160,9 +183,9 @@ namespace Arche
 			// ---------------------------------------------------------
 			else if (!fixedA && fixedB) {
 				// 位置補正 (既存)
-				XMVECTOR posA = XMLoadFloat3(&tA.position);
+				XMVECTOR posA = XMLoadFloat3(&tA->position);
 				posA -= n * depth;
-				XMStoreFloat3(&tA.position, posA);
+				XMStoreFloat3(&tA->position, posA);
 
 				if (n.m128_f32[1] < -0.7f)
 				{
@@ -194,9 +217,9 @@ namespace Arche
 			// ---------------------------------------------------------
 			else if (fixedA && !fixedB) {
 				// 位置補正 (既存)
-				XMVECTOR posB = XMLoadFloat3(&tB.position);
+				XMVECTOR posB = XMLoadFloat3(&tB->position);
 				posB += n * depth;
-				XMStoreFloat3(&tB.position, posB);
+				XMStoreFloat3(&tB->position, posB);
 
 				if (n.m128_f32[1] > 0.7f)
 				{
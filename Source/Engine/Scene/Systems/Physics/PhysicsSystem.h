@@ -56,6 +56,10 @@ namespace Arche
 
 		// 衝突解決（CollisionSystemから呼ばれる）
 		static void Solve(Registry& registry, const std::vector<Physics::Contact>& contacts);
+
+	private:
+		// ワールド行列を計算し直す物（深さ, エンティティ）
+		std::vector<std::pair<uint32_t, Entity>> m_moved;
 	};
 
 }	// namespace Arche
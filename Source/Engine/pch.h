@@ -92,6 +92,9 @@
 #include <comdef.h>
 #include <future>
 #include <list>
+#include <bit>
+#include <atomic>
+#include <memory_resource>
 
 #include "Engine/Core/Core.h"
 
@@ -0,0 +1,326 @@
+﻿/*****************************************************************//**
+ * @file	CoreMain.cpp
+ * @brief	ヘッドレス実行（ECS / World だけ / エンジン本体に依存しない）
+ *
+ * @details
+ * 描画・リソース・ゲーム側のシステムを使わず、合成したシーンを World で N フレーム回して
+ * フレーム / システムごとの処理時間を標準出力に書き出す（ArcheHeadless と同じ集計）。
+ * エンジン本体に依存しないため、Windows以外でもビルドできる（CI でのスケジューラの回帰確認用）。
+ *
+ * ArcheHeadlessCore [--entities=N] [--frames=N] [--warmup=N] [--dt=秒] [--fixed-rate=Hz] [--json]
+ *   --entities=N	: 動かすエンティティ数（既定: 10000）
+ *   --frames=N		: 計測するフレーム数（既定: 600）
+ *   --warmup=N		: 計測前に回して捨てるフレーム数（既定: 60）
+ *   --dt=X			: 1フレームの経過時間（秒 / 既定: 1 / 60）
+ *   --fixed-rate=Hz	: 固定ステップの頻度（既定: 60）
+ *   --json			: JSON で出力する
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Core/Time/Time.h"
+#include "Engine/Core/Profiler/RollingHistogram.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+
+namespace
+{
+	using namespace Arche;
+
+	struct Options
+	{
+		int entities = 10000;
+		int frames = 600;
+		int warmup = 60;
+		float dt = 1.0f / 60.0f;
+		int fixedRate = 60;
+		bool json = false;
+	};
+
+	// ---- 合成シーンのコンポーネント ----
+	struct Position { float x = 0.0f, y = 0.0f, z = 0.0f; };
+	struct Velocity { float x = 0.0f, y = 0.0f, z = 0.0f; };
+	struct Lifetime { float remaining = 1.0f; };
+	struct Agent { uint32_t seed = 1; };
+
+	// 再現性のため、乱数はエンティティごとの種から作る
+	float NextRandom(uint32_t& seed)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		return (float)(seed >> 8) / (float)(1u << 24);
+	}
+
+	// ---- 合成シーンのシステム ----
+	// 固定ステップで位置を積分する（物理相当）
+	class IntegrateSystem : public ISystem
+	{
+	public:
+		IntegrateSystem()
+		{
+			m_systemName = "Integrate System";
+			m_group = SystemGroup::FixedUpdate;
+			m_access.write<Position, Velocity>();
+		}
+
+		void Update(Registry& registry) override
+		{
+			const float dt = Time::DeltaTime();
+			registry.view<Position, Velocity>().par_each([dt](Entity, Position& p, Velocity& v) {
+				v.y -= 9.81f * dt;
+				p.x += v.x * dt;
+				p.y += v.y * dt;
+				p.z += v.z * dt;
+
+				// 床で跳ね返す
+				if (p.y < 0.0f)
+				{
+					p.y = 0.0f;
+					v.y = -v.y * 0.8f;
+				}
+			});
+		}
+	};
+
+	// 向きを変える（AI 相当 / Lifetime とは別の型だけを書くので同じ段で並列に動く）
+	class SteeringSystem : public ISystem
+	{
+	public:
+		SteeringSystem()
+		{
+			m_systemName = "Steering System";
+			m_group = SystemGroup::PlayOnly;
+			m_access.write<Velocity, Agent>();
+		}
+
+		void Update(Registry& registry) override
+		{
+			registry.view<Velocity, Agent>().par_each([](Entity, Velocity& v, Agent& a) {
+				v.x += (NextRandom(a.seed) - 0.5f) * 0.1f;
+				v.z += (NextRandom(a.seed) - 0.5f) * 0.1f;
+			});
+		}
+	};
+
+	// 寿命が尽きたものを破棄し、同じ数を生成する（構造変更は CommandBuffer 経由）
+	class LifetimeSystem : public ISystem
+	{
+	public:
+		LifetimeSystem()
+		{
+			m_systemName = "Lifetime System";
+			m_group = SystemGroup::PlayOnly;
+			m_access.write<Lifetime>();
+		}
+
+		void Update(Registry& registry) override
+		{
+			const float dt = m_elapsedTime;
+			CommandBuffer& commands = registry.commands();
+			registry.view<Lifetime>().each([&](Entity e, Lifetime& l) {
+				l.remaining -= dt;
+				if (l.remaining > 0.0f) return;
+
+				commands.destroy(e);
+				Spawn(commands, (uint32_t)e + m_spawned++);
+			});
+		}
+
+		static void Spawn(CommandBuffer& commands, uint32_t seed)
+		{
+			seed = seed * 2654435761u + 1u;
+			Entity e = commands.create();
+			commands.emplace<Position>(e, Position{ NextRandom(seed) * 100.0f, NextRandom(seed) * 10.0f, NextRandom(seed) * 100.0f });
+			commands.emplace<Velocity>(e, Velocity{ NextRandom(seed) - 0.5f, NextRandom(seed) * 5.0f, NextRandom(seed) - 0.5f });
+			commands.emplace<Lifetime>(e, Lifetime{ 1.0f + NextRandom(seed) * 4.0f });
+			commands.emplace<Agent>(e, Agent{ seed });
+		}
+
+	private:
+		uint32_t m_spawned = 0;
+	};
+
+	// ---- 集計（ArcheHeadless と同じ項目） ----
+	struct SystemSample
+	{
+		SystemGroup group = SystemGroup::PlayOnly;
+		RollingHistogram hist;
+		double total = 0.0;
+		int runs = 0;
+	};
+
+	struct Report
+	{
+		RollingHistogram frame;
+		double frameTotal = 0.0;
+		uint64_t fixedSteps = 0;
+		std::map<std::string, SystemSample> systems;
+		std::size_t window = 0;
+		std::size_t entities = 0;
+	};
+
+	bool ParseOptions(int argc, char** argv, Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			if (std::strncmp(argv[i], "--entities=", 11) == 0) options.entities = std::max(std::atoi(argv[i] + 11), 0);
+			else if (std::strncmp(argv[i], "--frames=", 9) == 0) options.frames = std::max(std::atoi(argv[i] + 9), 1);
+			else if (std::strncmp(argv[i], "--warmup=", 9) == 0) options.warmup = std::max(std::atoi(argv[i] + 9), 0);
+			else if (std::strncmp(argv[i], "--dt=", 5) == 0) options.dt = std::max((float)std::atof(argv[i] + 5), 0.0f);
+			else if (std::strncmp(argv[i], "--fixed-rate=", 13) == 0) options.fixedRate = std::max(std::atoi(argv[i] + 13), 1);
+			else if (std::strcmp(argv[i], "--json") == 0) options.json = true;
+			else
+			{
+				std::cerr << "unknown option: " << argv[i] << "\n";
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const char* GetGroupName(SystemGroup group)
+	{
+		switch (group)
+		{
+		case SystemGroup::Always: return "Always";
+		case SystemGroup::PlayOnly: return "Play";
+		case SystemGroup::EditOnly: return "Edit";
+		case SystemGroup::Overlay: return "Overlay";
+		case SystemGroup::FixedUpdate: return "Fixed";
+		default: return "-";
+		}
+	}
+
+	void Accumulate(Report& report, World& world, float frameMs)
+	{
+		report.frame.Add(frameMs);
+		report.frameTotal += frameMs;
+		report.fixedSteps += (uint64_t)std::max(world.getLastFixedStepCount(), 0);
+
+		for (const auto& sys : world.getSystems())
+		{
+			if (!sys->m_isEnabled) continue;
+
+			auto it = report.systems.find(sys->m_systemName);
+			if (it == report.systems.end()) it = report.systems.emplace(sys->m_systemName, SystemSample{ sys->m_group, RollingHistogram(report.window) }).first;
+
+			SystemSample& sample = it->second;
+			sample.hist.Add((float)sys->m_lastExecutionTime);
+			sample.total += sys->m_lastExecutionTime;
+			if (sys->m_didRun) ++sample.runs;
+		}
+	}
+
+	void WriteText(std::ostream& os, const Options& options, const Report& report)
+	{
+		const double frames = (double)report.frame.Count();
+		char buffer[256];
+
+		os << "Frames  : " << report.frame.Count() << " (warmup " << options.warmup << ", dt " << options.dt * 1000.0f << " ms)\n";
+		os << "Entities: " << report.entities << "  Fixed steps: " << report.fixedSteps << "\n\n";
+
+		os << "[Time (ms)]\n";
+		snprintf(buffer, sizeof(buffer), "%-10s avg %8.3f  p50 %8.3f  p95 %8.3f  p99 %8.3f  max %8.3f\n",
+			"Frame", report.frameTotal / frames, report.frame.Percentile(0.50f), report.frame.Percentile(0.95f), report.frame.Percentile(0.99f), report.frame.Max());
+		os << buffer;
+
+		os << "\n[Systems (ms / frame)]\n";
+		for (const auto& [name, sample] : report.systems)
+		{
+			snprintf(buffer, sizeof(buffer), "%-32s %-7s runs %6d  avg %8.3f  p50 %8.3f  p95 %8.3f  p99 %8.3f  max %8.3f\n",
+				name.c_str(), GetGroupName(sample.group), sample.runs, sample.total / frames,
+				sample.hist.Percentile(0.50f), sample.hist.Percentile(0.95f), sample.hist.Percentile(0.99f), sample.hist.Max());
+			os << buffer;
+		}
+	}
+
+	// nlohmann::json を使わずに書く（エンジン本体の依存を持ち込まないため）
+	void WriteJson(std::ostream& os, const Options& options, const Report& report)
+	{
+		const double frames = (double)report.frame.Count();
+		auto timing = [&](const RollingHistogram& hist, double total)
+		{
+			char buffer[192];
+			snprintf(buffer, sizeof(buffer), "{ \"avg\": %.6f, \"p50\": %.6f, \"p95\": %.6f, \"p99\": %.6f, \"max\": %.6f }",
+				total / frames, hist.Percentile(0.50f), hist.Percentile(0.95f), hist.Percentile(0.99f), hist.Max());
+			return std::string(buffer);
+		};
+
+		os << "{\n";
+		os << "  \"frames\": " << report.frame.Count() << ",\n";
+		os << "  \"warmup\": " << options.warmup << ",\n";
+		os << "  \"dt\": " << options.dt << ",\n";
+		os << "  \"entities\": " << report.entities << ",\n";
+		os << "  \"fixedSteps\": " << report.fixedSteps << ",\n";
+		os << "  \"frame\": " << timing(report.frame, report.frameTotal) << ",\n";
+		os << "  \"systems\": [\n";
+		std::size_t i = 0;
+		for (const auto& [name, sample] : report.systems)
+		{
+			os << "    { \"name\": \"" << name << "\", \"group\": \"" << GetGroupName(sample.group) << "\", \"runs\": " << sample.runs
+				<< ", \"time\": " << timing(sample.hist, sample.total) << " }" << (++i < report.systems.size() ? ",\n" : "\n");
+		}
+		os << "  ]\n}\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace Arche;
+
+	Options options;
+	if (!ParseOptions(argc, argv, options)) return 1;
+
+	Time::Initialize();
+	Time::SetFixedRate(options.fixedRate);
+	JobSystem::Initialize();
+
+	// 1. 合成シーン（登録順 = 競合するシステム同士の実行順）
+	World world;
+	world.registerSystem<IntegrateSystem>();
+	world.registerSystem<SteeringSystem>();
+	world.registerSystem<LifetimeSystem>();
+
+	Registry& registry = world.getRegistry();
+	for (int i = 0; i < options.entities; ++i) LifetimeSystem::Spawn(registry.commands(), (uint32_t)i + 1);
+	registry.commands().playback(registry);
+
+	// 2. N フレーム回す（SceneManager の Play 状態と同じ順: 固定ステップ → 通常の更新）
+	Report report;
+	report.window = (std::size_t)options.frames;
+	report.frame.SetWindow(report.window);
+
+	using Clock = std::chrono::steady_clock;
+	for (int i = 0; i < options.warmup + options.frames; ++i)
+	{
+		const auto start = Clock::now();
+		Time::Advance(options.dt);
+
+		const int steps = Time::ConsumeFixedSteps();
+		for (int step = 0; step < steps; ++step)
+		{
+			Time::BeginFixedStep(step);
+			world.FixedTick(EditorState::Play);
+			Time::EndFixedStep();
+		}
+		world.Tick(EditorState::Play);
+		const auto end = Clock::now();
+
+		if (i < options.warmup) continue;
+		Accumulate(report, world, std::chrono::duration<float, std::milli>(end - start).count());
+	}
+	report.entities = registry.aliveCount();
+
+	// 3. 結果
+	if (options.json) WriteJson(std::cout, options, report);
+	else WriteText(std::cout, options, report);
+
+	JobSystem::Shutdown();
+	return 0;
+}
@@ -0,0 +1,420 @@
+﻿/*****************************************************************//**
+ * @file	main.cpp
+ * @brief	ヘッドレス実行（ウィンドウ無しでシーンを回して計測する）
+ *
+ * @details
+ * ウィンドウとスワップチェーンを作らず、描画は NullRenderBackend に流して数だけ数える。
+ * シーンを読み込んで Play 状態（Always + PlayOnly / FixedUpdate）で N フレーム回し、
+ * フレーム / システムごとの処理時間と描画コマンドの集計を標準出力に書き出す。
+ * 経過時間は実時間ではなく --dt で固定するので、同じシーンなら毎回同じだけ進む。
+ *
+ * ArcheHeadless [--scene=パス] [--frames=N] [--warmup=N] [--dt=秒] [--no-render] [--json]
+ *   --scene=X	: 読み込むシーン（既定: game_config.json の StartScene / 無ければ GameScene）
+ *   --frames=N	: 計測するフレーム数（既定: 600）
+ *   --warmup=N	: 計測前に回して捨てるフレーム数（既定: 60）
+ *   --dt=X		: 1フレームの経過時間（秒 / 既定: 1 / FRAME_RATE）
+ *   --no-render	: 描画パスを回さない（更新だけを計測する）
+ *   --json		: JSON で出力する
+ *
+ * ※ リソースの生成には WARP（無ければハードウェア）のデバイスを使う。描画コマンドは発行されない
+ *   --no-render ではデバイスを作らない（D3D11 が使えない環境でも更新だけは計測できる）
+ * ※ ゲームのシステム / コンポーネントは Sandbox.dll の読み込み時に登録される
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Engine/Config.h"
+#include "Engine/Core/Time/Time.h"
+#include "Engine/Core/Window/Input.h"
+#include "Engine/Core/Job/JobSystem.h"
+#include "Engine/Core/Profiler/Profiler.h"
+#include "Engine/Core/Profiler/FrameStats.h"
+#include "Engine/Resource/ResourceManager.h"
+#include "Engine/Resource/PrefabManager.h"
+#include "Engine/Audio/AudioManager.h"
+#include "Engine/Scene/Core/SceneManager.h"
+#include "Engine/Scene/Core/Hierarchy.h"
+#include "Engine/Scene/Serializer/SceneSerializer.h"
+#include "Engine/Scene/Serializer/ComponentRegistry.h"
+#include "Engine/Scene/Serializer/SystemRegistry.h"
+#include "Engine/Renderer/RHI/RenderBackend.h"
+#include "Engine/Renderer/Renderers/PrimitiveRenderer.h"
+#include "Engine/Renderer/Renderers/SpriteRenderer.h"
+#include "Engine/Renderer/Renderers/ModelRenderer.h"
+#include "Engine/Renderer/Renderers/BillboardRenderer.h"
+#include "Engine/Renderer/Renderers/ShadowRenderer.h"
+#include "Engine/Renderer/Text/TextRenderer.h"
+#include <cstring>
+
+namespace
+{
+	using namespace Arche;
+
+	struct Options
+	{
+		std::string scene;
+		int frames = 600;
+		int warmup = 60;
+		float dt = 1.0f / (float)Config::FRAME_RATE;
+		bool render = true;
+		bool json = false;
+	};
+
+	// システム1つ分の計測
+	struct SystemSample
+	{
+		SystemGroup group = SystemGroup::PlayOnly;
+		RollingHistogram hist;
+		double total = 0.0;
+		int runs = 0;	// 実行したフレーム数（実行間隔を空けるシステムは少なくなる）
+	};
+
+	// 全フレーム分の計測
+	struct Report
+	{
+		RollingHistogram frame;
+		RollingHistogram update;
+		RollingHistogram render;
+		double frameTotal = 0.0;
+		double updateTotal = 0.0;
+		double renderTotal = 0.0;
+		RenderStats renderTotalStats;
+		uint64_t fixedSteps = 0;
+		std::map<std::string, SystemSample> systems;
+		std::size_t window = 0;	// 計測するフレーム数
+		std::size_t entities = 0;
+	};
+
+	// 実行ファイル（EXE）のあるディレクトリ
+	std::filesystem::path GetExeDirectory()
+	{
+		char buffer[MAX_PATH];
+		GetModuleFileNameA(nullptr, buffer, MAX_PATH);
+		return std::filesystem::path(buffer).parent_path();
+	}
+
+	// 既定のシーン（Application::Run と同じ探し方）
+	std::string GetDefaultScene()
+	{
+		std::string startScene = "Resources/Game/Scenes/GameScene.json";
+
+		std::ifstream f("game_config.json");
+		if (!f) return startScene;
+
+		try
+		{
+			json config;
+			f >> config;
+			if (config.contains("StartScene")) startScene = config["StartScene"].get<std::string>();
+		}
+		catch (...)
+		{
+			std::cerr << "[Headless] Failed to load game_config.json" << std::endl;
+		}
+		return startScene;
+	}
+
+	bool ParseOptions(int argc, char** argv, Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			if (std::strncmp(argv[i], "--scene=", 8) == 0) options.scene = argv[i] + 8;
+			else if (std::strncmp(argv[i], "--frames=", 9) == 0) options.frames = std::max(std::atoi(argv[i] + 9), 1);
+			else if (std::strncmp(argv[i], "--warmup=", 9) == 0) options.warmup = std::max(std::atoi(argv[i] + 9), 0);
+			else if (std::strncmp(argv[i], "--dt=", 5) == 0) options.dt = std::max((float)std::atof(argv[i] + 5), 0.0f);
+			else if (std::strcmp(argv[i], "--no-render") == 0) options.render = false;
+			else if (std::strcmp(argv[i], "--json") == 0) options.json = true;
+			else
+			{
+				std::cerr << "unknown option: " << argv[i] << "\n";
+				return false;
+			}
+		}
+
+		if (options.scene.empty()) options.scene = GetDefaultScene();
+		return true;
+	}
+
+	const char* GetGroupName(SystemGroup group)
+	{
+		switch (group)
+		{
+		case SystemGroup::Always: return "Always";
+		case SystemGroup::PlayOnly: return "Play";
+		case SystemGroup::EditOnly: return "Edit";
+		case SystemGroup::Overlay: return "Overlay";
+		case SystemGroup::FixedUpdate: return "Fixed";
+		default: return "-";
+		}
+	}
+
+	// 1フレーム分を積む
+	void Accumulate(Report& report, World& world, float updateMs, float renderMs)
+	{
+		const float frameMs = updateMs + renderMs;
+		report.frame.Add(frameMs);
+		report.update.Add(updateMs);
+		report.render.Add(renderMs);
+		report.frameTotal += frameMs;
+		report.updateTotal += updateMs;
+		report.renderTotal += renderMs;
+		report.fixedSteps += (uint64_t)std::max(world.getLastFixedStepCount(), 0);
+
+		const RenderStats& stats = RenderBackend::Get().GetStats();
+		report.renderTotalStats.drawCalls += stats.drawCalls;
+		report.renderTotalStats.stateChanges += stats.stateChanges;
+		report.renderTotalStats.bytesUploaded += stats.bytesUploaded;
+
+		for (const auto& sys : world.getSystems())
+		{
+			if (!sys->m_isEnabled) continue;
+
+			auto it = report.systems.find(sys->m_systemName);
+			if (it == report.systems.end()) it = report.systems.emplace(sys->m_systemName, SystemSample{ sys->m_group, RollingHistogram(report.window) }).first;
+
+			SystemSample& sample = it->second;
+			sample.group = sys->m_group;
+			sample.hist.Add((float)sys->m_lastExecutionTime);
+			sample.total += sys->m_lastExecutionTime;
+			if (sys->m_didRun) ++sample.runs;
+		}
+	}
+
+	void WriteText(std::ostream& os, const Options& options, const Report& report)
+	{
+		const double frames = (double)report.frame.Count();
+		auto line = [&](const char* name, const RollingHistogram& hist, double total)
+		{
+			char buffer[160];
+			snprintf(buffer, sizeof(buffer), "%-10s avg %8.3f  p50 %8.3f  p95 %8.3f  p99 %8.3f  max %8.3f\n",
+				name, total / frames, hist.Percentile(0.50f), hist.Percentile(0.95f), hist.Percentile(0.99f), hist.Max());
+			os << buffer;
+		};
+
+		os << "Scene   : " << options.scene << "\n";
+		os << "Frames  : " << report.frame.Count() << " (warmup " << options.warmup << ", dt " << options.dt * 1000.0f << " ms)\n";
+		os << "Backend : " << RenderBackend::Get().GetName() << (options.render ? "" : " (render skipped)") << "\n";
+		os << "Entities: " << report.entities << "  Fixed steps: " << report.fixedSteps << "\n\n";
+
+		os << "[Time (ms)]\n";
+		line("Frame", report.frame, report.frameTotal);
+		line("Update", report.update, report.updateTotal);
+		line("Render", report.render, report.renderTotal);
+
+		os << "\n[Systems (ms / frame)]\n";
+		for (const auto& [name, sample] : report.systems)
+		{
+			char buffer[256];
+			snprintf(buffer, sizeof(buffer), "%-32s %-7s runs %6d  avg %8.3f  p50 %8.3f  p95 %8.3f  p99 %8.3f  max %8.3f\n",
+				name.c_str(), GetGroupName(sample.group), sample.runs, sample.total / frames,
+				sample.hist.Percentile(0.50f), sample.hist.Percentile(0.95f), sample.hist.Percentile(0.99f), sample.hist.Max());
+			os << buffer;
+		}
+
+		os << "\n[Render (per frame)]\n";
+		os << "Draw calls   : " << report.renderTotalStats.drawCalls / frames << "\n";
+		os << "State changes: " << report.renderTotalStats.stateChanges / frames << "\n";
+		os << "Bytes upload : " << report.renderTotalStats.bytesUploaded / frames << "\n";
+	}
+
+	void WriteJson(std::ostream& os, const Options& options, const Report& report)
+	{
+		const double frames = (double)report.frame.Count();
+		auto timing = [&](const RollingHistogram& hist, double total) -> json
+		{
+			return {
+				{ "avg", total / frames },
+				{ "p50", hist.Percentile(0.50f) },
+				{ "p95", hist.Percentile(0.95f) },
+				{ "p99", hist.Percentile(0.99f) },
+				{ "max", hist.Max() },
+			};
+		};
+
+		json systems = json::array();
+		for (const auto& [name, sample] : report.systems)
+		{
+			json entry = timing(sample.hist, sample.total);
+			entry["name"] = name;
+			entry["group"] = GetGroupName(sample.group);
+			entry["runs"] = sample.runs;
+			systems.push_back(std::move(entry));
+		}
+
+		json result = {
+			{ "scene", options.scene },
+			{ "frames", report.frame.Count() },
+			{ "warmup", options.warmup },
+			{ "dt", options.dt },
+			{ "backend", RenderBackend::Get().GetName() },
+			{ "render", options.render },
+			{ "entities", report.entities },
+			{ "fixedSteps", report.fixedSteps },
+			{ "frame", timing(report.frame, report.frameTotal) },
+			{ "update", timing(report.update, report.updateTotal) },
+			{ "renderTime", timing(report.render, report.renderTotal) },
+			{ "systems", std::move(systems) },
+			{ "renderStats", {
+				{ "drawCalls", report.renderTotalStats.drawCalls / frames },
+				{ "stateChanges", report.renderTotalStats.stateChanges / frames },
+				{ "bytesUploaded", report.renderTotalStats.bytesUploaded / frames },
+			} },
+		};
+		os << result.dump(2) << "\n";
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace Arche;
+
+	Options options;
+	if (!ParseOptions(argc, argv, options)) return 1;
+
+	HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+	if (FAILED(hr))
+	{
+		std::cerr << "Failed to initialize COM library." << std::endl;
+		return 2;
+	}
+
+	// 1. デバイスと描画コマンドの発行先（描画しないならデバイスは作らない）
+	ComPtr<ID3D11Device> device;
+	ComPtr<ID3D11DeviceContext> context;
+	if (options.render && !RenderBackend::CreateOffscreenDevice(device, context))
+	{
+		std::cerr << "[Headless] Failed to create D3D11 device." << std::endl;
+		CoUninitialize();
+		return 2;
+	}
+
+	RenderBackend::Initialize(device.Get(), std::make_unique<NullRenderBackend>());
+	IRenderBackend* backend = &RenderBackend::Get();
+
+	// 描画側が取得するビューポート（Application と同じ画面サイズ）
+	D3D11_VIEWPORT vp = {};
+	vp.Width = (float)Config::SCREEN_WIDTH;
+	vp.Height = (float)Config::SCREEN_HEIGHT;
+	vp.MinDepth = 0.0f;
+	vp.MaxDepth = 1.0f;
+	backend->RSSetViewports(1, &vp);
+
+	// 2. サブシステム初期化（Application と同じ順 / 入力は使わない）
+	new SceneManager();
+	Hierarchy::Install(SceneManager::Instance().GetWorld().getRegistry());
+
+	Input::Initialize();
+	ResourceManager::Instance().Initialize(device.Get());
+	PrefabManager::Instance().Initialize();
+	AudioManager::Instance().Initialize();
+	Time::Initialize();
+	Time::SetFixedRate(Config::FIXED_UPDATE_RATE);
+	Time::SetMaxFixedSteps(Config::MAX_FIXED_STEPS);
+	ARCHE_PROFILE_THREAD("Main");
+	JobSystem::Initialize();
+
+	if (options.render)
+	{
+		PrimitiveRenderer::Initialize(device.Get(), backend);
+		SpriteRenderer::Initialize(device.Get(), backend, Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT);
+		ModelRenderer::Initialize(device.Get(), backend);
+		BillboardRenderer::Initialize(device.Get(), backend);
+		ShadowRenderer::Initialize(device.Get(), backend);
+		TextRenderer::Initialize(device.Get(), backend);
+	}
+
+	// 3. ゲーム側のシステム / コンポーネントの登録
+	HMODULE sandboxModule = LoadLibraryA((GetExeDirectory() / "Sandbox.dll").string().c_str());
+	if (!sandboxModule)
+	{
+		std::cerr << "[Headless] Warning: Sandbox.dll not found (engine systems only)." << std::endl;
+	}
+
+	// 4. シーン読み込み
+	int exitCode = 0;
+	SceneManager& sceneManager = SceneManager::Instance();
+	World& world = sceneManager.GetWorld();
+	sceneManager.Initialize();
+
+	if (!std::filesystem::exists(options.scene))
+	{
+		std::cerr << "[Headless] Scene not found: " << options.scene << std::endl;
+		exitCode = 2;
+	}
+	else
+	{
+		SceneSerializer::LoadScene(world, options.scene);
+		sceneManager.GetContext().editorState = EditorState::Play;
+		std::cerr << "[Headless] Loaded " << options.scene << std::endl;
+
+		// 5. N フレーム回す
+		Report report;
+		report.window = (std::size_t)options.frames;
+		report.frame.SetWindow(report.window);
+		report.update.SetWindow(report.window);
+		report.render.SetWindow(report.window);
+
+		using Clock = std::chrono::steady_clock;
+		for (int i = 0; i < options.warmup + options.frames; ++i)
+		{
+			ARCHE_PROFILE_FRAME();
+			RenderBackend::BeginFrame();
+
+			const auto start = Clock::now();
+			{
+				ARCHE_PROFILE_SCOPE("Update");
+				Time::Advance(options.dt);
+				ResourceManager::Instance().Update();
+				sceneManager.Update();
+			}
+			const auto updated = Clock::now();
+			if (options.render)
+			{
+				ARCHE_PROFILE_SCOPE("Render");
+				sceneManager.Render();
+			}
+			const auto end = Clock::now();
+
+			if (i < options.warmup) continue;
+
+			Accumulate(report, world,
+				std::chrono::duration<float, std::milli>(updated - start).count(),
+				std::chrono::duration<float, std::milli>(end - updated).count());
+		}
+		report.entities = world.getRegistry().aliveCount();
+
+		// 6. 結果
+		if (options.json) WriteJson(std::cout, options, report);
+		else WriteText(std::cout, options, report);
+	}
+
+	// 7. 終了処理（Application::Finalize と同じ順）
+	AudioManager::Instance().Finalize();
+	ResourceManager::Instance().Clear();
+
+	if (options.render)
+	{
+		SpriteRenderer::Shutdown();
+		BillboardRenderer::Shutdown();
+		PrimitiveRenderer::Shutdown();
+		ModelRenderer::Shutdown();
+		ShadowRenderer::Shutdown();
+		TextRenderer::Shutdown();
+	}
+
+	delete &sceneManager;
+	RenderBackend::Shutdown();
+	JobSystem::Shutdown();
+	Profiler::Clear();
+
+	ComponentRegistry::Destroy();
+	SystemRegistry::Destroy();
+
+	if (sandboxModule) FreeLibrary(sandboxModule);
+	CoUninitialize();
+	return exitCode;
+}
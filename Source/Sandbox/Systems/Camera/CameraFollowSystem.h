@@ -2,6 +2,7 @@
 #include "Engine/Scene/Core/ECS/ECS.h"
 #include "Engine/Scene/Components/Components.h"
 #include "Sandbox/Components/Player/PlayerMoveData.h"
+#include "Sandbox/Components/Player/PlayerController.h"
 #include <cmath>
 #include <algorithm>
 #include <DirectXMath.h>
@@ -19,25 +20,16 @@ namespace Arche
 		{
 			float dt = Time::DeltaTime();
 
-			Entity player = NullEntity;
-			XMVECTOR targetPos = XMVectorZero();
-			XMVECTOR playerVel = XMVectorZero();
+			// プレイヤー取得（唯一コンポーネント）
+			Entity player = registry.unique<PlayerController>();
+			if (player == NullEntity || !registry.isActive(player) || !registry.has<Transform>(player)) return;
 
-			// プレイヤー探索
-			auto entities = registry.view<Tag, Transform>();
-			for (auto e : entities) {
-				if (entities.get<Tag>(e).tag == "Player") {
-					player = e;
-					targetPos = XMLoadFloat3(&entities.get<Transform>(e).position);
-					if (registry.has<Rigidbody>(e)) {
-						playerVel = XMLoadFloat3(&registry.get<Rigidbody>(e).velocity);
-					}
-					break;
-				}
+			XMVECTOR targetPos = XMLoadFloat3(&registry.read<Transform>(player).position);
+			XMVECTOR playerVel = XMVectorZero();
+			if (registry.has<Rigidbody>(player)) {
+				playerVel = XMLoadFloat3(&registry.read<Rigidbody>(player).velocity);
 			}
 
-			if (player == NullEntity) return;
-
 			float speed = XMVectorGetX(XMVector3Length(playerVel * XMVectorSet(1, 0, 1, 0)));
 
 			auto cameras = registry.view<Camera, Transform>();
@@ -33,7 +33,7 @@ namespace Arche
 		void PlaySound(Registry& reg, std::string key, XMFLOAT3 pos, float vol = 1.0f) {
 			XMFLOAT3 listenerPos = pos;
 			for (auto e : reg.view<AudioListener, Transform>()) {
-				listenerPos = reg.get<Transform>(e).position;
+				listenerPos = reg.read<Transform>(e).position;
 				break;
 			}
 			AudioManager::Instance().Play3DSE(key, pos, listenerPos, 50.0f, vol);
@@ -43,10 +43,12 @@ namespace Arche
 		{
 			if (!reg.has<AttackAttribute>(attacker)) return;
 			if (!reg.has<EnemyStats>(defender)) return;
+			// 破棄予約済み（このフレームで既に倒された / 消費された）なら無視
+			if (reg.commands().isQueuedForDestroy(attacker) || reg.commands().isQueuedForDestroy(defender)) return;
 
-			auto& attr = reg.get<AttackAttribute>(attacker);
+			const auto& attr = reg.read<AttackAttribute>(attacker);
 			auto& stats = reg.get<EnemyStats>(defender);
-			auto& pos = reg.get<Transform>(defender).position;
+			const auto& pos = reg.read<Transform>(defender).position;
 
 			stats.hp -= attr.damage;
 			FloatingTextSystem::Spawn(reg, pos, (int)attr.damage, { 1, 1, 1, 1 }, 0.8f);
@@ -54,13 +56,13 @@ namespace Arche
 			// ヒット音
 			PlaySound(reg, "se_hit.wav", pos, 0.7f);
 
-			if (!attr.isPenetrate) reg.destroy(attacker);
+			if (!attr.isPenetrate) reg.commands().destroy(attacker);
 
 			if (stats.hp <= 0.0f) {
 				float finalReward = stats.killReward * attr.rewardRate;
 				if (finalReward > 0) {
 					for (auto p : reg.view<PlayerTime, Transform>()) {
-						FloatingTextSystem::Spawn(reg, reg.get<Transform>(p).position, (int)finalReward, { 0, 1, 0, 1 }, 1.5f);
+						FloatingTextSystem::Spawn(reg, reg.read<Transform>(p).position, (int)finalReward, { 0, 1, 0, 1 }, 1.5f);
 					}
 				}
 				RecoverTime(reg, finalReward);
@@ -69,7 +71,7 @@ namespace Arche
 				// 爆発音
 				PlaySound(reg, "se_explosion.wav", pos, 1.0f);
 
-				reg.destroy(defender);
+				reg.commands().destroy(defender);
 			}
 		}
 
@@ -84,15 +86,20 @@ namespace Arche
 		}
 
 		void SpawnExplosion(Registry& reg, DirectX::XMFLOAT3 pos) {
-			for (int i = 0; i < 5; ++i) {
-				Entity e = reg.create();
-				reg.emplace<Transform>(e).position = {
-					pos.x + (rand() % 100 / 100.0f - 0.5f), pos.y, pos.z + (rand() % 100 / 100.0f - 0.5f)
-				};
-				reg.get<Transform>(e).scale = { 0.8f, 0.8f, 0.8f };
-				auto& g = reg.emplace<GeometricDesign>(e);
-				g.shapeType = GeoShape::Cube; g.color = { 0, 1, 1, 1 }; g.isWireframe = true;
+			// 破片はまとめて作成・追加する
+			std::array<Entity, 5> shards;
+			reg.create(shards.size(), shards.begin());
+
+			std::array<Transform, 5> transforms;
+			for (auto& t : transforms) {
+				t.position = { pos.x + (rand() % 100 / 100.0f - 0.5f), pos.y, pos.z + (rand() % 100 / 100.0f - 0.5f) };
+				t.scale = { 0.8f, 0.8f, 0.8f };
 			}
+			GeometricDesign g;
+			g.shapeType = GeoShape::Cube; g.color = { 0, 1, 1, 1 }; g.isWireframe = true;
+
+			reg.insert<Transform>(shards.begin(), shards.end(), transforms.begin());
+			reg.insert<GeometricDesign>(shards.begin(), shards.end(), g);
 		}
 	};
 }
@@ -3,6 +3,7 @@
 #include "Engine/Core/Time/Time.h"
 #include "Sandbox/Components/Enemy/BossAI.h"
 #include "Sandbox/Components/Enemy/EnemyStats.h"
+#include "Sandbox/Components/Player/PlayerController.h"
 #include "Engine/Resource/PrefabManager.h"
 #include "Sandbox/Components/Player/Bullet.h" // 弾コンポーネント用
 
@@ -19,15 +20,9 @@ namespace Arche
 			float time = Time::TotalTime();
 
 			// プレイヤー位置取得
-			XMVECTOR pPos = XMVectorZero();
-			bool pFound = false;
-			for (auto e : reg.view<Tag, Transform>()) {
-				if (reg.get<Tag>(e).tag == "Player") {
-					pPos = XMLoadFloat3(&reg.get<Transform>(e).position);
-					pFound = true; break;
-				}
-			}
-			if (!pFound) return;
+			Entity player = reg.unique<PlayerController>();
+			if (player == NullEntity || !reg.isActive(player) || !reg.has<Transform>(player)) return;
+			XMVECTOR pPos = XMLoadFloat3(&reg.read<Transform>(player).position);
 
 			// 全ボス更新
 			auto view = reg.view<BossAI, Transform, EnemyStats>();
@@ -413,12 +408,11 @@ namespace Arche
 			else if (ai.state == BossState::Attack_Ult) {
 				// プレイヤーを引き寄せる（疑似重力）
 				XMVECTOR pullDir = XMVector3Normalize(myPos - pPos);
-				for (auto player : reg.view<Tag, Transform>()) {
-					if (reg.get<Tag>(player).tag == "Player") {
-						auto& pt = reg.get<Transform>(player);
-						pt.position.x += XMVectorGetX(pullDir) * dt * 3.0f;
-						pt.position.z += XMVectorGetZ(pullDir) * dt * 3.0f;
-					}
+				Entity player = reg.unique<PlayerController>();
+				if (player != NullEntity && reg.has<Transform>(player)) {
+					auto& pt = reg.get<Transform>(player);
+					pt.position.x += XMVectorGetX(pullDir) * dt * 3.0f;
+					pt.position.z += XMVectorGetZ(pullDir) * dt * 3.0f;
 				}
 
 				ai.phaseTimer += dt;
@@ -14,22 +14,30 @@ namespace Arche
 	class EnemyAttackSystem : public ISystem
 	{
 	public:
-		EnemyAttackSystem() { m_systemName = "EnemyAttackSystem"; m_group = SystemGroup::PlayOnly; }
+		EnemyAttackSystem()
+		{
+			m_systemName = "EnemyAttackSystem";
+			m_group = SystemGroup::PlayOnly;
+
+			// 攻撃の判断は毎フレームでなくてよい（タイマーは間引いた分の経過時間で進める）
+			m_runPolicy.mode = SystemRunPolicy::Mode::Rate;
+			m_runPolicy.hz = 20.0f;
+		}
 
 		void Update(Registry& reg) override
 		{
-			float dt = Time::DeltaTime();
+			float dt = m_elapsedTime;
 
 			XMFLOAT3 pPos = { 0,0,0 };
 			bool pFound = false;
-			for (auto e : reg.view<PlayerTime, Transform>()) { pPos = reg.get<Transform>(e).position; pFound = true; break; }
+			for (auto e : reg.view<PlayerTime, Transform>()) { pPos = reg.read<Transform>(e).position; pFound = true; break; }
 			if (!pFound) return;
 
 			auto view = reg.view<EnemyStats, Transform>();
 			for (auto e : view)
 			{
 				auto& stats = view.get<EnemyStats>(e);
-				auto& t = view.get<Transform>(e);
+				const auto& t = view.get<const Transform>(e);
 
 				if (stats.type == EnemyType::Boss_Tank || stats.type == EnemyType::Boss_Prism ||
 					stats.type == EnemyType::Boss_Carrier || stats.type == EnemyType::Boss_Construct ||
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 #include "Engine/Scene/Components/Components.h"
 #include "Sandbox/Components/Visual/GeometricDesign.h"
 #include "Sandbox/Components/Enemy/EnemyStats.h"
@@ -65,13 +66,7 @@ namespace Arche
 			geo.color = color;
 
 			if (hasCollider) {
-				Collider col;
-				col.layer = Layer::Enemy;
-				if (shape == GeoShape::Cube) col = Collider::CreateBox(scale.x, scale.y, scale.z, Layer::Enemy);
-				else if (shape == GeoShape::Sphere) col = Collider::CreateSphere(scale.x, Layer::Enemy);
-				else if (shape == GeoShape::Cylinder) col = Collider::CreateCylinder(scale.x, scale.y, Layer::Enemy);
-				else col = Collider::CreateBox(scale.x, scale.y, scale.z, Layer::Enemy);
-				reg.emplace<Collider>(part, col);
+				reg.emplace<Collider>(part, MakePartCollider(shape, scale));
 			}
 
 			if (hasHealth) {
@@ -80,13 +75,57 @@ namespace Arche
 				reg.emplace<Tag>(part).tag = "EnemyPart";
 			}
 
-			if (!reg.has<Relationship>(parent)) reg.emplace<Relationship>(parent);
-			if (!reg.has<Relationship>(part)) reg.emplace<Relationship>(part);
-			reg.get<Relationship>(parent).children.push_back(part);
-			reg.get<Relationship>(part).parent = parent;
+			Hierarchy::SetParent(reg, part, parent);
 			return part;
 		}
 
+		// 同じ形状・色のパーツをまとめて追加する（エンティティ作成とコンポーネント追加を一括で行う）
+		// transforms の各要素がパーツ1つ分の配置（position / rotation / scale）
+		static std::vector<Entity> AddParts(Registry& reg, Entity parent, GeoShape shape, XMFLOAT4 color,
+			const std::vector<Transform>& transforms, bool hasCollider, bool hasHealth)
+		{
+			std::vector<Entity> parts;
+			reg.create(transforms.size(), std::back_inserter(parts));
+
+			GeometricDesign geo;
+			geo.shapeType = shape;
+			geo.isWireframe = true;
+			geo.color = color;
+
+			reg.insert<Transform>(parts.begin(), parts.end(), transforms.begin());
+			reg.insert<GeometricDesign>(parts.begin(), parts.end(), geo);
+
+			if (hasCollider) {
+				std::vector<Collider> colliders;
+				colliders.reserve(transforms.size());
+				for (auto& t : transforms) colliders.push_back(MakePartCollider(shape, t.scale));
+				reg.insert<Collider>(parts.begin(), parts.end(), colliders.begin());
+			}
+
+			if (hasHealth) {
+				EnemyStats pStats;
+				pStats.hp = 50.0f; pStats.maxHp = 50.0f; pStats.scoreValue = 100;
+				reg.insert<EnemyStats>(parts.begin(), parts.end(), pStats);
+
+				Tag tag;
+				tag.tag = "EnemyPart";
+				reg.insert<Tag>(parts.begin(), parts.end(), tag);
+			}
+
+			// Relationship はまとめて追加し、親子リストへは1つずつ O(1) で繋ぐ
+			reg.insert<Relationship>(parts.begin(), parts.end());
+			for (Entity part : parts) Hierarchy::SetParent(reg, part, parent);
+			return parts;
+		}
+
+		static Collider MakePartCollider(GeoShape shape, XMFLOAT3 scale)
+		{
+			if (shape == GeoShape::Cube) return Collider::CreateBox(scale.x, scale.y, scale.z, Layer::Enemy);
+			else if (shape == GeoShape::Sphere) return Collider::CreateSphere(scale.x, Layer::Enemy);
+			else if (shape == GeoShape::Cylinder) return Collider::CreateCylinder(scale.x, scale.y, Layer::Enemy);
+			return Collider::CreateBox(scale.x, scale.y, scale.z, Layer::Enemy);
+		}
+
 		// --- 雑魚 (速度アップ) ---
 		static void BuildZakoCube(Registry& reg, Entity root, EnemyStats& stats, Rigidbody& rb) {
 			stats.hp = 30; stats.maxHp = 30;
@@ -157,11 +196,12 @@ namespace Arche
 			auto& ai = reg.emplace<BossAI>(root); ai.bossName = "Prism";
 			Entity core = AddPart(reg, root, GeoShape::Cube, { 1,0,1,1 }, { 0,1,0 }, { 2.5f, 2.5f, 2.5f }, false);
 			reg.get<Transform>(core).rotation = { 45, 45, 0 };
+			std::vector<Transform> bits;
 			for (int i = 0; i < 4; ++i) {
 				float x = sinf(i * 1.57f) * 4.0f; float z = cosf(i * 1.57f) * 4.0f;
-				Entity bit = AddPart(reg, root, GeoShape::Cube, { 1,0,1,0.5f }, { x, 0, z }, { 1,1,1 }, true, true);
-				reg.get<Transform>(bit).rotation = { 45, 0, 45 };
+				bits.emplace_back(XMFLOAT3{ x, 0, z }, XMFLOAT3{ 45, 0, 45 }, XMFLOAT3{ 1,1,1 });
 			}
+			AddParts(reg, root, GeoShape::Cube, { 1,0,1,0.5f }, bits, true, true);
 		}
 		static void BuildBossCarrier(Registry& reg, Entity root, EnemyStats& stats, Rigidbody& rb) {
 			stats.hp = 600;
@@ -180,11 +220,12 @@ namespace Arche
 			reg.emplace<Collider>(root, Collider::CreateSphere(2.5f, Layer::Enemy));
 			auto& ai = reg.emplace<BossAI>(root); ai.bossName = "Construct";
 			AddPart(reg, root, GeoShape::Sphere, { 1,0.5f,0,1 }, { 0,0,0 }, { 2.5f, 2.5f, 2.5f }, false);
+			std::vector<Transform> arms;
 			for (int i = 0; i < 8; ++i) {
 				float angle = i * 0.785f; float r = 3.0f;
-				Entity arm = AddPart(reg, root, GeoShape::Cube, { 1,0.2f,0,1 }, { sinf(angle) * r, 0, cosf(angle) * r }, { 0.5f, 0.5f, 4.0f }, true, true);
-				reg.get<Transform>(arm).rotation.y = XMConvertToDegrees(angle);
+				arms.emplace_back(XMFLOAT3{ sinf(angle) * r, 0, cosf(angle) * r }, XMFLOAT3{ 0, XMConvertToDegrees(angle), 0 }, XMFLOAT3{ 0.5f, 0.5f, 4.0f });
 			}
+			AddParts(reg, root, GeoShape::Cube, { 1,0.2f,0,1 }, arms, true, true);
 		}
 		static void BuildBossOmega(Registry& reg, Entity root, EnemyStats& stats, Rigidbody& rb) {
 			stats.hp = 3000;
@@ -198,9 +239,12 @@ namespace Arche
 			Entity r1 = AddPart(reg, root, GeoShape::Torus, { 1,0,0,0.5f }, { 0,0,0 }, { 10,10,0.5f }, false);
 			Entity r2 = AddPart(reg, root, GeoShape::Torus, { 1,0,0,0.5f }, { 0,0,0 }, { 12,12,0.5f }, false);
 			reg.get<Transform>(r2).rotation = { 90,0,0 };
+			std::vector<Transform> shields;
 			for (int i = 0; i < 6; ++i) {
 				float a = i * 1.047f;
-				Entity shield = AddPart(reg, root, GeoShape::Sphere, { 0,1,1,1 }, { sinf(a) * 8, 0, cosf(a) * 8 }, { 1.5f,1.5f,1.5f }, true, true);
+				shields.emplace_back(XMFLOAT3{ sinf(a) * 8, 0, cosf(a) * 8 }, XMFLOAT3{ 0, 0, 0 }, XMFLOAT3{ 1.5f,1.5f,1.5f });
+			}
+			for (Entity shield : AddParts(reg, root, GeoShape::Sphere, { 0,1,1,1 }, shields, true, true)) {
 				reg.get<EnemyStats>(shield).hp = 300;
 			}
 		}
@@ -2,6 +2,7 @@
 #include "Engine/Scene/Core/ECS/ECS.h"
 #include "Engine/Scene/Components/Components.h"
 #include "Sandbox/Components/Enemy/EnemyStats.h"
+#include "Sandbox/Components/Player/PlayerController.h"
 #include <cmath>
 #include <DirectXMath.h>
 
@@ -19,18 +20,12 @@ namespace Arche
 			float dt = Time::DeltaTime();
 
 			// プレイヤー位置
-			XMVECTOR playerPos = XMVectorZero();
-			bool pFound = false;
-			for (auto e : reg.view<Tag, Transform>()) {
-				if (reg.get<Tag>(e).tag == "Player") {
-					playerPos = XMLoadFloat3(&reg.get<Transform>(e).position);
-					pFound = true; break;
-				}
-			}
-			if (!pFound) return;
+			Entity player = reg.unique<PlayerController>();
+			if (player == NullEntity || !reg.isActive(player) || !reg.has<Transform>(player)) return;
+			XMVECTOR playerPos = XMLoadFloat3(&reg.read<Transform>(player).position);
 
 			// 全エネミーの移動
-			auto view = reg.view<EnemyStats, Transform, Rigidbody>();
+			auto view = reg.query<EnemyStats, Transform, Rigidbody>();
 			for (auto entity : view)
 			{
 				auto& stats = view.get<EnemyStats>(entity);
@@ -3,93 +3,113 @@
 #include "Engine/Scene/Components/Components.h"
 #include "Sandbox/Components/Enemy/EnemyStats.h"
 #include "Sandbox/Components/Visual/GeometricDesign.h"
-#include <unordered_map>
+#include <unordered_set>
 
 namespace Arche
 {
+	// 敵のHPバー（UI側のエンティティが持つ）
+	struct EnemyHPBar
+	{
+		Entity enemy = NullEntity;	// 追従する敵
+	};
+
 	class EnemyUISystem : public ISystem
 	{
-		std::unordered_map<Entity, Entity> m_enemyToUI;
+		// バーを持っている敵（直前の1周で確認した分 + 作成した分）
+		std::unordered_set<Entity> m_enemiesWithBar;
+		// 今の周で確認した敵（1周を終えたら m_enemiesWithBar と入れ替える）
+		std::unordered_set<Entity> m_passEnemies;
+		// バーの更新は TimeSliced なら複数フレームに分ける
+		SliceCursor m_cursor;
 
 	public:
-		EnemyUISystem() { m_systemName = "EnemyUISystem"; m_group = SystemGroup::PlayOnly; }
+		EnemyUISystem()
+		{
+			m_systemName = "EnemyUISystem";
+			m_group = SystemGroup::PlayOnly;
+			m_access.writeWith<EnemyHPBar, EnemyHPBar, Transform, GeometricDesign>()
+				.readWith<EnemyStats, EnemyStats, Transform>()
+				.readWith<Camera, Transform>();
+		}
 
 		void Update(Registry& reg) override
 		{
-			Entity cam = NullEntity;
-			for (auto e : reg.view<Camera>()) { cam = e; break; }
-
-			// 1. 削除チェック & クリーンアップ
-			// 敵がいない、または無効になったらUIを消してリストから外す
-			for (auto it = m_enemyToUI.begin(); it != m_enemyToUI.end(); ) {
-				Entity enemy = it->first;
-				Entity ui = it->second;
+			Entity cam = reg.unique<Camera>();
+			const XMFLOAT3* camRot = nullptr;
+			if (cam != NullEntity && reg.isActive(cam) && reg.has<Transform>(cam)) camRot = &reg.read<Transform>(cam).rotation;
+
+			// 作成・削除は同期点でまとめて行う
+			CommandBuffer& commands = reg.commands();
+
+			// 1. 既存バーの更新 & クリーンアップ
+			// 敵がいない、または無効になったらUIを消す
+			// ※ TimeSliced では予算の分だけ進め、残りは次のフレームで続ける
+			auto bars = reg.view<EnemyHPBar, Transform, GeometricDesign>();
+			const bool passDone = m_cursor.each(*this, reg, bars, [&](Entity ui)
+			{
+				Entity enemy = bars.get<const EnemyHPBar>(ui).enemy;
 
 				// 敵が存在しないならUIも道連れ
-				if (!reg.valid(enemy)) {
-					if (reg.valid(ui)) reg.destroy(ui);
-					it = m_enemyToUI.erase(it);
-				}
-				else {
-					++it;
+				if (!reg.valid(enemy) || !reg.has<EnemyStats>(enemy) || !reg.has<Transform>(enemy)) {
+					commands.destroy(ui);
+					return;
 				}
+
+				m_passEnemies.insert(enemy);
+				UpdateBar(reg.read<EnemyStats>(enemy), reg.read<Transform>(enemy), camRot,
+					bars.get<Transform>(ui), bars.get<GeometricDesign>(ui));
+			});
+			if (passDone)
+			{
+				// 1周分の確認が揃ったら入れ替える（外から消されたバーの敵は、次で作り直される）
+				m_enemiesWithBar.swap(m_passEnemies);
+				m_passEnemies.clear();
 			}
 
-			// 2. 新規作成 & 更新
-			auto view = reg.view<EnemyStats, Transform>();
+			// 2. バーを持っていない敵に新規作成
+			// 敵側は読むだけ（同じ段で並列に動く他システムと競合しないよう、変更扱いにしない）
+			auto view = reg.view<const EnemyStats, const Transform>();
 			for (auto enemy : view)
 			{
-				// ★追加: 念のための生存確認 (viewに含まれていても無効な場合があるため)
-				if (!reg.valid(enemy)) continue;
-
-				// マップに登録されているか検索
-				auto it = m_enemyToUI.find(enemy);
-				Entity ui = NullEntity;
-
-				if (it == m_enemyToUI.end()) {
-					// 新規作成
-					ui = reg.create();
-					reg.emplace<Transform>(ui);
-					auto& g = reg.emplace<GeometricDesign>(ui);
-					g.shapeType = GeoShape::Cube;
-					g.color = { 0, 0, 0, 1 };
-					g.isWireframe = false;
-
-					m_enemyToUI[enemy] = ui;
-				}
-				else {
-					ui = it->second;
-				}
-
-				// ★追加: UI自体の生存確認とコンポーネント確認
-				if (!reg.valid(ui)) continue;
-				if (!reg.has<Transform>(ui) || !reg.has<GeometricDesign>(ui)) continue;
-
-				// 敵のコンポーネント取得 (view経由なので基本あるはずだが念のため)
-				auto& eStats = view.get<EnemyStats>(enemy);
-				auto& eTrans = view.get<Transform>(enemy);
-
-				auto& uiTrans = reg.get<Transform>(ui);
-				auto& uiGeo = reg.get<GeometricDesign>(ui); // ★ここで落ちていたのを防ぐ
-
-				// 位置更新
-				float yOffset = (eStats.type == EnemyType::Boss_Omega) ? 6.0f : 2.5f;
-				XMVECTOR ePos = XMLoadFloat3(&eTrans.position);
-				XMVECTOR uiPos = ePos + XMVectorSet(0, yOffset, 0, 0);
-				XMStoreFloat3(&uiTrans.position, uiPos);
+				if (m_enemiesWithBar.count(enemy)) continue;
+
+				Transform uiTrans;
+				GeometricDesign uiGeo;
+				uiGeo.shapeType = GeoShape::Cube;
+				uiGeo.isWireframe = false;
+				UpdateBar(view.get<const EnemyStats>(enemy), view.get<const Transform>(enemy), camRot, uiTrans, uiGeo);
+
+				Entity ui = commands.create();
+				commands.emplace<Transform>(ui, uiTrans);
+				commands.emplace<GeometricDesign>(ui, uiGeo);
+				commands.emplace<EnemyHPBar>(ui, EnemyHPBar{ enemy });
+				m_enemiesWithBar.insert(enemy);
+				m_passEnemies.insert(enemy);
+			}
+		}
 
-				if (cam != NullEntity && reg.has<Transform>(cam)) {
-					uiTrans.rotation = reg.get<Transform>(cam).rotation;
-				}
+	private:
+		// 敵の状態からバーの位置・色・長さを求める
+		static void UpdateBar(const EnemyStats& eStats, const Transform& eTrans, const XMFLOAT3* camRot,
+			Transform& uiTrans, GeometricDesign& uiGeo)
+		{
+			// 位置更新
+			float yOffset = (eStats.type == EnemyType::Boss_Omega) ? 6.0f : 2.5f;
+			XMVECTOR ePos = XMLoadFloat3(&eTrans.position);
+			XMVECTOR uiPos = ePos + XMVectorSet(0, yOffset, 0, 0);
+			XMStoreFloat3(&uiTrans.position, uiPos);
+
+			if (camRot) {
+				uiTrans.rotation = *camRot;
+			}
 
-				// HPバー更新
-				float hpRatio = eStats.hp / eStats.maxHp;
-				if (hpRatio < 0) hpRatio = 0;
-				if (hpRatio > 0.5f) uiGeo.color = { 1.0f - (hpRatio - 0.5f) * 2, 1, 0, 1 };
-				else uiGeo.color = { 1, hpRatio * 2, 0, 1 };
+			// HPバー更新
+			float hpRatio = eStats.hp / eStats.maxHp;
+			if (hpRatio < 0) hpRatio = 0;
+			if (hpRatio > 0.5f) uiGeo.color = { 1.0f - (hpRatio - 0.5f) * 2, 1, 0, 1 };
+			else uiGeo.color = { 1, hpRatio * 2, 0, 1 };
 
-				uiTrans.scale = { 1.5f * hpRatio, 0.15f, 0.05f };
-			}
+			uiTrans.scale = { 1.5f * hpRatio, 0.15f, 0.05f };
 		}
 	};
 }
@@ -14,56 +14,78 @@ namespace Arche
 
 	struct FieldTag {};
 
+	// フィールドを構成する演出用エンティティ
+	struct FieldPart
+	{
+		enum class Kind { Floor, Building, Barrier };
+		Kind kind = Kind::Floor;
+		int index = 0;	// ビル群のリズム用
+	};
+
 	struct FieldContext
 	{
-		std::vector<Entity> floorTiles;
-		std::vector<Entity> cityBuildings;
-		std::vector<Entity> barrierRings;
-		Entity mainBarrier = NullEntity;
 		float time = 0.0f;
 	};
 
 	class FieldSystem : public ISystem
 	{
 	public:
-		FieldSystem() { m_systemName = "FieldSystem"; m_group = SystemGroup::PlayOnly; }
+		FieldSystem()
+		{
+			m_systemName = "FieldSystem";
+			m_group = SystemGroup::PlayOnly;
+			m_access.writeWith<FieldTag, FieldTag, FieldProperties>()
+				.writeWith<FieldPart, FieldPart, Transform, GeometricDesign>();
+		}
 
 		void Update(Registry& reg) override
 		{
-			static FieldContext ctx;
-
+			// 生成は同期点でまとめて行う（翌フレームから FieldTag が見える）
 			bool init = false;
 			for (auto e : reg.view<FieldTag>()) { init = true; break; }
 			if (!init) {
-				ctx = FieldContext();
+				reg.ctx().emplace<FieldContext>();
 				float r = (GameSession::selectedStageId == 5) ? 35.0f : 25.0f;
 
-				Entity config = reg.create();
-				reg.emplace<FieldTag>(config);
-				auto& props = reg.emplace<FieldProperties>(config);
+				CommandBuffer& commands = reg.commands();
+				Entity config = commands.create();
+				commands.emplace<FieldTag>(config);
+				FieldProperties props;
 				props.radius = r;
+				commands.emplace<FieldProperties>(config, props);
 
-				GenerateField(reg, ctx, r);
+				GenerateField(commands, r);
+				return;
 			}
 
-			float dt = Time::DeltaTime();
+			// 演出用の時間は Registry のコンテキストに置く（シーン破棄で一緒に消える）
+			FieldContext* field = reg.ctx().find<FieldContext>();
+			FieldContext& ctx = field ? *field : reg.ctx().emplace<FieldContext>();
+
+			// 実行頻度を下げても同じ速さで進むよう、前回の実行からの経過時間を使う
+			float dt = m_elapsedTime;
 			ctx.time += dt;
 
 			// --- 演出更新 ---
-
-			// 1. バリアの回転と明滅
-			if (reg.valid(ctx.mainBarrier)) {
-				auto& t = reg.get<Transform>(ctx.mainBarrier);
-				t.rotation.y += dt * 0.2f;
-				auto& g = reg.get<GeometricDesign>(ctx.mainBarrier);
-				g.color.w = 0.1f + 0.05f * sinf(ctx.time);
-			}
-
-			// 2. 背景ビル群の上下運動 (EQのように)
-			for (int i = 0; i < ctx.cityBuildings.size(); ++i) {
-				if (reg.valid(ctx.cityBuildings[i])) {
-					auto& t = reg.get<Transform>(ctx.cityBuildings[i]);
+			auto view = reg.view<const FieldPart, Transform, GeometricDesign>();
+			for (auto e : view) {
+				const FieldPart& part = view.get<const FieldPart>(e);
+				auto& t = view.get<Transform>(e);
+				auto& g = view.get<GeometricDesign>(e);
+
+				switch (part.kind) {
+				case FieldPart::Kind::Barrier:
+				{
+					// 1. バリアの回転と明滅
+					t.rotation.y += dt * 0.2f;
+					g.color.w = 0.1f + 0.05f * sinf(ctx.time);
+					break;
+				}
+				case FieldPart::Kind::Building:
+				{
+					// 2. 背景ビル群の上下運動 (EQのように)
 					// ランダムなリズムで動く
+					int i = part.index;
 					float speed = 1.0f + (i % 5) * 0.5f;
 					float h = 5.0f + 10.0f * sinf(ctx.time * speed + i);
 					if (h < 1.0f) h = 1.0f;
@@ -71,25 +93,24 @@ namespace Arche
 					t.position.y = -10.0f + h * 0.5f;
 
 					// 色の変化
-					auto& g = reg.get<GeometricDesign>(ctx.cityBuildings[i]);
 					g.color.w = 0.1f + (h / 20.0f) * 0.4f;
+					break;
 				}
-			}
-
-			// 3. 床のウェーブ
-			for (auto e : ctx.floorTiles) {
-				if (reg.valid(e)) {
-					auto& t = reg.get<Transform>(e);
+				case FieldPart::Kind::Floor:
+				{
+					// 3. 床のウェーブ
 					float dist = sqrt(t.position.x * t.position.x + t.position.z * t.position.z);
 					float wave = sinf(dist * 0.3f - ctx.time * 4.0f);
 					t.position.y = -2.0f + wave * 0.15f;
-					reg.get<GeometricDesign>(e).color.w = 0.2f + (wave * 0.5f + 0.5f) * 0.3f;
+					g.color.w = 0.2f + (wave * 0.5f + 0.5f) * 0.3f;
+					break;
+				}
 				}
 			}
 		}
 
 	private:
-		void GenerateField(Registry& reg, FieldContext& ctx, float radius)
+		void GenerateField(CommandBuffer& commands, float radius)
 		{
 			int stageId = GameSession::selectedStageId;
 			if (stageId == 0) stageId = 1;
@@ -100,53 +121,69 @@ namespace Arche
 			if (stageId == 4) baseCol = { 0.8f,0,1,1 };
 			if (stageId == 5) baseCol = { 1,0,0,1 };
 
-			// 床生成
-			int count = (int)(radius / 1.5f);
-			for (int x = -count; x <= count; ++x) {
-				for (int z = -count; z <= count; ++z) {
-					float dist = sqrtf((float)(x * x + z * z)) * 2.0f;
-					if (dist > radius) continue;
-
-					Entity e = reg.create();
-					reg.emplace<Transform>(e).position = { x * 2.0f, -2.0f, z * 2.0f };
-					reg.get<Transform>(e).scale = { 1.9f, 0.1f, 1.9f }; // 隙間なく
-
-					auto& g = reg.emplace<GeometricDesign>(e);
-					g.shapeType = GeoShape::Cube;
-					g.isWireframe = true;
-					g.color = { baseCol.x, baseCol.y, baseCol.z, 0.2f };
-
-					ctx.floorTiles.push_back(e);
+			// 床生成（タイル数が多いが、再生時に型ごとの一括追加になる）
+			{
+				GeometricDesign g;
+				g.shapeType = GeoShape::Cube;
+				g.isWireframe = true;
+				g.color = { baseCol.x, baseCol.y, baseCol.z, 0.2f };
+
+				int count = (int)(radius / 1.5f);
+				for (int x = -count; x <= count; ++x) {
+					for (int z = -count; z <= count; ++z) {
+						float dist = sqrtf((float)(x * x + z * z)) * 2.0f;
+						if (dist > radius) continue;
+
+						Transform t;
+						t.position = { x * 2.0f, -2.0f, z * 2.0f };
+						t.scale = { 1.9f, 0.1f, 1.9f }; // 隙間なく
+
+						Entity e = commands.create();
+						commands.emplace<Transform>(e, t);
+						commands.emplace<GeometricDesign>(e, g);
+						commands.emplace<FieldPart>(e, FieldPart{ FieldPart::Kind::Floor, 0 });
+					}
 				}
 			}
 
 			// 背景ビル群（遠景）
-			int buildings = 60;
-			for (int i = 0; i < buildings; ++i) {
-				float angle = (i / (float)buildings) * XM_2PI;
-				float dist = radius + 10.0f + (rand() % 20);
-
-				Entity e = reg.create();
-				reg.emplace<Transform>(e).position = { cosf(angle) * dist, -10.0f, sinf(angle) * dist };
-				reg.get<Transform>(e).scale = { 2.0f, 10.0f, 2.0f };
-
-				auto& g = reg.emplace<GeometricDesign>(e);
+			{
+				GeometricDesign g;
 				g.shapeType = GeoShape::Cube;
 				g.isWireframe = true;
 				g.color = { baseCol.x * 0.5f, baseCol.y * 0.5f, baseCol.z * 0.5f, 0.1f };
 
-				ctx.cityBuildings.push_back(e);
+				int buildings = 60;
+				for (int i = 0; i < buildings; ++i) {
+					float angle = (i / (float)buildings) * XM_2PI;
+					float dist = radius + 10.0f + (rand() % 20);
+
+					Transform t;
+					t.position = { cosf(angle) * dist, -10.0f, sinf(angle) * dist };
+					t.scale = { 2.0f, 10.0f, 2.0f };
+
+					Entity e = commands.create();
+					commands.emplace<Transform>(e, t);
+					commands.emplace<GeometricDesign>(e, g);
+					commands.emplace<FieldPart>(e, FieldPart{ FieldPart::Kind::Building, i });
+				}
 			}
 
 			// 透明な壁
 			{
-				ctx.mainBarrier = reg.create();
-				reg.emplace<Transform>(ctx.mainBarrier).position = { 0, 5.0f, 0 };
-				reg.get<Transform>(ctx.mainBarrier).scale = { radius * 2.0f, 20.0f, radius * 2.0f };
-				auto& g = reg.emplace<GeometricDesign>(ctx.mainBarrier);
+				Transform t;
+				t.position = { 0, 5.0f, 0 };
+				t.scale = { radius * 2.0f, 20.0f, radius * 2.0f };
+
+				GeometricDesign g;
 				g.shapeType = GeoShape::Cylinder;
 				g.isWireframe = true;
 				g.color = { baseCol.x, baseCol.y, baseCol.z, 0.1f };
+
+				Entity e = commands.create();
+				commands.emplace<Transform>(e, t);
+				commands.emplace<GeometricDesign>(e, g);
+				commands.emplace<FieldPart>(e, FieldPart{ FieldPart::Kind::Barrier, 0 });
 			}
 		}
 	};
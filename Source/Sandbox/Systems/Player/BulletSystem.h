@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 #include "Sandbox/Components/Player/Bullet.h"
 #include "Sandbox/Components/Enemy/EnemyStats.h"
 #include "Sandbox/Components/Player/PlayerTime.h" // 追加
@@ -19,23 +20,20 @@ namespace Arche
 		BulletSystem() { m_systemName = "BulletSystem"; m_group = SystemGroup::PlayOnly; }
 
 		void DestroyRecursive(Registry& reg, Entity e) {
-			if (reg.has<Relationship>(e)) {
-				for (auto child : reg.get<Relationship>(e).children)
-					if (reg.valid(child)) DestroyRecursive(reg, child);
-			}
-			reg.destroy(e);
+			for (Entity child : Hierarchy::Children(reg, e))
+				DestroyRecursive(reg, child);
+			reg.commands().destroy(e);
 		}
 
 		void Update(Registry& reg) override
 		{
 			float dt = Time::DeltaTime();
-			auto view = reg.view<Bullet, Transform>();
-			std::vector<Entity> deadBullets;
-			std::vector<Entity> deadEnemies;
+			auto view = reg.query<Bullet, Transform>();
+			CommandBuffer& commands = reg.commands();
 
 			// プレイヤー情報キャッシュ
 			Entity player = NullEntity;
-			for (auto p : reg.view<PlayerTime, Transform>()) { player = p; break; }
+			for (auto p : reg.query<PlayerTime, Transform>()) { player = p; break; }
 
 			for (auto e : view)
 			{
@@ -55,36 +53,35 @@ namespace Arche
 
 				// Case 1: プレイヤーの弾 -> 敵
 				if (b.owner == EntityType::Player) {
-					float hitR = (reg.has<AttackAttribute>(e) && reg.get<AttackAttribute>(e).isPenetrate) ? 5.0f : 2.0f;
-					for (auto target : reg.view<EnemyStats, Transform>()) {
-						bool dead = false;
-						for (auto de : deadEnemies) if (de == target) dead = true;
-						if (dead) continue;
+					float hitR = (reg.has<AttackAttribute>(e) && reg.read<AttackAttribute>(e).isPenetrate) ? 5.0f : 2.0f;
+					for (auto target : reg.query<EnemyStats, Transform>()) {
+						if (commands.isQueuedForDestroy(target)) continue;
 
-						auto& ePos = reg.get<Transform>(target).position;
+						// 敵の位置は読むだけ（全ての弾 x 敵で変更扱いにしない）
+						const auto& ePos = reg.read<Transform>(target).position;
 						float dx = t.position.x - ePos.x; float dy = t.position.y - ePos.y; float dz = t.position.z - ePos.z;
 						if (dx * dx + dy * dy + dz * dz < hitR * hitR) {
 							auto& stats = reg.get<EnemyStats>(target);
 							stats.hp -= b.damage;
 							FloatingTextSystem::Spawn(reg, ePos, (int)b.damage, { 1,1,1,1 }, 0.8f);
 							if (stats.hp <= 0.0f) {
-								float rate = 1.0f; if (reg.has<AttackAttribute>(e)) rate = reg.get<AttackAttribute>(e).rewardRate;
+								float rate = 1.0f; if (reg.has<AttackAttribute>(e)) rate = reg.read<AttackAttribute>(e).rewardRate;
 								float rwd = stats.killReward * rate;
 								if (reg.valid(player)) {
 									auto& pt = reg.get<PlayerTime>(player);
 									pt.currentTime += rwd; if (pt.currentTime > pt.maxTime) pt.currentTime = pt.maxTime;
-									FloatingTextSystem::Spawn(reg, reg.get<Transform>(player).position, (int)rwd, { 0,1,0,1 }, 1.2f);
+									FloatingTextSystem::Spawn(reg, reg.read<Transform>(player).position, (int)rwd, { 0,1,0,1 }, 1.2f);
 								}
 								GameSession::lastScore += stats.scoreValue;
-								deadEnemies.push_back(target);
+								DestroyRecursive(reg, target);
 							}
-							if (!reg.get<AttackAttribute>(e).isPenetrate) { hit = true; break; }
+							if (!reg.read<AttackAttribute>(e).isPenetrate) { hit = true; break; }
 						}
 					}
 				}
 				// Case 2: 敵の弾 -> プレイヤー
 				else if (b.owner == EntityType::Enemy && reg.valid(player)) {
-					auto& pPos = reg.get<Transform>(player).position;
+					const auto& pPos = reg.read<Transform>(player).position;
 					float dx = t.position.x - pPos.x; float dy = t.position.y - pPos.y; float dz = t.position.z - pPos.z;
 					if (dx * dx + dy * dy + dz * dz < 1.0f) { // プレイヤー判定小さめ
 						auto& pt = reg.get<PlayerTime>(player);
@@ -94,14 +91,9 @@ namespace Arche
 					}
 				}
 
-				if (hit) deadBullets.push_back(e);
-
 				b.lifeTime -= dt;
-				if (b.lifeTime <= 0.0f) deadBullets.push_back(e);
+				if (hit || b.lifeTime <= 0.0f) commands.destroy(e);
 			}
-
-			for (auto e : deadBullets) if (reg.valid(e)) reg.destroy(e);
-			for (auto e : deadEnemies) if (reg.valid(e)) DestroyRecursive(reg, e);
 		}
 	};
 }
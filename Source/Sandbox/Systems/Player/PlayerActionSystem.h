@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 #include "Engine/Core/Window/Input.h"
 #include "Engine/Audio/AudioManager.h" // ★追加
 #include "Sandbox/Components/Player/PlayerController.h"
@@ -44,10 +45,8 @@ namespace Arche
 			if (state.cooldown > 0) state.cooldown -= dt;
 			if (state.shootCooldown > 0) state.shootCooldown -= dt;
 
-			auto view = reg.view<PlayerController, Transform>();
-			Entity player = NullEntity;
-			for (auto e : view) { player = e; break; }
-			if (player == NullEntity) return;
+			Entity player = reg.unique<PlayerController>();
+			if (player == NullEntity || !reg.isActive(player) || !reg.has<Transform>(player)) return;
 
 			auto& t = reg.get<Transform>(player);
 			auto& ctrl = reg.get<PlayerController>(player);
@@ -106,17 +105,15 @@ namespace Arche
 		void PlaySound(Registry& reg, std::string key, XMFLOAT3 pos, float vol = 1.0f) {
 			XMFLOAT3 listenerPos = pos;
 			for (auto e : reg.view<AudioListener, Transform>()) {
-				listenerPos = reg.get<Transform>(e).position; break;
+				listenerPos = reg.read<Transform>(e).position; break;
 			}
 			AudioManager::Instance().Play3DSE(key, pos, listenerPos, 50.0f, vol);
 		}
 
 		void DestroyRecursive(Registry& reg, Entity e) {
-			if (reg.has<Relationship>(e)) {
-				for (auto child : reg.get<Relationship>(e).children)
-					if (reg.valid(child)) DestroyRecursive(reg, child);
-			}
-			reg.destroy(e);
+			for (Entity child : Hierarchy::Children(reg, e))
+				DestroyRecursive(reg, child);
+			reg.commands().destroy(e);
 		}
 
 		void DoShoot(Registry& reg, Transform& t, const PlayerController& ctrl, ActionState& state) {
@@ -125,7 +122,7 @@ namespace Arche
 			XMFLOAT3 aimDir = { 0,0,1 };
 			if (reg.valid(ctrl.focusTarget) && reg.has<Transform>(ctrl.focusTarget)) {
 				XMVECTOR pPos = XMLoadFloat3(&spawnPos);
-				XMVECTOR tPos = XMLoadFloat3(&reg.get<Transform>(ctrl.focusTarget).position);
+				XMVECTOR tPos = XMLoadFloat3(&reg.read<Transform>(ctrl.focusTarget).position);
 				tPos += XMVectorSet(0, 1.0f, 0, 0);
 				XMStoreFloat3(&aimDir, XMVector3Normalize(tPos - pPos));
 			}
@@ -191,10 +188,11 @@ namespace Arche
 		}
 
 		void SpawnHitbox(Registry& reg, XMFLOAT3 center, float radius, float damage, float rewardRate, ActionState& state) {
-			std::vector<Entity> deadEnemies; bool hitAny = false;
+			bool hitAny = false;
 			auto enemies = reg.view<EnemyStats, Transform>();
 			for (auto e : enemies) {
-				auto& et = reg.get<Transform>(e);
+				if (reg.commands().isQueuedForDestroy(e)) continue;
+				const auto& et = reg.read<Transform>(e);
 				float dx = et.position.x - center.x; float dz = et.position.z - center.z;
 				if (dx * dx + dz * dz < radius * radius) {
 					auto& stats = reg.get<EnemyStats>(e);
@@ -206,15 +204,14 @@ namespace Arche
 						for (auto p : reg.view<PlayerTime>()) {
 							auto& pt = reg.get<PlayerTime>(p);
 							pt.currentTime += reward; if (pt.currentTime > pt.maxTime) pt.currentTime = pt.maxTime;
-							FloatingTextSystem::Spawn(reg, reg.get<Transform>(p).position, (int)reward, { 0, 1, 0, 1 }, 1.5f);
+							FloatingTextSystem::Spawn(reg, reg.read<Transform>(p).position, (int)reward, { 0, 1, 0, 1 }, 1.5f);
 						}
 						GameSession::lastScore += stats.scoreValue;
-						deadEnemies.push_back(e);
+						DestroyRecursive(reg, e);
 						PlaySound(reg, "se_explosion", et.position, 1.0f);
 					}
 				}
 			}
-			for (auto e : deadEnemies) DestroyRecursive(reg, e);
 			if (hitAny) state.hitStopTimer = 0.05f;
 		}
 
@@ -236,7 +233,7 @@ namespace Arche
 		void UpdateEffects(Registry& reg, ActionState& state, float dt) {
 			for (auto it = state.effects.begin(); it != state.effects.end(); ) {
 				it->life -= dt;
-				if (it->life <= 0) { if (reg.valid(it->e)) reg.destroy(it->e); it = state.effects.erase(it); }
+				if (it->life <= 0) { reg.commands().destroy(it->e); it = state.effects.erase(it); }
 				else {
 					if (reg.valid(it->e)) {
 						auto& t = reg.get<Transform>(it->e);
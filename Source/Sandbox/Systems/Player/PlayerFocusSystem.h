@@ -12,27 +12,33 @@ namespace Arche
 	class PlayerFocusSystem : public ISystem
 	{
 	public:
-		PlayerFocusSystem() { m_systemName = "PlayerFocusSystem"; }
+		PlayerFocusSystem()
+		{
+			m_systemName = "PlayerFocusSystem";
+			m_access.write<PlayerController>()
+				.readWith<PlayerController, Transform>()
+				.readWith<EnemyStats, Transform>();
+		}
 
 		void Update(Registry& reg) override
 		{
-			// プレイヤー検索
-			Entity player = NullEntity;
-			for (auto e : reg.view<PlayerController, Transform>()) { player = e; break; }
-			if (player == NullEntity) return;
+			// プレイヤー取得（唯一コンポーネント）
+			Entity player = reg.unique<PlayerController>();
+			if (player == NullEntity || !reg.isActive(player) || !reg.has<Transform>(player)) return;
 
 			auto& ctrl = reg.get<PlayerController>(player);
-			auto& pTrans = reg.get<Transform>(player);
+			const auto& pTrans = reg.read<Transform>(player);
 			XMVECTOR pPos = XMLoadFloat3(&pTrans.position);
 
 			// 最も近い敵を探す
 			Entity bestTarget = NullEntity;
 			float minDistanceSq = 30.0f * 30.0f; // 射程距離の2乗
 
-			for (auto e : reg.view<EnemyStats, Transform>())
+			// 敵の Transform は読むだけ（変更扱いにしない）
+			for (auto e : reg.view<const EnemyStats, const Transform>())
 			{
 				// 画面内の敵のみ対象にするなどのロジックも可
-				XMVECTOR ePos = XMLoadFloat3(&reg.get<Transform>(e).position);
+				XMVECTOR ePos = XMLoadFloat3(&reg.read<Transform>(e).position);
 				float distSq = XMVectorGetX(XMVector3LengthSq(ePos - pPos));
 
 				if (distSq < minDistanceSq) {
@@ -59,21 +59,21 @@ namespace Arche
 
 			float pTime = 0.0f; float pMaxTime = 5.0f; XMFLOAT3 pPos = { 0,0,0 };
 			for (auto e : reg.view<PlayerTime, Transform>()) {
-				auto& pt = reg.get<PlayerTime>(e); auto& t = reg.get<Transform>(e);
+				const auto& pt = reg.read<PlayerTime>(e); const auto& t = reg.read<Transform>(e);
 				pTime = pt.currentTime; pMaxTime = pt.maxTime; pPos = t.position;
 				break;
 			}
 
-			Entity cam = NullEntity; for (auto e : reg.view<Camera>()) { cam = e; break; }
-			if (cam == NullEntity) return;
-			auto& camT = reg.get<Transform>(cam);
+			Entity cam = reg.unique<Camera>();
+			if (cam == NullEntity || !reg.isActive(cam) || !reg.has<Transform>(cam)) return;
+			const auto& camT = reg.read<Transform>(cam);
 
 			float dt = Time::DeltaTime(); float time = Time::TotalTime();
 
 			// ボス警告
 			bool bossExists = false;
 			for (auto e : reg.view<EnemyStats>()) {
-				auto type = reg.get<EnemyStats>(e).type;
+				auto type = reg.read<EnemyStats>(e).type;
 				if (type == EnemyType::Boss_Omega || type == EnemyType::Boss_Tank ||
 					type == EnemyType::Boss_Prism || type == EnemyType::Boss_Carrier || type == EnemyType::Boss_Construct || type == EnemyType::Boss_Titan) {
 					bossExists = true; break;
@@ -198,7 +198,7 @@ namespace Arche
 		}
 
 		// ★修正版: コンパス方式で方向を表示
-		void UpdateOffscreenIndicators(Registry& reg, PlayerHUDContext& ctx, Transform& camT) {
+		void UpdateOffscreenIndicators(Registry& reg, PlayerHUDContext& ctx, const Transform& camT) {
 			XMVECTOR camPos = XMLoadFloat3(&camT.position);
 			// HUD配置用の行列 (カメラの回転全適用)
 			XMMATRIX camRotFull = XMMatrixRotationRollPitchYaw(camT.rotation.x, camT.rotation.y, camT.rotation.z);
@@ -214,7 +214,7 @@ namespace Arche
 			for (auto e : enemies) {
 				if (used >= ctx.indicatorPool.size()) break;
 
-				auto& eT = reg.get<Transform>(e);
+				const auto& eT = reg.read<Transform>(e);
 				XMVECTOR ePos = XMLoadFloat3(&eT.position);
 				XMVECTOR toEnemy = ePos - camPos;
 				float dist = XMVectorGetX(XMVector3Length(toEnemy));
@@ -230,7 +230,7 @@ namespace Arche
 					Entity ind = ctx.indicatorPool[used++];
 					auto& t = reg.get<Transform>(ind);
 					auto& g = reg.get<GeometricDesign>(ind);
-					auto& stats = reg.get<EnemyStats>(e);
+					const auto& stats = reg.read<EnemyStats>(e);
 
 					// --- コンパスロジック ---
 					// カメラのYaw回転を打ち消して、相対位置を計算
@@ -309,16 +309,16 @@ namespace Arche
 			}
 		}
 
-		void UpdateReticle(Registry& reg, PlayerHUDContext& ctx, XMFLOAT3 pPos, Transform& camT, float dt) {
+		void UpdateReticle(Registry& reg, PlayerHUDContext& ctx, XMFLOAT3 pPos, const Transform& camT, float dt) {
 			Entity target = NullEntity; float minD = 999.0f;
 			for (auto e : reg.view<EnemyStats, Transform>()) {
-				float d = XMVectorGetX(XMVector3Length(XMLoadFloat3(&reg.get<Transform>(e).position) - XMLoadFloat3(&pPos)));
+				float d = XMVectorGetX(XMVector3Length(XMLoadFloat3(&reg.read<Transform>(e).position) - XMLoadFloat3(&pPos)));
 				if (d < minD && d < 20.0f) { minD = d; target = e; }
 			}
 			if (reg.valid(ctx.reticleRoot)) {
 				auto& t = reg.get<Transform>(ctx.reticleRoot);
 				if (target != NullEntity) {
-					auto& targetT = reg.get<Transform>(target);
+					const auto& targetT = reg.read<Transform>(target);
 					XMMATRIX targetWorld = targetT.GetWorldMatrix();
 					XMVECTOR targetWorldPos = targetWorld.r[3];
 
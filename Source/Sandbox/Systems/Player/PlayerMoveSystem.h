@@ -119,14 +119,15 @@ namespace Arche
 			}
 
 			for (auto e : reg.view<EnemyStats, Transform>()) {
-				auto& t = reg.get<Transform>(e);
-				auto type = reg.get<EnemyStats>(e).type;
+				const auto& t = reg.read<Transform>(e);
+				auto type = reg.read<EnemyStats>(e).type;
 
 				float enemyFloor = floorY;
 				// 浮遊する敵は少し高く
 				if (type == EnemyType::Boss_Omega || type == EnemyType::Boss_Carrier) enemyFloor = 5.0f;
 
-				if (t.position.y < enemyFloor) t.position.y = enemyFloor;
+				// 押し戻す時だけ書き込む（床の上に居る敵は変更扱いにしない）
+				if (t.position.y < enemyFloor) reg.get<Transform>(e).position.y = enemyFloor;
 			}
 		}
 	};
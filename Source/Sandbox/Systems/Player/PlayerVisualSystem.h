@@ -23,9 +23,8 @@ namespace Arche
 
 		void Update(Registry& reg) override
 		{
-			Entity player = NullEntity;
-			for (auto e : reg.view<PlayerController>()) { player = e; break; }
-			if (!reg.valid(player)) return;
+			Entity player = reg.unique<PlayerController>();
+			if (!reg.valid(player) || !reg.isActive(player)) return;
 
 			auto& pTrans = reg.get<Transform>(player);
 
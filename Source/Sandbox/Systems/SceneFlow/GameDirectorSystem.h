@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Engine/Scene/Core/ECS/ECS.h"
+#include "Engine/Scene/Core/Hierarchy.h"
 #include "Engine/Scene/Core/SceneManager.h"
 #include "Engine/Scene/Core/SceneTransition.h" 
 #include "Engine/Core/Time/Time.h"
@@ -251,7 +252,7 @@ namespace Arche
 			// --- ダメージ/ボス回復ボーナスの判定 ---
 			for (auto e : currentEnemies) {
 				if (!reg.valid(e)) continue;
-				auto& s = reg.get<EnemyStats>(e);
+				const auto& s = reg.read<EnemyStats>(e);
 				int lastHp = s.maxHp;
 				for (auto& c : data.enemyCache) {
 					if (c.e == e) { lastHp = c.lastHp; break; }
@@ -270,7 +271,7 @@ namespace Arche
 			if (waveHasBoss) {
 				int bossCount = 0;
 				for (auto e : currentEnemies) {
-					if (IsBoss(reg.get<EnemyStats>(e).type)) bossCount++;
+					if (IsBoss(reg.read<EnemyStats>(e).type)) bossCount++;
 				}
 
 				// ボスが全滅し、生成キューも空の場合
@@ -298,16 +299,12 @@ namespace Arche
 			data.enemyCache.clear();
 			// 最新の生存状況を反映
 			for (auto e : reg.view<EnemyStats>()) {
-				data.enemyCache.push_back({ e, (int)reg.get<EnemyStats>(e).hp });
+				data.enemyCache.push_back({ e, (int)reg.read<EnemyStats>(e).hp });
 			}
 		}
 
 		void DestroyRecursive(Registry& reg, Entity e) {
-			if (reg.has<Relationship>(e)) {
-				for (auto child : reg.get<Relationship>(e).children)
-					if (reg.valid(child)) DestroyRecursive(reg, child);
-			}
-			reg.destroy(e);
+			Hierarchy::DestroyRecursive(reg, e);
 		}
 
 		bool IsBoss(EnemyType type) {
@@ -346,9 +343,9 @@ namespace Arche
 		void TogglePause(Registry& reg, GameDirectorData& data) {
 			data.isPaused = !data.isPaused;
 			float s = data.isPaused ? 1.0f : 0.0f;
-			Entity cam = NullEntity; for (auto e : reg.view<Camera>()) { cam = e; break; }
-			if (reg.valid(cam)) {
-				auto& ct = reg.get<Transform>(cam);
+			Entity cam = reg.unique<Camera>();
+			if (cam != NullEntity && reg.isActive(cam) && reg.has<Transform>(cam)) {
+				const auto& ct = reg.read<Transform>(cam);
 				XMMATRIX rot = XMMatrixRotationRollPitchYaw(ct.rotation.x, ct.rotation.y, ct.rotation.z);
 				XMVECTOR pos = XMLoadFloat3(&ct.position) + XMVector3TransformCoord({ 0,0,5 }, rot);
 				XMFLOAT3 p; XMStoreFloat3(&p, pos);
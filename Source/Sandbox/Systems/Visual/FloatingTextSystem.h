@@ -21,13 +21,22 @@ namespace Arche
 	class FloatingTextSystem : public ISystem
 	{
 	public:
-		FloatingTextSystem() { m_systemName = "FloatingTextSystem"; m_group = SystemGroup::PlayOnly; }
+		FloatingTextSystem()
+		{
+			m_systemName = "FloatingTextSystem";
+			m_group = SystemGroup::PlayOnly;
+			m_access.writeWith<FloatingText, FloatingText, Transform, TextComponent>()
+				.readWith<Camera, Transform>();
+		}
 
 		// ダメージポップアップ生成ヘルパー (staticにして他から呼べるようにする簡易実装)
 		static void Spawn(Registry& reg, const DirectX::XMFLOAT3& pos, int damage, const DirectX::XMFLOAT4& color, float scale = 1.0f)
 		{
-			Entity e = reg.create();
-			auto& t = reg.emplace<Transform>(e);
+			// 同じフレームに大量に出るため CommandBuffer に積み、同期点でまとめて作成する
+			CommandBuffer& commands = reg.commands();
+			Entity e = commands.create();
+
+			Transform t;
 			t.position = pos;
 			// カメラの向きに合わせるビルボード処理はUpdateで行うか、生成時にカメラ取得が必要
 			// ここでは簡易的にY軸回転のみランダムなどで誤魔化さず、Updateでカメラを向かせる
@@ -37,34 +46,37 @@ namespace Arche
 			t.position.y += 1.0f;
 			t.position.z += (rand() % 100 / 100.0f - 0.5f) * 0.5f;
 			t.scale = { scale, scale, scale };
+			commands.emplace<Transform>(e, t);
 
-			auto& txt = reg.emplace<TextComponent>(e);
+			TextComponent txt;
 			char buf[16]; sprintf_s(buf, "%d", damage);
 			txt.text = buf;
 			txt.fontKey = "Makinas 4 Square";
 			txt.fontSize = 40.0f * scale;
 			txt.color = color;
 			txt.centerAlign = true;
+			commands.emplace<TextComponent>(e, std::move(txt));
 
-			auto& ft = reg.emplace<FloatingText>(e);
+			FloatingText ft;
 			ft.life = 0.8f;
 			ft.maxLife = 0.8f;
 			ft.velocity = { 0, 3.0f, 0 };
+			commands.emplace<FloatingText>(e, ft);
 		}
 
 		void Update(Registry& reg) override
 		{
 			float dt = Time::DeltaTime();
 
-			// カメラ取得（ビルボード用）
-			Entity cam = NullEntity;
-			for (auto e : reg.view<Camera>()) { cam = e; break; }
+			// カメラ取得（ビルボード用 / Transform を持たない・非アクティブなカメラは使わない）
+			Entity cam = reg.unique<Camera>();
+			const bool hasCamera = cam != NullEntity && reg.isActive(cam) && reg.has<Transform>(cam);
 			DirectX::XMFLOAT3 camRot = { 0,0,0 };
-			if (reg.valid(cam)) camRot = reg.get<Transform>(cam).rotation;
+			if (hasCamera) camRot = reg.read<Transform>(cam).rotation;
 
-			// テキスト更新
+			// テキスト更新（削除は同期点でまとめて行う）
+			CommandBuffer& commands = reg.commands();
 			auto view = reg.view<FloatingText, Transform, TextComponent>();
-			std::vector<Entity> deadList;
 
 			for (auto e : view)
 			{
@@ -81,7 +93,7 @@ namespace Arche
 				ft.velocity.y -= dt * 5.0f; // 重力
 
 				// ビルボード（カメラを向く）
-				if (reg.valid(cam)) t.rotation = camRot;
+				if (hasCamera) t.rotation = camRot;
 
 				// 寿命
 				ft.life -= dt;
@@ -94,11 +106,9 @@ namespace Arche
 				t.scale = { s, s, s };
 
 				if (ft.life <= 0.0f) {
-					deadList.push_back(e);
+					commands.destroy(e);
 				}
 			}
-
-			for (auto e : deadList) reg.destroy(e);
 		}
 	};
 }
@@ -36,12 +36,12 @@ namespace Arche
 			}
 			else
 			{
-				// アクティブなカメラを探す
-				auto view = registry.view<Camera, Transform>();
-				for (auto e : view)
+				// メインカメラ（唯一コンポーネント）
+				Entity camera = registry.unique<Camera>();
+				if (camera != NullEntity && registry.isActive(camera) && registry.has<Transform>(camera))
 				{
-					auto& cam = view.get<Camera>(e);
-					auto& trans = view.get<Transform>(e);
+					const Camera& cam = registry.read<Camera>(camera);
+					const Transform& trans = registry.read<Transform>(camera);
 
 					// ビュー行列
 					XMVECTOR eye = XMLoadFloat3(&trans.position);
@@ -54,7 +54,6 @@ namespace Arche
 					projMatrix = XMMatrixPerspectiveFovLH(cam.fov, cam.aspect, cam.nearZ, cam.farZ);
 
 					cameraFound = true;
-					break; // 1つ見つかればOK
 				}
 			}
 
@@ -70,7 +69,11 @@ namespace Arche
 			float dt = Time::DeltaTime();
 			float unscaleDt = Time::DeltaTime();
 
-			registry.view<GeometricDesign, Transform>().each([&](Entity e, GeometricDesign& geo, Transform& trans) {
+			// 演出の更新と行列計算は並列に行い、描画呼び出しだけを順番に行う
+			auto query = registry.query<GeometricDesign, const Transform>();
+			m_drawItems.resize(query.size());
+
+			query.par_each([&](std::size_t index, Entity e, GeometricDesign& geo, const Transform& trans) {
 				// 1. 演出ロジックの更新
 				float timeStep = geo.ignoreTimeScale ? 0.016f : dt;
 				geo.timer += timeStep;
@@ -103,39 +106,61 @@ namespace Arche
 				);
 				world = scaleMat * world;
 
+				// 結果は一致リスト内の位置に書き込む（他のジョブと重ならない）
+				DrawItem& item = m_drawItems[index];
+				XMStoreFloat4x4(&item.world, world);
+				item.color = geo.color;
+				item.shape = geo.shapeType;
 				// ワイヤーフレーム判定
-				bool finalWireframe = (geo.isWireframe ^ flashOverride) || globalWireframe;
+				item.wireframe = (geo.isWireframe ^ flashOverride) || globalWireframe;
+				});
+
+			// 3. 形状毎の描画呼び出し（従来の each と同じく末尾から）
+			for (std::size_t i = m_drawItems.size(); i > 0; --i)
+			{
+				const DrawItem& item = m_drawItems[i - 1];
+				XMMATRIX world = XMLoadFloat4x4(&item.world);
 
-				// 3. 形状毎の描画呼び出し
-				switch (geo.shapeType)
+				switch (item.shape)
 				{
 				case GeoShape::Cube:
-					PrimitiveRenderer::DrawBox(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawBox(world, item.color, item.wireframe);
 					break;
 				case GeoShape::Sphere:
-					PrimitiveRenderer::DrawSphere(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawSphere(world, item.color, item.wireframe);
 					break;
 				case GeoShape::Cylinder:
-					PrimitiveRenderer::DrawCylinder(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawCylinder(world, item.color, item.wireframe);
 					break;
 				case GeoShape::Capsule:
-					PrimitiveRenderer::DrawCapsule(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawCapsule(world, item.color, item.wireframe);
 					break;
 				case GeoShape::Pyramid:
-					PrimitiveRenderer::DrawPyramid(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawPyramid(world, item.color, item.wireframe);
 					break;
 				case GeoShape::Cone:
-					PrimitiveRenderer::DrawCone(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawCone(world, item.color, item.wireframe);
 					break;
 				case GeoShape::Torus:
-					PrimitiveRenderer::DrawTorus(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawTorus(world, item.color, item.wireframe);
 					break;
 				case GeoShape::Diamond:
-					PrimitiveRenderer::DrawDiamond(world, geo.color, finalWireframe);
+					PrimitiveRenderer::DrawDiamond(world, item.color, item.wireframe);
 					break;
 				}
-				});
+			}
 		}
+
+	private:
+		// 並列計算した描画パラメータ
+		struct DrawItem
+		{
+			XMFLOAT4X4 world;
+			XMFLOAT4 color;
+			GeoShape shape;
+			bool wireframe;
+		};
+		std::vector<DrawItem> m_drawItems;
 	};
 }	// namespace Arche
 
@@ -0,0 +1,226 @@
+﻿/*****************************************************************//**
+ * @file	ChangeTickTests.cpp
+ * @brief	変更ティック（changed / added フィルタ）のテスト
+ *
+ * @details
+ * 描画のように読むだけの走査が、コンポーネントを変更扱いにしないことを確認する。
+ * （変更扱いになると、次のフレームで階層・衝突の再計算が全件に走る）
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Tests/TestCommon.h"
+
+namespace Arche
+{
+	namespace Test
+	{
+		namespace
+		{
+			// Transform 相当
+			struct TestTransform
+			{
+				float position[3] = {};
+				float world[16] = {};
+			};
+
+			// MeshComponent 相当（読み込んだモデルをキャッシュする）
+			struct TestMesh
+			{
+				int modelKey = 0;
+				const void* model = nullptr;
+			};
+
+			// PointLight 相当
+			struct TestLight
+			{
+				float range = 10.0f;
+			};
+
+			// 最適化で走査が消えないように使う
+			volatile float g_sink = 0.0f;
+			void DoNotDiscard(float value) { g_sink = g_sink + value; }
+
+			// World::runSystem と同じ手順で、1システム分のティックを発行して func を実行する
+			template<typename Func>
+			void RunAsSystem(Registry& registry, Tick& lastRun, Func func)
+			{
+				SystemTicks ticks{ registry.advanceTick(), lastRun };
+				{
+					TickScope scope(ticks);
+					func();
+				}
+				lastRun = ticks.thisRun;
+			}
+
+			// 前回の実行以降に TestTransform が変更されたエンティティ数
+			std::size_t CountChangedTransforms(Registry& registry, Tick& lastRun)
+			{
+				std::size_t count = 0;
+				RunAsSystem(registry, lastRun, [&]() {
+					registry.view<const TestTransform>().changed<TestTransform>().each([&](Entity, const TestTransform&) { ++count; });
+				});
+				return count;
+			}
+
+			// ModelRenderSystem の影 / メインパスと同じ走査
+			void RenderPass(Registry& registry)
+			{
+				static const int dummyModel = 0;
+
+				registry.view<const TestTransform, const TestLight>().each([&](Entity, const TestTransform& t, const TestLight& l) {
+					DoNotDiscard(t.position[0] + l.range);
+				});
+
+				auto meshes = registry.group<TestMesh>(With<const TestTransform>{});
+				meshes.sort([](const TestMesh& a, const TestMesh& b) { return a.modelKey < b.modelKey; });
+				for (int pass = 0; pass < 2; ++pass)
+				{
+					meshes.each([&](Entity, TestMesh& m, const TestTransform& t) {
+						if (!m.model) m.model = &dummyModel;
+						DoNotDiscard(t.world[0]);
+					});
+				}
+			}
+
+			void StaticMeshIsNotChangedByRenderPass(Tester& tester)
+			{
+				Registry registry;
+				Tick hierarchyRun = 0;
+
+				// 読み込み（動かない物と光源）
+				for (int i = 0; i < 8; ++i)
+				{
+					Entity e = registry.create();
+					registry.emplace<TestTransform>(e);
+					registry.emplace<TestMesh>(e, TestMesh{ 7 - i, nullptr });
+					if (i % 4 == 0) registry.emplace<TestLight>(e);
+				}
+
+				// 1フレーム目は追加されたばかりなので全て変更扱い
+				ARCHE_CHECK(tester, CountChangedTransforms(registry, hierarchyRun) == 8);
+
+				// 描画しても、次のフレームでは変更扱いにならない
+				for (int frame = 0; frame < 3; ++frame)
+				{
+					Tick renderRun = 0;
+					RunAsSystem(registry, renderRun, [&]() { RenderPass(registry); });
+					ARCHE_CHECK(tester, CountChangedTransforms(registry, hierarchyRun) == 0);
+				}
+			}
+
+			void WritingPassMarksChanged(Tester& tester)
+			{
+				Registry registry;
+				Tick hierarchyRun = 0;
+
+				Entity moving = registry.create();
+				registry.emplace<TestTransform>(moving);
+				registry.emplace<TestMesh>(moving);
+				Entity still = registry.create();
+				registry.emplace<TestTransform>(still);
+				CountChangedTransforms(registry, hierarchyRun);
+
+				// const でない参照で受け取った物だけが変更扱いになる
+				Tick physicsRun = 0;
+				RunAsSystem(registry, physicsRun, [&]() {
+					registry.group<TestMesh>(With<TestTransform>{}).each([](Entity, TestMesh&, TestTransform& t) { t.position[1] += 1.0f; });
+				});
+				ARCHE_CHECK(tester, CountChangedTransforms(registry, hierarchyRun) == 1);
+
+				// false を返した物は変更扱いにしない
+				RunAsSystem(registry, physicsRun, [&]() {
+					registry.view<TestTransform>().each([](Entity, TestTransform&) { return false; });
+				});
+				ARCHE_CHECK(tester, CountChangedTransforms(registry, hierarchyRun) == 0);
+			}
+
+			void ReadDoesNotMarkChanged(Tester& tester)
+			{
+				Registry registry;
+				Tick hierarchyRun = 0;
+
+				Entity e = registry.create();
+				registry.emplace<TestTransform>(e);
+				CountChangedTransforms(registry, hierarchyRun);
+
+				Tick run = 0;
+				RunAsSystem(registry, run, [&]() { DoNotDiscard(registry.read<TestTransform>(e).position[0]); });
+				ARCHE_CHECK(tester, CountChangedTransforms(registry, hierarchyRun) == 0);
+
+				// 非 const の get は書き込みとして記録する
+				RunAsSystem(registry, run, [&]() { registry.get<TestTransform>(e).position[0] = 1.0f; });
+				ARCHE_CHECK(tester, CountChangedTransforms(registry, hierarchyRun) == 1);
+			}
+
+			// 書き込みの宣言を確かめるシステム（TestMesh を持つ物の TestMesh だけを書く）
+			class DeclaredSystem : public ISystem
+			{
+			public:
+				DeclaredSystem()
+				{
+					m_systemName = "Declared System";
+					m_group = SystemGroup::Always;
+					m_access.writeWith<TestMesh, TestMesh>().readWith<TestMesh, TestTransform>();
+				}
+
+				void Update(Registry& registry) override
+				{
+					for (Entity e : registry.view<const TestMesh>())
+					{
+						canWriteMesh = registry.isWriteDeclared<TestMesh>(e);
+						canWriteTransform = registry.isWriteDeclared<TestTransform>(e);
+					}
+				}
+
+				bool canWriteMesh = false;
+				bool canWriteTransform = true;
+			};
+
+			void UndeclaredWriteIsDetected(Tester& tester)
+			{
+				World world;
+				DeclaredSystem* system = world.registerSystem<DeclaredSystem>();
+
+				Registry& registry = world.getRegistry();
+				Entity e = registry.create();
+				registry.emplace<TestTransform>(e);
+				registry.emplace<TestMesh>(e);
+
+				// Registry::get はこの判定が false なら assert で止まる
+				world.Tick(EditorState::Play);
+				ARCHE_CHECK(tester, system->canWriteMesh);
+				ARCHE_CHECK(tester, !system->canWriteTransform);
+
+				// システム外（ロード処理など）は確認しない
+				ARCHE_CHECK(tester, registry.isWriteDeclared<TestTransform>(e));
+			}
+		}
+
+		void RunChangeTickTests(Tester& tester)
+		{
+			const struct
+			{
+				const char* name;
+				void (*run)(Tester&);
+			} cases[] = {
+				{ "static_mesh_is_not_changed_by_render_pass", StaticMeshIsNotChangedByRenderPass },
+				{ "writing_pass_marks_changed", WritingPassMarksChanged },
+				{ "read_does_not_mark_changed", ReadDoesNotMarkChanged },
+				{ "undeclared_write_is_detected", UndeclaredWriteIsDetected },
+			};
+
+			for (const auto& c : cases)
+			{
+				tester.Begin("ChangeTick", c.name);
+				c.run(tester);
+				tester.End();
+			}
+		}
+
+	}	// namespace Test
+
+}	// namespace Arche
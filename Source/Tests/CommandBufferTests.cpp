@@ -0,0 +1,155 @@
+﻿/*****************************************************************//**
+ * @file	CommandBufferTests.cpp
+ * @brief	CommandBuffer（構造変更の遅延実行）のテスト
+ *
+ * @details
+ * 記録した順ではなく 作成 -> 追加 -> 削除 -> Active 変更 -> 破棄 の固定順で適用されることと、
+ * 破棄の予約（isQueuedForDestroy）が playback までだけ見えることを確認する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Tests/TestCommon.h"
+
+namespace Arche
+{
+	namespace Test
+	{
+		namespace
+		{
+			struct TestHealth
+			{
+				int value = 0;
+			};
+
+			struct TestTag {};
+
+			void QueuedForDestroyUntilPlayback(Tester& tester)
+			{
+				Registry registry;
+				Entity a = registry.create();
+				Entity b = registry.create();
+
+				CommandBuffer& commands = registry.commands();
+				commands.destroy(a);
+				ARCHE_CHECK(tester, commands.isQueuedForDestroy(a));
+				ARCHE_CHECK(tester, !commands.isQueuedForDestroy(b));
+
+				// 仮ハンドルは本物と同じインデックスでも区別する（a の仮インデックスは 0）
+				Entity pending = commands.create();
+				ARCHE_CHECK(tester, !commands.isQueuedForDestroy(pending));
+				commands.destroy(pending);
+				ARCHE_CHECK(tester, commands.isQueuedForDestroy(pending));
+				ARCHE_CHECK(tester, !commands.isQueuedForDestroy(b));
+
+				// playback で予約は消える（再利用されたインデックスを誤って破棄扱いにしない）
+				commands.playback(registry);
+				ARCHE_CHECK(tester, !registry.valid(a));
+				ARCHE_CHECK(tester, registry.valid(b));
+				ARCHE_CHECK(tester, !commands.isQueuedForDestroy(a));
+
+				Entity reused = NullEntity;
+				for (int i = 0; i < 4 && EntityTraits::toIndex(reused) != EntityTraits::toIndex(a); ++i) reused = registry.create();
+				ARCHE_CHECK(tester, EntityTraits::toIndex(reused) == EntityTraits::toIndex(a));
+				ARCHE_CHECK(tester, !commands.isQueuedForDestroy(reused));
+				ARCHE_CHECK(tester, commands.empty());
+			}
+
+			void CreateEmplaceDestroyInOneBuffer(Tester& tester)
+			{
+				Registry registry;
+				const std::size_t before = registry.aliveCount();
+
+				// 破棄を先に記録しても、作成と追加の後に適用される
+				CommandBuffer& commands = registry.commands();
+				Entity pending = commands.create();
+				commands.destroy(pending);
+				commands.emplace<TestHealth>(pending, TestHealth{ 5 });
+				commands.playback(registry);
+				ARCHE_CHECK(tester, registry.aliveCount() == before);
+
+				// 作成 -> 追加 -> Active 変更（仮ハンドルのまま全て指定できる）
+				Entity kept = commands.create();
+				commands.setActive(kept, false);
+				commands.emplace<TestHealth>(kept, TestHealth{ 3 });
+				commands.playback(registry);
+				ARCHE_CHECK(tester, registry.aliveCount() == before + 1);
+
+				std::size_t found = 0;
+				registry.view<const TestHealth>().each([&](Entity, const TestHealth& h) { found += (h.value == 3); });
+				ARCHE_CHECK(tester, found == 0);	// 非アクティブなので走査されない
+			}
+
+			void RemoveIsAppliedAfterEmplace(Tester& tester)
+			{
+				Registry registry;
+				Entity e = registry.create();
+				registry.emplace<TestTag>(e);
+
+				// 削除を先に記録しても、追加の後に適用されるので結果は「持っていない」
+				CommandBuffer& commands = registry.commands();
+				commands.remove<TestHealth>(e);
+				commands.emplace<TestHealth>(e, TestHealth{ 1 });
+				commands.playback(registry);
+				ARCHE_CHECK(tester, !registry.has<TestHealth>(e));
+				ARCHE_CHECK(tester, registry.has<TestTag>(e));
+
+				// 追加だけなら上書きされる
+				commands.emplace<TestHealth>(e, TestHealth{ 1 });
+				commands.emplace<TestHealth>(e, TestHealth{ 2 });
+				commands.playback(registry);
+				ARCHE_CHECK(tester, registry.has<TestHealth>(e) && registry.read<TestHealth>(e).value == 2);
+			}
+
+			void ActiveIsAppliedBeforeDestroy(Tester& tester)
+			{
+				Registry registry;
+				Entity e = registry.create();
+				Entity other = registry.create();
+
+				// 破棄された物への Active 変更は無視され、残る物には記録順で適用される
+				CommandBuffer& commands = registry.commands();
+				commands.destroy(e);
+				commands.setActive(e, false);
+				commands.setActive(other, false);
+				commands.setActive(other, true);
+				commands.setActive(other, false);
+				commands.playback(registry);
+				ARCHE_CHECK(tester, !registry.valid(e));
+				ARCHE_CHECK(tester, registry.valid(other) && !registry.isActive(other));
+
+				// 二重の破棄は1回として扱う
+				commands.destroy(other);
+				commands.destroy(other);
+				commands.playback(registry);
+				ARCHE_CHECK(tester, !registry.valid(other));
+			}
+		}
+
+		void RunCommandBufferTests(Tester& tester)
+		{
+			const struct
+			{
+				const char* name;
+				void (*run)(Tester&);
+			} cases[] = {
+				{ "queued_for_destroy_until_playback", QueuedForDestroyUntilPlayback },
+				{ "create_emplace_destroy_in_one_buffer", CreateEmplaceDestroyInOneBuffer },
+				{ "remove_is_applied_after_emplace", RemoveIsAppliedAfterEmplace },
+				{ "active_is_applied_before_destroy", ActiveIsAppliedBeforeDestroy },
+			};
+
+			for (const auto& c : cases)
+			{
+				tester.Begin("CommandBuffer", c.name);
+				c.run(tester);
+				tester.End();
+			}
+		}
+
+	}	// namespace Test
+
+}	// namespace Arche
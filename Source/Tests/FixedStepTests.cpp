@@ -0,0 +1,142 @@
+﻿/*****************************************************************//**
+ * @file	FixedStepTests.cpp
+ * @brief	固定ステップ（FixedUpdate）のテスト
+ *
+ * @details
+ * 1フレームに複数ステップ回した時、2ステップ目以降の衝突判定が
+ * 積分後の位置（ワールド行列 / WorldCollider）を見ていることを確認する。
+ * ※ 物理・衝突システムを使うため、エンジン本体（ArcheEngine）とリンクする構成でのみビルドする
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Tests/TestCommon.h"
+#include "Engine/Core/Time/Time.h"
+#include "Engine/Scene/Core/Hierarchy.h"
+#include "Engine/Scene/Core/TransformInterpolator.h"
+#include "Engine/Scene/Components/Components.h"
+#include "Engine/Scene/Serializer/SystemRegistry.h"
+#include <cmath>
+
+namespace Arche
+{
+	namespace Test
+	{
+		namespace
+		{
+			bool Near(float a, float b) { return std::abs(a - b) < 1e-4f; }
+
+			// 衝突判定の後に、判定が読んだ値を控えるシステム
+			class StepProbe : public ISystem
+			{
+			public:
+				struct Sample
+				{
+					float position = 0.0f;		// 積分後の位置（y）
+					float world = 0.0f;			// ワールド行列の位置（y）
+					float collider = 0.0f;		// WorldCollider の中心（y）
+					float childWorld = 0.0f;	// 子のワールド行列の位置（y）
+				};
+
+				StepProbe(Entity body, Entity child) : m_body(body), m_child(child) { m_systemName = "Step Probe"; }
+
+				void Update(Registry& registry) override
+				{
+					Sample s;
+					s.position = registry.read<Transform>(m_body).position.y;
+					s.world = registry.read<Transform>(m_body).worldMatrix._42;
+					s.collider = registry.read<WorldCollider>(m_body).center.y;
+					s.childWorld = registry.read<Transform>(m_child).worldMatrix._42;
+					samples.push_back(s);
+				}
+
+				std::vector<Sample> samples;
+
+			private:
+				Entity m_body;
+				Entity m_child;
+			};
+
+			void CollisionSeesIntegratedPositionEveryStep(Tester& tester)
+			{
+				constexpr int Steps = 3;
+				constexpr float ChildOffset = 1.0f;
+
+				World world;
+				Registry& reg = world.getRegistry();
+				Hierarchy::Install(reg);
+
+				// 落下する物と、その子（子は Rigidbody を持たないので押し合わない）
+				Entity body = reg.create();
+				reg.emplace<Transform>(body, XMFLOAT3{ 0.0f, 10.0f, 0.0f });
+				reg.emplace<Rigidbody>(body);
+				reg.emplace<Collider>(body);
+				Entity child = reg.create();
+				reg.emplace<Transform>(child, XMFLOAT3{ 0.0f, ChildOffset, 0.0f });
+				reg.emplace<Collider>(child);
+				Hierarchy::SetParent(reg, child, body);
+
+				// シーンと同じく名前から作る（登録順 = 実行順）
+				ARCHE_CHECK(tester, SystemRegistry::Instance().CreateSystem(world, "Physics System", SystemGroup::FixedUpdate) != nullptr);
+				ARCHE_CHECK(tester, SystemRegistry::Instance().CreateSystem(world, "Collision System", SystemGroup::FixedUpdate) != nullptr);
+				StepProbe* probe = world.registerSystem<StepProbe>(SystemGroup::FixedUpdate, body, child);
+
+				// 1フレームで Steps 回分の時間を進める（SceneManager::RunFixedSteps と同じ手順）
+				const int previousMaxSteps = Time::GetMaxFixedSteps();
+				Time::SetMaxFixedSteps(Steps);
+				Time::Advance(Time::FixedDeltaTime() * (Steps + 0.5f));
+				const int steps = Time::ConsumeFixedSteps();
+				ARCHE_CHECK(tester, steps == Steps);
+
+				for (int i = 0; i < steps; ++i)
+				{
+					Time::BeginFixedStep(i);
+					TransformInterpolator::BeginStep(reg);
+					world.FixedTick(EditorState::Play);
+					TransformInterpolator::EndStep(reg);
+					Time::EndFixedStep();
+				}
+				world.Tick(EditorState::Play);
+
+				Time::Advance(0.0f);
+				Time::SetMaxFixedSteps(previousMaxSteps);
+
+				ARCHE_CHECK(tester, (int)probe->samples.size() == Steps);
+				for (std::size_t i = 0; i < probe->samples.size(); ++i)
+				{
+					const StepProbe::Sample& s = probe->samples[i];
+					ARCHE_CHECK(tester, Near(s.world, s.position));
+					ARCHE_CHECK(tester, Near(s.collider, s.position));
+					ARCHE_CHECK(tester, Near(s.childWorld, s.position + ChildOffset));
+
+					// 毎ステップ落下している（同じ位置を見続けていない）
+					if (i > 0) ARCHE_CHECK(tester, s.position < probe->samples[i - 1].position);
+				}
+			}
+		}
+
+		void RunFixedStepTests(Tester& tester)
+		{
+			const struct
+			{
+				const char* name;
+				void (*run)(Tester&);
+			} cases[] = {
+				{ "collision_sees_integrated_position_every_step", CollisionSeesIntegratedPositionEveryStep },
+			};
+
+			for (const auto& c : cases)
+			{
+				tester.Begin("FixedStep", c.name);
+				c.run(tester);
+				tester.End();
+			}
+		}
+
+	}	// namespace Test
+
+}	// namespace Arche
@@ -0,0 +1,247 @@
+﻿/*****************************************************************//**
+ * @file	HierarchyTests.cpp
+ * @brief	Hierarchy（侵入型の親子リスト）のテスト
+ *
+ * @details
+ * 挿入位置の指定・同じ親の中での並べ替え・破棄による切り離しで、
+ * 先頭 / 末尾 / 兄弟のリンクと子の数が崩れないことを確認する。
+ * 保存と読み込みで子の並びが変わらないこと（SceneSerializer の繋ぎ直し）も確認する。
+ * ※ Relationship / シーンの保存を使うため、エンジン本体（ArcheEngine）とリンクする構成でのみビルドする
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Tests/TestCommon.h"
+#include "Engine/Scene/Core/Hierarchy.h"
+#include "Engine/Scene/Core/SceneManager.h"
+#include "Engine/Scene/Components/Components.h"
+#include "Engine/Scene/Serializer/SceneSerializer.h"
+#include <filesystem>
+
+namespace Arche
+{
+	namespace Test
+	{
+		namespace
+		{
+			// 子の並びが expected と一致し、リンクが両方向で揃っているか
+			bool IsChildOrder(Registry& reg, Entity parent, const std::vector<Entity>& expected)
+			{
+				if (Hierarchy::GetChildren(reg, parent) != expected) return false;
+				if (Hierarchy::GetChildCount(reg, parent) != (uint32_t)expected.size()) return false;
+
+				const Relationship& rel = reg.read<Relationship>(parent);
+				if (expected.empty()) return rel.firstChild == NullEntity && rel.lastChild == NullEntity;
+				if (rel.firstChild != expected.front() || rel.lastChild != expected.back()) return false;
+
+				for (std::size_t i = 0; i < expected.size(); ++i)
+				{
+					const Relationship& c = reg.read<Relationship>(expected[i]);
+					if (c.parent != parent || c.depth != rel.depth + 1) return false;
+					if (c.prevSibling != (i > 0 ? expected[i - 1] : NullEntity)) return false;
+					if (c.nextSibling != (i + 1 < expected.size() ? expected[i + 1] : NullEntity)) return false;
+					if (Hierarchy::GetChildIndex(reg, expected[i]) != (int)i) return false;
+				}
+				return true;
+			}
+
+			// 親と count 個の子（末尾に追加した順）
+			Entity MakeFamily(Registry& reg, int count, std::vector<Entity>& children)
+			{
+				Entity parent = reg.create();
+				for (int i = 0; i < count; ++i)
+				{
+					Entity c = reg.create();
+					Hierarchy::SetParent(reg, c, parent);
+					children.push_back(c);
+				}
+				return parent;
+			}
+
+			void InsertAtIndex(Tester& tester)
+			{
+				Registry reg;
+				Hierarchy::Install(reg);
+				std::vector<Entity> c;
+				Entity parent = MakeFamily(reg, 2, c);
+
+				// 先頭 / 途中 / 範囲外（末尾）
+				Entity head = reg.create();
+				Entity middle = reg.create();
+				Entity tail = reg.create();
+				ARCHE_CHECK(tester, Hierarchy::InsertChild(reg, parent, head, 0));
+				ARCHE_CHECK(tester, Hierarchy::InsertChild(reg, parent, middle, 2));
+				ARCHE_CHECK(tester, Hierarchy::InsertChild(reg, parent, tail, 99));
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { head, c[0], middle, c[1], tail }));
+
+				// 自分の祖先の子にはできない
+				ARCHE_CHECK(tester, !Hierarchy::InsertChild(reg, head, parent, 0));
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { head, c[0], middle, c[1], tail }));
+			}
+
+			void ReorderWithinSameParent(Tester& tester)
+			{
+				Registry reg;
+				Hierarchy::Install(reg);
+				std::vector<Entity> c;
+				Entity parent = MakeFamily(reg, 4, c);
+
+				// 末尾 -> 先頭
+				Hierarchy::InsertChild(reg, parent, c[3], 0);
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { c[3], c[0], c[1], c[2] }));
+
+				// 先頭 -> 途中（外してから数えた位置に入る）
+				Hierarchy::InsertChild(reg, parent, c[3], 2);
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { c[0], c[1], c[3], c[2] }));
+
+				// 途中 -> 末尾
+				Hierarchy::InsertChild(reg, parent, c[1], -1);
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { c[0], c[3], c[2], c[1] }));
+
+				// 同じ親への SetParent は並びを変えない
+				ARCHE_CHECK(tester, Hierarchy::SetParent(reg, c[0], parent));
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { c[0], c[3], c[2], c[1] }));
+			}
+
+			void DestroyMiddleChild(Tester& tester)
+			{
+				Registry reg;
+				Hierarchy::Install(reg);
+				std::vector<Entity> c;
+				Entity parent = MakeFamily(reg, 3, c);
+
+				// 破棄（Relationship の削除通知）で前後の兄弟が繋がる
+				reg.destroy(c[1]);
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { c[0], c[2] }));
+
+				// 先頭と末尾も同様
+				reg.destroy(c[0]);
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { c[2] }));
+				reg.destroy(c[2]);
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, {}));
+
+				// Relationship だけを外しても同じ
+				std::vector<Entity> d;
+				Entity other = MakeFamily(reg, 3, d);
+				reg.remove<Relationship>(d[1]);
+				ARCHE_CHECK(tester, IsChildOrder(reg, other, { d[0], d[2] }));
+			}
+
+			void DestroyParentOrphansChildren(Tester& tester)
+			{
+				Registry reg;
+				Hierarchy::Install(reg);
+				std::vector<Entity> c;
+				Entity parent = MakeFamily(reg, 3, c);
+				Entity grandChild = reg.create();
+				Hierarchy::SetParent(reg, grandChild, c[1]);
+				ARCHE_CHECK(tester, reg.isActive(c[1]) && reg.isActive(grandChild));
+
+				reg.destroy(parent);
+
+				// 子は兄弟から切り離されたルート（深さ 0）になり、非アクティブになる
+				for (Entity child : c)
+				{
+					const Relationship& rel = reg.read<Relationship>(child);
+					ARCHE_CHECK(tester, reg.valid(child));
+					ARCHE_CHECK(tester, rel.prevSibling == NullEntity && rel.nextSibling == NullEntity);
+					ARCHE_CHECK(tester, rel.depth == 0);
+					ARCHE_CHECK(tester, Hierarchy::GetChildIndex(reg, child) == -1);
+					ARCHE_CHECK(tester, !reg.isActive(child));
+				}
+
+				// 孫は子に繋がったまま（深さだけ付け直される）
+				ARCHE_CHECK(tester, IsChildOrder(reg, c[1], { grandChild }));
+				ARCHE_CHECK(tester, reg.read<Relationship>(grandChild).depth == 1);
+				ARCHE_CHECK(tester, !reg.isActive(grandChild));
+
+				// 切り離された子は別の親に付け直せる
+				Entity adopter = reg.create();
+				ARCHE_CHECK(tester, Hierarchy::SetParent(reg, c[2], adopter));
+				ARCHE_CHECK(tester, IsChildOrder(reg, adopter, { c[2] }));
+				ARCHE_CHECK(tester, reg.isActive(c[2]));
+			}
+
+			// 名前で探す（読み込み後は ID が変わるため）
+			Entity FindByName(Registry& reg, const std::string& name)
+			{
+				Entity found = NullEntity;
+				reg.view<const Tag>().each([&](Entity e, const Tag& tag) { if (tag.name == name) found = e; });
+				return found;
+			}
+
+			void SaveLoadKeepsChildOrder(Tester& tester)
+			{
+				SceneManager scene;
+				World& world = scene.GetWorld();
+				Registry& reg = world.getRegistry();
+				Hierarchy::Install(reg);
+
+				auto named = [&](const char* name) {
+					Entity e = reg.create();
+					Tag tag;
+					tag.name = name;
+					reg.emplace<Tag>(e, tag);
+					reg.emplace<Transform>(e);
+					return e;
+				};
+
+				// 作成順と異なる並び（保存時の ID 順でも作成順でもない）
+				Entity parent = named("Parent");
+				Entity a = named("A");
+				Entity b = named("B");
+				Entity c = named("C");
+				Entity nested = named("Nested");
+				Hierarchy::SetParent(reg, a, parent);
+				Hierarchy::SetParent(reg, b, parent);
+				Hierarchy::SetParent(reg, c, parent);
+				Hierarchy::InsertChild(reg, parent, c, 0);
+				Hierarchy::InsertChild(reg, parent, a, -1);
+				Hierarchy::SetParent(reg, nested, b);
+				ARCHE_CHECK(tester, IsChildOrder(reg, parent, { c, b, a }));
+
+				const std::string path = (std::filesystem::temp_directory_path() / "ArcheTests_Hierarchy.json").string();
+				SceneSerializer::SaveScene(world, path);
+				SceneSerializer::LoadScene(world, path);
+				std::filesystem::remove(path);
+
+				Entity loadedParent = FindByName(reg, "Parent");
+				Entity loadedB = FindByName(reg, "B");
+				ARCHE_CHECK(tester, loadedParent != NullEntity && loadedB != NullEntity);
+				if (loadedParent == NullEntity || loadedB == NullEntity) return;
+
+				ARCHE_CHECK(tester, IsChildOrder(reg, loadedParent, { FindByName(reg, "C"), loadedB, FindByName(reg, "A") }));
+				ARCHE_CHECK(tester, IsChildOrder(reg, loadedB, { FindByName(reg, "Nested") }));
+				ARCHE_CHECK(tester, reg.read<Relationship>(loadedParent).depth == 0);
+			}
+		}
+
+		void RunHierarchyTests(Tester& tester)
+		{
+			const struct
+			{
+				const char* name;
+				void (*run)(Tester&);
+			} cases[] = {
+				{ "insert_at_index", InsertAtIndex },
+				{ "reorder_within_same_parent", ReorderWithinSameParent },
+				{ "destroy_middle_child", DestroyMiddleChild },
+				{ "destroy_parent_orphans_children", DestroyParentOrphansChildren },
+				{ "save_load_keeps_child_order", SaveLoadKeepsChildOrder },
+			};
+
+			for (const auto& c : cases)
+			{
+				tester.Begin("Hierarchy", c.name);
+				c.run(tester);
+				tester.End();
+			}
+		}
+
+	}	// namespace Test
+
+}	// namespace Arche
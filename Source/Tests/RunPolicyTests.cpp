@@ -0,0 +1,267 @@
+﻿/*****************************************************************//**
+ * @file	RunPolicyTests.cpp
+ * @brief	システムの実行頻度（SystemRunPolicy）のテスト
+ *
+ * @details
+ * EveryNFrames の phase による開始フレームのずれ、Rate の周期と
+ * 間引いたフレーム分を含む経過時間（m_elapsedTime）を確認する。
+ * TimeSliced は予算切れで止めたところから SliceCursor が続きを処理すること、
+ * 周の途中で範囲から外れたエンティティを飛ばすことを確認する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Tests/TestCommon.h"
+#include <cmath>
+
+namespace Arche
+{
+	namespace Test
+	{
+		namespace
+		{
+			// 2 の累乗分の1（float で誤差なく足せる）
+			constexpr float FrameTime = 1.0f / 32.0f;
+
+			bool Near(float a, float b) { return std::abs(a - b) < 1e-5f; }
+
+			// 実行したフレームと、その時の経過時間を控えるシステム
+			class RunProbe : public ISystem
+			{
+			public:
+				RunProbe(const int* frame) : m_frame(frame) { m_systemName = "Run Probe"; }
+
+				void Update(Registry&) override
+				{
+					frames.push_back(*m_frame);
+					elapsed.push_back(m_elapsedTime);
+				}
+
+				std::vector<int> frames;
+				std::vector<float> elapsed;
+
+			private:
+				const int* m_frame;
+			};
+
+			struct TestCounter
+			{
+				int value = 0;
+			};
+
+			// TestCounter を持つエンティティを SliceCursor で数えるシステム
+			class SliceProbe : public ISystem
+			{
+			public:
+				SliceProbe() { m_systemName = "Slice Probe"; }
+
+				void Update(Registry& reg) override
+				{
+					visited = 0;
+					passDone = m_cursor.each(*this, reg, reg.view<TestCounter>(), [&](Entity e)
+					{
+						++reg.get<TestCounter>(e).value;
+						++visited;
+					});
+				}
+
+				int visited = 0;
+				bool passDone = false;
+
+			private:
+				SliceCursor m_cursor;
+			};
+
+			// frameCount フレーム分 Tick する（frame は 0 から数える）
+			void RunFrames(World& world, int& frame, int frameCount, float deltaTime = FrameTime)
+			{
+				for (int i = 0; i < frameCount; ++i, ++frame)
+				{
+					Time::Advance(deltaTime);
+					world.Tick(EditorState::Play);
+				}
+			}
+
+			void EveryNFramesPhaseOffset(Tester& tester)
+			{
+				World world;
+				int frame = 0;
+
+				// 同じ間隔でも phase で別のフレームに散る
+				RunProbe* head = world.registerSystem<RunProbe>(&frame);
+				head->m_runPolicy.mode = SystemRunPolicy::Mode::EveryNFrames;
+				head->m_runPolicy.interval = 4;
+				head->m_runPolicy.phase = 0.0f;
+
+				RunProbe* half = world.registerSystem<RunProbe>(&frame);
+				half->m_runPolicy = head->m_runPolicy;
+				half->m_runPolicy.phase = 0.5f;
+
+				RunProbe* quarter = world.registerSystem<RunProbe>(&frame);
+				quarter->m_runPolicy = head->m_runPolicy;
+				quarter->m_runPolicy.phase = 0.25f;
+
+				RunFrames(world, frame, 12);
+				ARCHE_CHECK(tester, head->frames == std::vector<int>({ 0, 4, 8 }));
+				ARCHE_CHECK(tester, half->frames == std::vector<int>({ 2, 6, 10 }));
+				ARCHE_CHECK(tester, quarter->frames == std::vector<int>({ 1, 5, 9 }));
+
+				// 経過時間は間引いたフレームの分を含む（1回目は開始までの分）
+				ARCHE_CHECK(tester, Near(head->elapsed[0], FrameTime));
+				ARCHE_CHECK(tester, Near(head->elapsed[1], FrameTime * 4));
+				ARCHE_CHECK(tester, Near(half->elapsed[0], FrameTime * 3));
+				ARCHE_CHECK(tester, Near(half->elapsed[2], FrameTime * 4));
+				ARCHE_CHECK(tester, half->m_skippedFrames == 1);
+
+				// resetRunPolicy 後は、次のフレームから phase を取り直す
+				half->resetRunPolicy();
+				half->frames.clear();
+				RunFrames(world, frame, 4);
+				ARCHE_CHECK(tester, half->frames == std::vector<int>({ 14 }));
+			}
+
+			void RateAccumulatesElapsedTime(Tester& tester)
+			{
+				World world;
+				int frame = 0;
+
+				// 8Hz = 4フレームに1回
+				RunProbe* rate = world.registerSystem<RunProbe>(&frame);
+				rate->m_runPolicy.mode = SystemRunPolicy::Mode::Rate;
+				rate->m_runPolicy.hz = 8.0f;
+
+				// 半周期ずらすと 2フレーム目から
+				RunProbe* shifted = world.registerSystem<RunProbe>(&frame);
+				shifted->m_runPolicy = rate->m_runPolicy;
+				shifted->m_runPolicy.phase = 0.5f;
+
+				RunFrames(world, frame, 12);
+				ARCHE_CHECK(tester, rate->frames == std::vector<int>({ 0, 4, 8 }));
+				ARCHE_CHECK(tester, shifted->frames == std::vector<int>({ 2, 6, 10 }));
+				ARCHE_CHECK(tester, Near(rate->elapsed[1], 1.0f / 8.0f));
+				ARCHE_CHECK(tester, Near(shifted->elapsed[0], FrameTime * 3));
+				ARCHE_CHECK(tester, Near(shifted->elapsed[1], 1.0f / 8.0f));
+
+				// 周期より長いフレームでも1フレームに1回まで（溜まった分は追いかけない）
+				rate->frames.clear();
+				rate->elapsed.clear();
+				RunFrames(world, frame, 3, 0.5f);
+				ARCHE_CHECK(tester, rate->frames.size() == 3);
+				ARCHE_CHECK(tester, Near(rate->elapsed.back(), 0.5f));
+
+				rate->frames.clear();
+				RunFrames(world, frame, 4);
+				ARCHE_CHECK(tester, rate->frames.size() == 1);
+			}
+
+			void TimeSlicedResumesWhereBudgetRanOut(Tester& tester)
+			{
+				World world;
+				int frame = 0;
+				Registry& reg = world.getRegistry();
+				std::vector<Entity> entities;
+				for (int i = 0; i < 5; ++i)
+				{
+					entities.push_back(reg.create());
+					reg.emplace<TestCounter>(entities.back());
+				}
+
+				// 予算 0 でも1フレームに1体は進む
+				SliceProbe* probe = world.registerSystem<SliceProbe>();
+				probe->m_runPolicy.mode = SystemRunPolicy::Mode::TimeSliced;
+				probe->m_runPolicy.budgetUs = 0.0f;
+
+				for (int i = 0; i < 4; ++i)
+				{
+					RunFrames(world, frame, 1);
+					ARCHE_CHECK(tester, probe->visited == 1 && !probe->passDone);
+				}
+				ARCHE_CHECK(tester, Near(probe->m_sliceProgress, 0.8f));
+				RunFrames(world, frame, 1);
+				ARCHE_CHECK(tester, probe->passDone);
+				ARCHE_CHECK(tester, probe->m_slicePasses == 1);
+
+				// 1周で全員ちょうど1回
+				bool once = true;
+				for (Entity e : entities) once &= reg.read<TestCounter>(e).value == 1;
+				ARCHE_CHECK(tester, once);
+
+				// 予算が十分なら1フレームで1周（EveryFrame も同じ）
+				probe->m_runPolicy.budgetUs = 1.0e6f;
+				RunFrames(world, frame, 1);
+				ARCHE_CHECK(tester, probe->visited == 5 && probe->passDone);
+				probe->m_runPolicy.mode = SystemRunPolicy::Mode::EveryFrame;
+				RunFrames(world, frame, 1);
+				ARCHE_CHECK(tester, probe->visited == 5 && probe->passDone);
+				ARCHE_CHECK(tester, probe->m_slicePasses == 3);
+			}
+
+			void SliceSkipsEntitiesLeftRange(Tester& tester)
+			{
+				World world;
+				int frame = 0;
+				Registry& reg = world.getRegistry();
+				std::vector<Entity> entities;
+				for (int i = 0; i < 5; ++i)
+				{
+					entities.push_back(reg.create());
+					reg.emplace<TestCounter>(entities.back());
+				}
+
+				SliceProbe* probe = world.registerSystem<SliceProbe>();
+				probe->m_runPolicy.mode = SystemRunPolicy::Mode::TimeSliced;
+				probe->m_runPolicy.budgetUs = 0.0f;
+
+				// 1体目の後、残りの3体を破棄 / コンポーネント削除 / 非Active で範囲から外す
+				RunFrames(world, frame, 1);
+				ARCHE_CHECK(tester, probe->visited == 1);
+				reg.destroy(entities[1]);
+				reg.remove<TestCounter>(entities[2]);
+				reg.setActive(entities[3], false);
+				Entity late = reg.create();
+				reg.emplace<TestCounter>(late);
+
+				// 外れた分は予算に数えずに飛ばし、同じフレームで5体目まで進む
+				RunFrames(world, frame, 1);
+				ARCHE_CHECK(tester, probe->visited == 1 && probe->passDone);
+				ARCHE_CHECK(tester, reg.read<TestCounter>(entities[4]).value == 1);
+				ARCHE_CHECK(tester, reg.read<TestCounter>(entities[3]).value == 0);
+
+				// 周の途中で増えた分は次の周（残った2体 + 1体）で処理する
+				ARCHE_CHECK(tester, reg.read<TestCounter>(late).value == 0);
+				RunFrames(world, frame, 2);
+				ARCHE_CHECK(tester, !probe->passDone);
+				RunFrames(world, frame, 1);
+				ARCHE_CHECK(tester, probe->passDone);
+				ARCHE_CHECK(tester, reg.read<TestCounter>(late).value == 1);
+				ARCHE_CHECK(tester, reg.read<TestCounter>(entities[0]).value == 2);
+			}
+		}
+
+		void RunRunPolicyTests(Tester& tester)
+		{
+			const struct
+			{
+				const char* name;
+				void (*run)(Tester&);
+			} cases[] = {
+				{ "every_n_frames_phase_offset", EveryNFramesPhaseOffset },
+				{ "rate_accumulates_elapsed_time", RateAccumulatesElapsedTime },
+				{ "time_sliced_resumes_where_budget_ran_out", TimeSlicedResumesWhereBudgetRanOut },
+				{ "slice_skips_entities_left_range", SliceSkipsEntitiesLeftRange },
+			};
+
+			for (const auto& c : cases)
+			{
+				tester.Begin("RunPolicy", c.name);
+				c.run(tester);
+				tester.End();
+			}
+		}
+
+	}	// namespace Test
+
+}	// namespace Arche
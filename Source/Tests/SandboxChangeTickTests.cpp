@@ -0,0 +1,134 @@
+﻿/*****************************************************************//**
+ * @file	SandboxChangeTickTests.cpp
+ * @brief	ゲーム側のシステムが読むだけのコンポーネントを変更扱いにしないかのテスト
+ *
+ * @details
+ * 敵・カメラの Transform を読むだけのシステム（HPバー / ロックオン / 弾の当たり判定など）を
+ * 実際に回し、動かない敵とカメラが次のフレームで changed に拾われないことを確認する。
+ * （拾われると、階層の再計算と WorldCollider の作り直しが毎フレーム全ての敵に走る）
+ * ※ ゲーム側のコンポーネントを使うため、エンジン本体（ArcheEngine）とリンクする構成でのみビルドする
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Engine/pch.h"
+#include "Tests/TestCommon.h"
+#include "Engine/Core/Time/Time.h"
+#include "Engine/Scene/Components/Components.h"
+#include "Sandbox/Systems/Enemy/EnemyUISystem.h"
+#include "Sandbox/Systems/Enemy/EnemyAttackSystem.h"
+#include "Sandbox/Systems/Player/PlayerFocusSystem.h"
+#include "Sandbox/Systems/Player/BulletSystem.h"
+#include "Sandbox/Systems/Visual/FloatingTextSystem.h"
+
+namespace Arche
+{
+	namespace Test
+	{
+		namespace
+		{
+			// 最後に実行し、前回の実行以降に Transform が書き込まれた敵 / カメラを数える
+			class ChangeProbe : public ISystem
+			{
+			public:
+				ChangeProbe() { m_systemName = "Change Probe"; m_group = SystemGroup::PlayOnly; }
+
+				void Update(Registry& registry) override
+				{
+					enemies = 0;
+					cameras = 0;
+					registry.view<const EnemyStats, const Transform>().changed<Transform>().each([&](Entity, const EnemyStats&, const Transform&) { ++enemies; });
+					registry.view<const Camera, const Transform>().changed<Transform>().each([&](Entity, const Camera&, const Transform&) { ++cameras; });
+				}
+
+				std::size_t enemies = 0;
+				std::size_t cameras = 0;
+			};
+
+			void StaticEnemiesAreNotChangedByReaders(Tester& tester)
+			{
+				constexpr int EnemyCount = 16;
+
+				World world;
+				Registry& reg = world.getRegistry();
+
+				Entity camera = reg.create();
+				reg.emplace<Transform>(camera, XMFLOAT3{ 0.0f, 10.0f, -20.0f });
+				reg.emplace<Camera>(camera);
+
+				Entity player = reg.create();
+				reg.emplace<Transform>(player, XMFLOAT3{ 0.0f, 0.0f, 0.0f });
+				reg.emplace<PlayerController>(player);
+				reg.emplace<PlayerTime>(player);
+
+				// 動かない敵（Zako_Cube は撃たない）
+				for (int i = 0; i < EnemyCount; ++i)
+				{
+					Entity enemy = reg.create();
+					reg.emplace<Transform>(enemy, XMFLOAT3{ (float)(i % 4) * 5.0f, 0.0f, 10.0f + (float)(i / 4) * 5.0f });
+					reg.emplace<EnemyStats>(enemy);
+				}
+
+				// 敵から離れていく弾（毎フレーム全ての敵と距離を比べる）
+				Entity bullet = reg.create();
+				reg.emplace<Transform>(bullet, XMFLOAT3{ 0.0f, 0.0f, -500.0f }, XMFLOAT3{ 0.0f, XM_PI, 0.0f });
+				Bullet b;
+				b.owner = EntityType::Player;
+				b.lifeTime = 100.0f;
+				reg.emplace<Bullet>(bullet, b);
+				reg.emplace<AttackAttribute>(bullet);
+
+				world.registerSystem<PlayerFocusSystem>(SystemGroup::PlayOnly);
+				world.registerSystem<EnemyAttackSystem>(SystemGroup::PlayOnly);
+				world.registerSystem<BulletSystem>();
+				world.registerSystem<EnemyUISystem>();
+				world.registerSystem<FloatingTextSystem>();
+				ChangeProbe* probe = world.registerSystem<ChangeProbe>();
+
+				// 1フレーム目は追加されたばかりなので全て変更扱い
+				Time::Advance(1.0f / 60.0f);
+				world.Tick(EditorState::Play);
+				ARCHE_CHECK(tester, probe->enemies == EnemyCount);
+				ARCHE_CHECK(tester, probe->cameras == 1);
+
+				// 以降は読まれるだけなので、変更扱いにならない
+				for (int frame = 0; frame < 3; ++frame)
+				{
+					Time::Advance(1.0f / 60.0f);
+					world.Tick(EditorState::Play);
+					ARCHE_CHECK(tester, probe->enemies == 0);
+					ARCHE_CHECK(tester, probe->cameras == 0);
+				}
+
+				// システムは実際に読んでいる（ロックオン先が決まっている）
+				ARCHE_CHECK(tester, reg.read<PlayerController>(player).focusTarget != NullEntity);
+				ARCHE_CHECK(tester, reg.valid(bullet));
+
+				Time::Advance(0.0f);
+			}
+		}
+
+		void RunSandboxChangeTickTests(Tester& tester)
+		{
+			const struct
+			{
+				const char* name;
+				void (*run)(Tester&);
+			} cases[] = {
+				{ "static_enemies_are_not_changed_by_readers", StaticEnemiesAreNotChangedByReaders },
+			};
+
+			for (const auto& c : cases)
+			{
+				tester.Begin("SandboxChangeTick", c.name);
+				c.run(tester);
+				tester.End();
+			}
+		}
+
+	}	// namespace Test
+
+}	// namespace Arche
@@ -0,0 +1,148 @@
+﻿/*****************************************************************//**
+ * @file	SignalTests.cpp
+ * @brief	Signal（イベント通知）のテスト
+ *
+ * @details
+ * 通知中に接続先が自分自身や他を切断しても、残りの接続先が飛ばされないことを確認する。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Tests/TestCommon.h"
+
+namespace Arche
+{
+	namespace Test
+	{
+		namespace
+		{
+			using TestSignal = Signal<int>;
+
+			// 呼ばれた回数を数える接続先
+			struct Listener
+			{
+				TestSignal* signal = nullptr;
+				int calls = 0;
+				bool disconnectSelf = false;	// 呼ばれたら自分を切断する
+				bool clearAll = false;			// 呼ばれたら全て切断する
+				bool publishNested = false;		// 呼ばれたら入れ子で通知する（1段だけ）
+
+				void OnEvent(int value)
+				{
+					++calls;
+					if (disconnectSelf) signal->disconnect<&Listener::OnEvent>(*this);
+					if (clearAll) signal->clear();
+					if (publishNested && value == 0) signal->publish(1);
+				}
+
+				void Connect(TestSignal& s)
+				{
+					signal = &s;
+					s.connect<&Listener::OnEvent>(*this);
+				}
+			};
+
+			void SelfDisconnectDoesNotSkipNext(Tester& tester)
+			{
+				TestSignal signal;
+				Listener a, b;
+				a.disconnectSelf = true;
+				a.Connect(signal);
+				b.Connect(signal);
+
+				signal.publish(0);
+				ARCHE_CHECK(tester, a.calls == 1);
+				ARCHE_CHECK(tester, b.calls == 1);
+				ARCHE_CHECK(tester, signal.size() == 1);
+
+				// 切断された物は次から呼ばれない
+				signal.publish(0);
+				ARCHE_CHECK(tester, a.calls == 1);
+				ARCHE_CHECK(tester, b.calls == 2);
+			}
+
+			void SelfDisconnectOnHeapDoesNotSkipNext(Tester& tester)
+			{
+				// 固定配列に収まらない数にして、ヒープ側でも確認する
+				TestSignal signal;
+				Listener listeners[TestSignal::InlineCapacity + 2];
+				listeners[2].disconnectSelf = true;
+				listeners[4].disconnectSelf = true;
+				for (Listener& l : listeners) l.Connect(signal);
+
+				signal.publish(0);
+				for (const Listener& l : listeners) ARCHE_CHECK(tester, l.calls == 1);
+				ARCHE_CHECK(tester, signal.size() == TestSignal::InlineCapacity);
+
+				signal.publish(0);
+				ARCHE_CHECK(tester, listeners[2].calls == 1);
+				ARCHE_CHECK(tester, listeners[4].calls == 1);
+				ARCHE_CHECK(tester, listeners[5].calls == 2);
+			}
+
+			void DisconnectInNestedPublish(Tester& tester)
+			{
+				// 内側の通知で切断しても、外側の通知の続きが飛ばされない
+				TestSignal signal;
+				Listener a, b, c;
+				a.publishNested = true;
+				b.disconnectSelf = true;
+				a.Connect(signal);
+				b.Connect(signal);
+				c.Connect(signal);
+
+				signal.publish(0);
+				ARCHE_CHECK(tester, a.calls == 2);	// 外側 + 内側
+				ARCHE_CHECK(tester, b.calls == 1);	// 内側で切断されたため外側では呼ばれない
+				ARCHE_CHECK(tester, c.calls == 2);
+				ARCHE_CHECK(tester, signal.size() == 2);
+			}
+
+			void ClearDuringPublish(Tester& tester)
+			{
+				TestSignal signal;
+				Listener a, b;
+				a.clearAll = true;
+				a.Connect(signal);
+				b.Connect(signal);
+
+				signal.publish(0);
+				ARCHE_CHECK(tester, a.calls == 1);
+				ARCHE_CHECK(tester, b.calls == 0);
+				ARCHE_CHECK(tester, signal.empty());
+
+				// 通知の後は再び接続できる
+				b.Connect(signal);
+				signal.publish(0);
+				ARCHE_CHECK(tester, b.calls == 1);
+				ARCHE_CHECK(tester, signal.size() == 1);
+			}
+		}
+
+		void RunSignalTests(Tester& tester)
+		{
+			const struct
+			{
+				const char* name;
+				void (*run)(Tester&);
+			} cases[] = {
+				{ "self_disconnect_does_not_skip_next", SelfDisconnectDoesNotSkipNext },
+				{ "self_disconnect_on_heap_does_not_skip_next", SelfDisconnectOnHeapDoesNotSkipNext },
+				{ "disconnect_in_nested_publish", DisconnectInNestedPublish },
+				{ "clear_during_publish", ClearDuringPublish },
+			};
+
+			for (const auto& c : cases)
+			{
+				tester.Begin("Signal", c.name);
+				c.run(tester);
+				tester.End();
+			}
+		}
+
+	}	// namespace Test
+
+}	// namespace Arche
@@ -0,0 +1,83 @@
+﻿/*****************************************************************//**
+ * @file	TestCommon.h
+ * @brief	自動テスト用の共通ヘルパー
+ *
+ * @details
+ * 判定（ARCHE_CHECK）と結果の集計（Tester）を行う。
+ * 失敗した判定は式と位置を出力し、1件でも失敗すれば終了コードを 1 にする。
+ * ECS だけを使うテストはエンジン本体に依存しないため、Windows以外でもビルドできる。
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+#ifndef ___TEST_COMMON_H___
+#define ___TEST_COMMON_H___
+
+// ===== インクルード =====
+#include "Engine/Scene/Core/ECS/ECS.h"
+#include <cstdio>
+#include <string>
+
+namespace Arche
+{
+	namespace Test
+	{
+		// 結果の集計
+		class Tester
+		{
+		public:
+			// ケースの開始（以降の判定はこのケースの結果として数える）
+			void Begin(const std::string& suite, const std::string& name)
+			{
+				m_current = suite + "." + name;
+				m_caseFailed = false;
+				++m_cases;
+			}
+
+			// ケースの終了（結果を1行出力する）
+			void End()
+			{
+				if (m_caseFailed) ++m_failedCases;
+				std::printf("[%s] %s\n", m_caseFailed ? "FAIL" : " OK ", m_current.c_str());
+			}
+
+			// 判定（ARCHE_CHECK から呼ばれる）
+			void Check(bool passed, const char* expression, const char* file, int line)
+			{
+				if (passed) return;
+				m_caseFailed = true;
+				std::printf("  %s(%d): %s\n", file, line, expression);
+			}
+
+			int GetCaseCount() const { return m_cases; }
+			int GetFailedCount() const { return m_failedCases; }
+
+		private:
+			std::string m_current;
+			bool m_caseFailed = false;
+			int m_cases = 0;
+			int m_failedCases = 0;
+		};
+
+		// 各スイート
+		void RunChangeTickTests(Tester& tester);
+		void RunSignalTests(Tester& tester);
+		void RunRunPolicyTests(Tester& tester);
+		void RunCommandBufferTests(Tester& tester);
+#ifndef ARCHE_ECS_STANDALONE
+		void RunFixedStepTests(Tester& tester);	// エンジン本体とリンクする構成のみ
+		void RunHierarchyTests(Tester& tester);
+		void RunSandboxChangeTickTests(Tester& tester);
+#endif
+
+	}	// namespace Test
+
+}	// namespace Arche
+
+// ===== マクロ =====
+// 式が偽なら失敗として記録する（ケースは中断しない）
+#define ARCHE_CHECK(tester, expression) (tester).Check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+#endif // !___TEST_COMMON_H___
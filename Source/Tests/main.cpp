@@ -0,0 +1,64 @@
+﻿/*****************************************************************//**
+ * @file	main.cpp
+ * @brief	自動テストのエントリーポイント
+ *
+ * @details
+ * 全スイートを実行し、1件でも失敗があれば終了コード 1 を返す（CTest / CI 用）。
+ *
+ * ArcheTests [--suite=スイート名 ...]
+ *   --suite=X	: 指定したスイートだけ実行する（複数指定可）
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *********************************************************************/
+
+// ===== インクルード =====
+#include "Tests/TestCommon.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	using namespace Arche::Test;
+
+	// スイート名と実行関数の対応
+	struct Suite
+	{
+		const char* name;
+		void (*run)(Tester&);
+	};
+	const Suite suites[] = {
+		{ "ChangeTick", RunChangeTickTests },
+		{ "Signal", RunSignalTests },
+		{ "RunPolicy", RunRunPolicyTests },
+		{ "CommandBuffer", RunCommandBufferTests },
+#ifndef ARCHE_ECS_STANDALONE
+		{ "FixedStep", RunFixedStepTests },
+		{ "Hierarchy", RunHierarchyTests },
+		{ "SandboxChangeTick", RunSandboxChangeTickTests },
+#endif
+	};
+
+	std::vector<std::string> selected;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strncmp(argv[i], "--suite=", 8) == 0) selected.push_back(argv[i] + 8);
+		else
+		{
+			std::fprintf(stderr, "unknown option: %s\n", argv[i]);
+			return 2;
+		}
+	}
+
+	Tester tester;
+	for (const Suite& suite : suites)
+	{
+		if (!selected.empty() && std::find(selected.begin(), selected.end(), suite.name) == selected.end()) continue;
+		suite.run(tester);
+	}
+
+	std::printf("%d / %d passed\n", tester.GetCaseCount() - tester.GetFailedCount(), tester.GetCaseCount());
+	return tester.GetFailedCount() == 0 ? 0 : 1;
+}